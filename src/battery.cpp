@@ -0,0 +1,79 @@
+/**
+ * @file battery.cpp
+ * @brief ESP32 ADC battery measurement (see battery.h).
+ */
+#include "battery.h"
+#include "battery_model.h"
+
+#include <esp_adc_cal.h>
+
+// --- Sampling Configuration ---
+const uint8_t BATTERY_SAMPLE_COUNT = 16;          // Samples per measurement
+const uint16_t BATTERY_SAMPLE_SPACING_US = 500;   // 16 x 0.5 ms: a TX event only hits a few samples
+const unsigned long BATTERY_RADIO_GUARD_MS = 5;   // Settle time after our own radio activity
+const uint32_t BATTERY_DEFAULT_VREF_MV = 1100;    // Used only if the eFuse has no calibration
+
+static adc1_channel_t batteryChannel = ADC1_CHANNEL_7; // GPIO35
+static float batteryDividerRatio = 2.0f;
+static esp_adc_cal_characteristics_t adcCharacteristics;
+static bool batteryReady = false;
+static unsigned long lastRadioActivityMs = 0;
+
+// Filter state survives deep sleep; a cold boot starts over from the first sample
+static RTC_DATA_ATTR BatteryFilterState batteryFilterState = {0, 0.0f};
+static BatteryFilter batteryFilter(batteryFilterState);
+
+void batteryBegin(adc1_channel_t channel, float dividerRatio)
+{
+    batteryChannel = channel;
+    batteryDividerRatio = dividerRatio;
+
+    adc1_config_width(ADC_WIDTH_BIT_12);
+    adc1_config_channel_atten(batteryChannel, ADC_ATTEN_DB_11); // ~0.15-2.45 V usable range
+    esp_adc_cal_value_t calSource = esp_adc_cal_characterize(ADC_UNIT_1, ADC_ATTEN_DB_11, ADC_WIDTH_BIT_12,
+                                                             BATTERY_DEFAULT_VREF_MV, &adcCharacteristics);
+    batteryReady = true;
+
+    const char *calName = (calSource == ESP_ADC_CAL_VAL_EFUSE_TP)     ? "eFuse Two Point"
+                          : (calSource == ESP_ADC_CAL_VAL_EFUSE_VREF) ? "eFuse Vref"
+                                                                      : "Default Vref";
+    Serial.printf("[DEBUG] batteryBegin: ADC1 channel %d, divider %.2f, calibration: %s\n",
+                  batteryChannel, batteryDividerRatio, calName);
+}
+
+void batteryNoteRadioActivity()
+{
+    lastRadioActivityMs = millis();
+}
+
+uint16_t batteryReadMillivolts()
+{
+    if (!batteryReady)
+        return 0;
+
+    // Don't sample right on top of our own transmission
+    unsigned long sinceRadio = millis() - lastRadioActivityMs;
+    if (sinceRadio < BATTERY_RADIO_GUARD_MS)
+        delay(BATTERY_RADIO_GUARD_MS - sinceRadio);
+
+    uint16_t samples[BATTERY_SAMPLE_COUNT];
+    for (uint8_t i = 0; i < BATTERY_SAMPLE_COUNT; i++)
+    {
+        uint32_t raw = (uint32_t)adc1_get_raw(batteryChannel);
+        samples[i] = (uint16_t)esp_adc_cal_raw_to_voltage(raw, &adcCharacteristics); // Pin mV
+        if (i + 1 < BATTERY_SAMPLE_COUNT)
+            delayMicroseconds(BATTERY_SAMPLE_SPACING_US);
+    }
+
+    uint16_t pinMv = robustMeanMillivolts(samples, BATTERY_SAMPLE_COUNT);
+    uint16_t batteryMv = (uint16_t)(pinMv * batteryDividerRatio + 0.5f);
+    uint16_t filteredMv = batteryFilter.update(batteryMv);
+
+    // Serial.printf("[DEBUG] battery: pin %u mV, battery %u mV, filtered %u mV\n", pinMv, batteryMv, filteredMv); // Debug
+    return filteredMv;
+}
+
+uint8_t batteryReadPercent()
+{
+    return lipoPercentFromMillivolts(batteryReadMillivolts());
+}
@@ -0,0 +1,25 @@
+/**
+ * @file battery.h
+ * @brief Battery voltage measurement on the ESP32 ADC.
+ *        Uses the eFuse ADC calibration (esp_adc_cal), takes a burst of samples
+ *        spread over a few ms and averages the middle half (radio TX dips are
+ *        discarded), then smooths with an exponential filter kept in RTC memory
+ *        so it survives deep sleep. Percent comes from the LiPo discharge curve.
+ */
+#pragma once
+
+#include <Arduino.h>
+#include <driver/adc.h>
+
+// channel: ADC1 channel of the battery pin, dividerRatio: battery V / pin V
+void batteryBegin(adc1_channel_t channel, float dividerRatio);
+
+// Takes a fresh measurement and returns the filtered battery voltage in mV
+uint16_t batteryReadMillivolts();
+
+// Takes a fresh measurement and returns the filtered state of charge (0..100)
+uint8_t batteryReadPercent();
+
+// Call after our own radio activity (e.g. a notification) so the next
+// measurement waits out the supply dip
+void batteryNoteRadioActivity();
@@ -0,0 +1,139 @@
+/**
+ * @file battery_model.cpp
+ * @brief Discharge curve, robust averaging, filter and notification policy (see battery_model.h).
+ */
+#include "battery_model.h"
+
+// Typical single-cell LiPo open-circuit curve, highest voltage first.
+// The curve is flat between ~3.75 V and ~3.85 V, which is why a linear
+// 3.0-4.2 V mapping reads far too low for most of the discharge.
+static const LipoCurvePoint LIPO_CURVE[] = {
+    {4200, 100},
+    {4150, 95},
+    {4110, 90},
+    {4080, 85},
+    {4020, 80},
+    {3980, 75},
+    {3950, 70},
+    {3910, 65},
+    {3870, 60},
+    {3850, 55},
+    {3840, 50},
+    {3820, 45},
+    {3800, 40},
+    {3790, 35},
+    {3770, 30},
+    {3750, 25},
+    {3730, 20},
+    {3710, 15},
+    {3690, 10},
+    {3610, 5},
+    {3270, 0},
+};
+static const uint8_t LIPO_CURVE_POINTS = sizeof(LIPO_CURVE) / sizeof(LIPO_CURVE[0]);
+
+uint8_t lipoPercentFromMillivolts(uint16_t millivolts)
+{
+    if (millivolts >= LIPO_CURVE[0].millivolts)
+        return LIPO_CURVE[0].percent;
+    if (millivolts <= LIPO_CURVE[LIPO_CURVE_POINTS - 1].millivolts)
+        return LIPO_CURVE[LIPO_CURVE_POINTS - 1].percent;
+
+    for (uint8_t i = 1; i < LIPO_CURVE_POINTS; i++)
+    {
+        const LipoCurvePoint &hi = LIPO_CURVE[i - 1];
+        const LipoCurvePoint &lo = LIPO_CURVE[i];
+        if (millivolts >= lo.millivolts)
+        {
+            // Linear interpolation, rounded to nearest
+            uint32_t spanMv = hi.millivolts - lo.millivolts;
+            uint32_t spanPct = hi.percent - lo.percent;
+            uint32_t offsetMv = millivolts - lo.millivolts;
+            return lo.percent + (uint8_t)((offsetMv * spanPct + spanMv / 2) / spanMv);
+        }
+    }
+    return 0; // Not reached
+}
+
+uint16_t robustMeanMillivolts(uint16_t *samples, uint8_t count)
+{
+    if (samples == nullptr || count == 0)
+        return 0;
+
+    // Insertion sort, count is small (tens of samples)
+    for (uint8_t i = 1; i < count; i++)
+    {
+        uint16_t v = samples[i];
+        int j = i - 1;
+        while (j >= 0 && samples[j] > v)
+        {
+            samples[j + 1] = samples[j];
+            j--;
+        }
+        samples[j + 1] = v;
+    }
+
+    // Mean of the middle half (interquartile mean); for tiny counts this is the median
+    uint8_t first = count / 4;
+    uint8_t last = count - count / 4; // exclusive
+    uint32_t sum = 0;
+    for (uint8_t i = first; i < last; i++)
+        sum += samples[i];
+    uint8_t used = last - first;
+    return (uint16_t)((sum + used / 2) / used);
+}
+
+BatteryFilter::BatteryFilter(BatteryFilterState &filterState, float filterAlpha, uint16_t resetStep)
+    : state(filterState), alpha(filterAlpha), resetStepMv(resetStep)
+{
+}
+
+uint16_t BatteryFilter::update(uint16_t sampleMillivolts)
+{
+    float sample = (float)sampleMillivolts;
+    float step = sample - state.millivolts;
+    if (!hasValue() || step > resetStepMv || step < -(float)resetStepMv)
+    {
+        // First sample (cold boot) or a real jump: start over from this sample
+        state.millivolts = sample;
+        state.magic = BATTERY_FILTER_MAGIC;
+    }
+    else
+    {
+        state.millivolts += alpha * step;
+    }
+    return value();
+}
+
+uint16_t BatteryFilter::value() const
+{
+    if (!hasValue())
+        return 0;
+    return (uint16_t)(state.millivolts + 0.5f);
+}
+
+BatteryReporter::BatteryReporter(uint8_t hysteresis)
+    : hysteresisPct(hysteresis),
+      immediate(true),
+      hasSent(false),
+      lastSent(0),
+      sentCount(0),
+      suppressedCount(0),
+      skippedCount(0)
+{
+}
+
+bool BatteryReporter::offer(uint8_t level)
+{
+    uint8_t delta = (level > lastSent) ? level - lastSent : lastSent - level;
+    if (immediate || !hasSent || delta >= hysteresisPct)
+    {
+        immediate = false;
+        hasSent = true;
+        lastSent = level;
+        sentCount++;
+        return true;
+    }
+    suppressedCount++;
+    return false;
+}
@@ -0,0 +1,86 @@
+/**
+ * @file battery_model.h
+ * @brief Battery math without hardware access: LiPo discharge curve lookup,
+ *        outlier-robust averaging of ADC samples, an exponential filter
+ *        whose state can live in RTC memory across deep sleep, and the
+ *        change-driven notification policy.
+ *        Plain C++ (no Arduino calls) so it can be checked on the host.
+ */
+#pragma once
+
+#include <stdint.h>
+
+// One point of the open-circuit voltage -> state of charge curve
+struct LipoCurvePoint
+{
+    uint16_t millivolts;
+    uint8_t percent;
+};
+
+// Maps a (rested) LiPo cell voltage to 0..100 % using the discharge curve,
+// interpolating linearly between table points.
+uint8_t lipoPercentFromMillivolts(uint16_t millivolts);
+
+// Sorts `samples` in place and returns the mean of the middle half.
+// Rejects the dips caused by radio TX bursts without needing to know their timing.
+uint16_t robustMeanMillivolts(uint16_t *samples, uint8_t count);
+
+// Filter state, kept separate so it can be placed in RTC_DATA_ATTR memory
+struct BatteryFilterState
+{
+    uint32_t magic; // BATTERY_FILTER_MAGIC when `millivolts` is valid
+    float millivolts;
+};
+
+const uint32_t BATTERY_FILTER_MAGIC = 0xBA77E001;
+
+class BatteryFilter
+{
+public:
+    // alpha: weight of a new sample. A jump larger than resetStepMv (charger
+    // plugged in / removed) re-seeds the filter instead of slowly following it.
+    BatteryFilter(BatteryFilterState &state, float alpha = 0.2f, uint16_t resetStepMv = 150);
+
+    uint16_t update(uint16_t sampleMillivolts);
+    bool hasValue() const { return state.magic == BATTERY_FILTER_MAGIC; }
+    uint16_t value() const; // 0 if no sample yet
+    void reset() { state.magic = 0; }
+
+private:
+    BatteryFilterState &state;
+    float alpha;
+    uint16_t resetStepMv;
+};
+
+// Decides when a battery level is worth a BLE notification: only when it moved
+// at least `hysteresisPct` away from the last value sent, or right after a
+// client subscribed. Also counts the radio events this saves.
+class BatteryReporter
+{
+public:
+    explicit BatteryReporter(uint8_t hysteresisPct = 3);
+
+    // Next offered level is sent regardless of hysteresis (new subscription / reconnect)
+    void requestImmediate() { immediate = true; }
+    bool wantsImmediate() const { return immediate; }
+
+    // Returns true if `level` should be notified; it is then recorded as sent
+    bool offer(uint8_t level);
+
+    // A periodic sample was skipped because nobody is subscribed
+    void noteSkippedSample() { skippedCount++; }
+
+    uint32_t sent() const { return sentCount; }
+    uint32_t suppressed() const { return suppressedCount; }    // Sampled but unchanged
+    uint32_t skipped() const { return skippedCount; }          // Not even sampled
+    uint32_t radioEventsSaved() const { return suppressedCount + skippedCount; }
+
+private:
+    uint8_t hysteresisPct;
+    bool immediate;
+    bool hasSent;
+    uint8_t lastSent;
+    uint32_t sentCount;
+    uint32_t suppressedCount;
+    uint32_t skippedCount;
+};
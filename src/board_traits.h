@@ -0,0 +1,126 @@
+/**
+ * @file board_traits.h
+ * @brief Board and panel description, fixed at compile time.
+ *        Each PlatformIO environment selects one board with a build flag
+ *        (BADGE_BOARD_*, default LilyGo T5 2.13"). BoardTraits<> holds its pins
+ *        and rotation; PanelTraits<> adds the geometry of the selected GxEPD2
+ *        driver, so screen sizes, buffer sizes and the QR scale are constant
+ *        expressions instead of display.width() / height() calls.
+ *        The driver itself stays a macro (GxEPD2_DRIVER_CLASS) because the
+ *        GxEPD2 selection checks paste it into preprocessor tokens.
+ *        Included by GxEPD2_display_selection_new_style.h after <GxEPD2_BW.h>.
+ */
+#pragma once
+
+#include <stdint.h>
+
+// --- Boards (one per PlatformIO environment) ---
+struct BoardLilyGoT5_213 // LilyGo T5 2.13", GDEY0213B74
+{
+};
+struct BoardLilyGoT5_213_BN // LilyGo T5 V2.3.1 / V2.4.1 2.13", DEPG0213BN
+{
+};
+struct BoardLilyGoT5_266 // LilyGo T5 2.66", DEPG0266BN
+{
+};
+
+template <typename Board>
+struct BoardTraits;
+
+template <>
+struct BoardTraits<BoardLilyGoT5_213>
+{
+    static constexpr int8_t PIN_EPD_CS = 5;
+    static constexpr int8_t PIN_EPD_DC = 17;
+    static constexpr int8_t PIN_EPD_RST = 16;
+    static constexpr int8_t PIN_EPD_BUSY = 4;
+    static constexpr int8_t PIN_BUTTON = 39;  // RTC GPIO, wakes from deep sleep
+    static constexpr int8_t PIN_BATTERY = 35; // Behind a 100k/100k divider
+    static constexpr uint8_t ROTATION = 1;    // Landscape
+};
+
+// Same board, other panel
+template <>
+struct BoardTraits<BoardLilyGoT5_213_BN> : BoardTraits<BoardLilyGoT5_213>
+{
+};
+
+template <>
+struct BoardTraits<BoardLilyGoT5_266>
+{
+    static constexpr int8_t PIN_EPD_CS = 5;
+    static constexpr int8_t PIN_EPD_DC = 19;
+    static constexpr int8_t PIN_EPD_RST = 4;
+    static constexpr int8_t PIN_EPD_BUSY = 34;
+    static constexpr int8_t PIN_BUTTON = 39;
+    static constexpr int8_t PIN_BATTERY = 35;
+    static constexpr uint8_t ROTATION = 1;
+};
+
+#if defined(BADGE_BOARD_T5_266)
+typedef BoardLilyGoT5_266 BadgeBoard;
+#define GxEPD2_DRIVER_CLASS GxEPD2_266_BN
+#elif defined(BADGE_BOARD_T5_213_BN)
+typedef BoardLilyGoT5_213_BN BadgeBoard;
+#define GxEPD2_DRIVER_CLASS GxEPD2_213_BN
+#else
+typedef BoardLilyGoT5_213 BadgeBoard;
+#define GxEPD2_DRIVER_CLASS GxEPD2_213_GDEY0213B74
+#endif
+
+// --- Board + panel ---
+template <typename Board, typename Panel>
+struct PanelTraits : BoardTraits<Board>
+{
+    typedef BoardTraits<Board> Pins;
+
+    static constexpr int16_t NATIVE_WIDTH = Panel::WIDTH_VISIBLE;
+    static constexpr int16_t NATIVE_HEIGHT = Panel::HEIGHT;
+    static constexpr uint16_t STRIDE = Panel::WIDTH / 8; // Bytes per native row of the buffer
+    static constexpr uint16_t FRAME_BYTES = STRIDE * Panel::HEIGHT;
+
+    // Logical size after setRotation(ROTATION)
+    static constexpr int16_t WIDTH = (Pins::ROTATION & 1) ? NATIVE_HEIGHT : NATIVE_WIDTH;
+    static constexpr int16_t HEIGHT = (Pins::ROTATION & 1) ? NATIVE_WIDTH : NATIVE_HEIGHT;
+
+    // Logical rectangle to native panel coordinates (as GxEPD2_BW rotates windows)
+    static void toNative(int16_t &x, int16_t &y, int16_t &w, int16_t &h)
+    {
+        int16_t lx = x, ly = y, lw = w, lh = h;
+        switch (Pins::ROTATION & 3)
+        {
+        case 1:
+            x = NATIVE_WIDTH - ly - lh;
+            y = lx;
+            w = lh;
+            h = lw;
+            break;
+        case 2:
+            x = NATIVE_WIDTH - lx - lw;
+            y = NATIVE_HEIGHT - ly - lh;
+            break;
+        case 3:
+            x = ly;
+            y = NATIVE_HEIGHT - lx - lw;
+            w = lh;
+            h = lw;
+            break;
+        }
+    }
+
+    // Largest whole-pixel module size that fits a QR code of `modules` plus its
+    // quiet zone on the short side (0 if it does not fit at all)
+    static constexpr int16_t qrScale(int16_t modules, int16_t quietZone)
+    {
+        return (WIDTH < HEIGHT ? WIDTH : HEIGHT) / (modules + 2 * quietZone);
+    }
+};
+
+typedef PanelTraits<BadgeBoard, GxEPD2_DRIVER_CLASS> Badge;
+
+// ESP32 ADC1 channel of a GPIO (-1 if the pin is not on ADC1)
+constexpr int8_t adc1ChannelForPin(int8_t pin)
+{
+    return pin >= 36 ? pin - 36 : (pin >= 32 ? pin - 28 : -1);
+}
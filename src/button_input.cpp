@@ -0,0 +1,262 @@
+/**
+ * @file button_input.cpp
+ * @brief Gesture recognition, action mapping and pending intent handling (see button_input.h).
+ */
+#include "button_input.h"
+
+#include <string.h>
+
+static const char *const GESTURE_NAMES[GESTURE_COUNT] = {"click", "double", "long"};
+static const char *const ACTION_NAMES[ACTION_COUNT] = {"none", "next", "info", "qr", "blank", "split", "sleep"};
+
+static int findName(const char *name, const char *const *names, int count)
+{
+    for (int i = 0; i < count; i++)
+        if (strcmp(name, names[i]) == 0)
+            return i;
+    return -1;
+}
+
+bool parseButtonMapping(const char *text, ButtonMapping &mapping)
+{
+    if (text == nullptr || *text == '\0')
+        return false;
+
+    ButtonMapping m = mapping;
+    const char *cursor = text;
+    while (*cursor != '\0')
+    {
+        const char *end = strchr(cursor, ',');
+        size_t len = end ? (size_t)(end - cursor) : strlen(cursor);
+        char pair[24];
+        if (len == 0 || len >= sizeof(pair))
+            return false;
+        memcpy(pair, cursor, len);
+        pair[len] = '\0';
+
+        char *eq = strchr(pair, '=');
+        if (eq == nullptr)
+            return false;
+        *eq = '\0';
+        int gesture = findName(pair, GESTURE_NAMES, GESTURE_COUNT);
+        int action = findName(eq + 1, ACTION_NAMES, ACTION_COUNT);
+        if (gesture < 0 || action < 0)
+            return false;
+        m.action[gesture] = (uint8_t)action;
+
+        cursor = end ? end + 1 : cursor + len;
+    }
+    mapping = m;
+    return true;
+}
+
+bool buttonMappingValid(const ButtonMapping &mapping)
+{
+    for (uint8_t i = 0; i < GESTURE_COUNT; i++)
+        if (mapping.action[i] >= ACTION_COUNT)
+            return false;
+    return true;
+}
+
+ButtonInput::ButtonInput()
+    : pendingAction(ACTION_NONE),
+      pendingSinceMs(0),
+      busy(false),
+      queuedWhileBusyCount(0),
+      supersededCount(0)
+{
+    // Default mapping
+    actionMap[GESTURE_CLICK] = ACTION_NEXT_MODE;
+    actionMap[GESTURE_DOUBLE_CLICK] = ACTION_SHOW_SPLIT; // Everything in one refresh
+    actionMap[GESTURE_LONG_PRESS] = ACTION_SLEEP;
+}
+
+void ButtonInput::setAction(ButtonGesture gesture, ButtonAction action)
+{
+    if (gesture >= GESTURE_COUNT)
+        return;
+    actionMap[gesture] = action;
+}
+
+ButtonAction ButtonInput::actionFor(ButtonGesture gesture) const
+{
+    if (gesture >= GESTURE_COUNT)
+        return ACTION_NONE;
+    return actionMap[gesture];
+}
+
+void ButtonInput::setMapping(const ButtonMapping &mapping)
+{
+    if (!buttonMappingValid(mapping))
+        return;
+    for (uint8_t i = 0; i < GESTURE_COUNT; i++)
+        actionMap[i] = (ButtonAction)mapping.action[i];
+}
+
+ButtonMapping ButtonInput::mapping() const
+{
+    ButtonMapping mapping;
+    for (uint8_t i = 0; i < GESTURE_COUNT; i++)
+        mapping.action[i] = (uint8_t)actionMap[i];
+    return mapping;
+}
+
+void ButtonInput::onGesture(ButtonGesture gesture, uint32_t nowMs)
+{
+    ButtonAction action = actionFor(gesture);
+    if (action == ACTION_NONE)
+        return; // Unmapped gesture, nothing to queue
+
+    if (pendingAction != ACTION_NONE)
+        supersededCount++;
+    if (busy)
+        queuedWhileBusyCount++;
+
+    pendingAction = action;
+    pendingSinceMs = nowMs;
+}
+
+void ButtonInput::setBusy(bool isBusyNow)
+{
+    busy = isBusyNow;
+}
+
+ButtonAction ButtonInput::takeIntent()
+{
+    if (busy || pendingAction == ACTION_NONE)
+        return ACTION_NONE;
+
+    ButtonAction action = pendingAction;
+    pendingAction = ACTION_NONE;
+    return action;
+}
+
+uint32_t ButtonInput::intentAgeMs(uint32_t nowMs) const
+{
+    if (pendingAction == ACTION_NONE)
+        return 0;
+    return nowMs - pendingSinceMs; // Unsigned math handles millis() rollover
+}
+
+// ===================================================================================
+// GestureRecognizer
+// ===================================================================================
+GestureRecognizer::GestureRecognizer(uint16_t debounce, uint16_t doubleClick, uint16_t longPress)
+    : debounceMs(debounce),
+      doubleClickMs(doubleClick),
+      longPressMs(longPress),
+      state(IDLE),
+      level(false),
+      lastEdgeMs(0),
+      stateSinceMs(0)
+{
+}
+
+void GestureRecognizer::begin(bool pressedNow, uint32_t nowMs)
+{
+    level = pressedNow;
+    lastEdgeMs = nowMs;
+    stateSinceMs = nowMs;
+    state = pressedNow ? LONG_HELD : IDLE; // LONG_HELD: the release ends it without a gesture
+}
+
+bool GestureRecognizer::onEdge(bool pressed, uint32_t timeMs, ButtonGesture &gesture, uint32_t &atMs)
+{
+    if (pressed == level)
+        return false; // No level change (e.g. a glitch, or the release of the wake-up press)
+    if (timeMs - lastEdgeMs < debounceMs)
+        return false; // Contact bounce
+
+    // Timeouts that expired before this edge happened come first. At most one
+    // gesture is reported per call, and a timeout never coincides with an edge
+    // that also completes a gesture (timeouts only leave PRESSED / WAIT_SECOND).
+    bool fired = checkTimeouts(timeMs, gesture, atMs);
+    bool firedByEdge = applyEdge(pressed, timeMs, gesture, atMs);
+    return fired || firedByEdge;
+}
+
+bool GestureRecognizer::poll(uint32_t nowMs, bool pressedNow, ButtonGesture &gesture, uint32_t &atMs)
+{
+    if (checkTimeouts(nowMs, gesture, atMs))
+        return true;
+    // Re-sync if the debounce filter swallowed the final edge of a bounce burst
+    if (pressedNow != level && nowMs - lastEdgeMs >= debounceMs)
+        return applyEdge(pressedNow, nowMs, gesture, atMs);
+    return false;
+}
+
+uint32_t GestureRecognizer::msUntilDeadline(uint32_t nowMs) const
+{
+    uint32_t elapsed = nowMs - stateSinceMs;
+    switch (state)
+    {
+    case PRESSED:
+        return (elapsed >= longPressMs) ? 0 : longPressMs - elapsed;
+    case WAIT_SECOND:
+        return (elapsed >= doubleClickMs) ? 0 : doubleClickMs - elapsed;
+    default:
+        return UINT32_MAX;
+    }
+}
+
+bool GestureRecognizer::checkTimeouts(uint32_t nowMs, ButtonGesture &gesture, uint32_t &atMs)
+{
+    uint32_t elapsed = nowMs - stateSinceMs;
+    if (state == PRESSED && elapsed >= longPressMs)
+    {
+        state = LONG_HELD;
+        gesture = GESTURE_LONG_PRESS;
+        atMs = stateSinceMs + longPressMs;
+        return true;
+    }
+    if (state == WAIT_SECOND && elapsed > doubleClickMs)
+    {
+        state = IDLE;
+        gesture = GESTURE_CLICK;
+        atMs = stateSinceMs + doubleClickMs;
+        return true;
+    }
+    return false;
+}
+
+bool GestureRecognizer::applyEdge(bool pressed, uint32_t timeMs, ButtonGesture &gesture, uint32_t &atMs)
+{
+    level = pressed;
+    lastEdgeMs = timeMs;
+
+    switch (state)
+    {
+    case IDLE:
+        if (pressed)
+        {
+            state = PRESSED;
+            stateSinceMs = timeMs;
+        }
+        break;
+    case PRESSED:
+        if (!pressed)
+        {
+            state = WAIT_SECOND;
+            stateSinceMs = timeMs;
+        }
+        break;
+    case WAIT_SECOND:
+        if (pressed)
+            state = SECOND_PRESS;
+        break;
+    case SECOND_PRESS:
+        if (!pressed)
+        {
+            state = IDLE;
+            gesture = GESTURE_DOUBLE_CLICK;
+            atMs = timeMs;
+            return true;
+        }
+        break;
+    case LONG_HELD:
+        if (!pressed)
+            state = IDLE;
+        break;
+    }
+    return false;
+}
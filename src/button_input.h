@@ -0,0 +1,138 @@
+/**
+ * @file button_input.h
+ * @brief Button gesture recognition and gesture -> action mapping.
+ *        GestureRecognizer turns timestamped button edges (queued by the GPIO
+ *        ISR) into click, double-click and long-press gestures. ButtonInput
+ *        maps those to actions; while the display is busy refreshing, the
+ *        latest gesture is held as a pending intent and handed back to loop()
+ *        once the refresh has finished. Plain C++ (no Arduino calls), all times
+ *        are passed in so both state machines run with synthetic timestamps.
+ */
+#pragma once
+
+#include <stdint.h>
+
+// --- Gestures reported by the button layer ---
+enum ButtonGesture
+{
+    GESTURE_CLICK,
+    GESTURE_DOUBLE_CLICK,
+    GESTURE_LONG_PRESS,
+    GESTURE_COUNT // Number of gestures, keep last
+};
+
+// --- Actions a gesture can be mapped to ---
+enum ButtonAction
+{
+    ACTION_NONE,
+    ACTION_NEXT_MODE, // INFO -> QR -> CONTACT_QR -> IMAGE -> BLANK -> INFO
+    ACTION_SHOW_INFO,
+    ACTION_SHOW_QR,
+    ACTION_SHOW_BLANK,
+    ACTION_SHOW_SPLIT, // Info and QR on one screen
+    ACTION_SLEEP, // Stop advertising and enter deep sleep
+    ACTION_COUNT  // Number of actions, keep last
+};
+
+// Gesture -> action table as set with "config:button:" and stored in NVS
+// (one ButtonAction byte per ButtonGesture)
+struct ButtonMapping
+{
+    uint8_t action[GESTURE_COUNT];
+};
+
+// "click=next,double=split,long=sleep": sets the listed gestures (click,
+// double, long) to the named actions (none, next, info, qr, blank, split,
+// sleep). On an unknown name `mapping` is left unchanged and false returned.
+bool parseButtonMapping(const char *text, ButtonMapping &mapping);
+bool buttonMappingValid(const ButtonMapping &mapping);
+
+class ButtonInput
+{
+public:
+    ButtonInput();
+
+    // --- Configuration ---
+    void setAction(ButtonGesture gesture, ButtonAction action);
+    ButtonAction actionFor(ButtonGesture gesture) const;
+    void setMapping(const ButtonMapping &mapping); // Ignored unless buttonMappingValid()
+    ButtonMapping mapping() const;
+
+    // --- Producer side (GestureRecognizer output) ---
+    // Records the mapped action as the pending intent. A newer gesture
+    // replaces an older one that has not been consumed yet (latest wins).
+    void onGesture(ButtonGesture gesture, uint32_t nowMs);
+
+    // Marks the display as busy (refresh running). Intents are held, not handed out.
+    void setBusy(bool busy);
+    bool isBusy() const { return busy; }
+
+    // --- Consumer side (loop) ---
+    bool hasIntent() const { return pendingAction != ACTION_NONE; }
+    // Returns the pending action and clears it, or ACTION_NONE while busy / idle.
+    ButtonAction takeIntent();
+
+    // --- Diagnostics ---
+    uint32_t intentAgeMs(uint32_t nowMs) const; // Age of the pending intent (0 if none)
+    uint16_t queuedWhileBusy() const { return queuedWhileBusyCount; }
+    uint16_t superseded() const { return supersededCount; }
+
+private:
+    ButtonAction actionMap[GESTURE_COUNT];
+    ButtonAction pendingAction;
+    uint32_t pendingSinceMs;
+    bool busy;
+    uint16_t queuedWhileBusyCount; // Gestures that arrived during a refresh
+    uint16_t supersededCount;      // Pending intents replaced by a newer one
+};
+
+// Turns debounced press/release edges into gestures. Each call reports at most
+// one gesture through `gesture`/`atMs` and returns true if it did.
+class GestureRecognizer
+{
+public:
+    GestureRecognizer(uint16_t debounceMs = 30, uint16_t doubleClickMs = 300, uint16_t longPressMs = 1000);
+
+    // Feed one edge, in the order they happened. Bounces within the debounce
+    // window and edges that do not change the level are ignored.
+    bool onEdge(bool pressed, uint32_t timeMs, ButtonGesture &gesture, uint32_t &atMs);
+
+    // Advance time without an edge (fires pending click / long-press timeouts).
+    // `pressedNow` is the raw pin level; it re-syncs the state if an edge was
+    // swallowed by the debounce filter.
+    bool poll(uint32_t nowMs, bool pressedNow, ButtonGesture &gesture, uint32_t &atMs);
+
+    // Starts from the current pin level. A button already down (the press
+    // that woke the chip) is ignored until it has been released.
+    void begin(bool pressedNow, uint32_t nowMs);
+
+    // Milliseconds until the next timeout needs a poll(), or UINT32_MAX when idle.
+    uint32_t msUntilDeadline(uint32_t nowMs) const;
+
+    // Button up, and no edge for the debounce time. A long-press fires while
+    // the button is still down, so this is what deep sleep waits for.
+    bool isReleased(uint32_t nowMs) const { return !level && nowMs - lastEdgeMs >= debounceMs; }
+
+    bool isIdle() const { return state == IDLE; }
+
+private:
+    enum State
+    {
+        IDLE,
+        PRESSED,       // First press down, waiting for release or long-press
+        WAIT_SECOND,   // Released once, waiting for a second press
+        SECOND_PRESS,  // Second press down, gesture completes on release
+        LONG_HELD      // Long-press already reported (or down since begin()), waiting for release
+    };
+
+    bool checkTimeouts(uint32_t nowMs, ButtonGesture &gesture, uint32_t &atMs);
+    bool applyEdge(bool pressed, uint32_t timeMs, ButtonGesture &gesture, uint32_t &atMs);
+
+    uint16_t debounceMs;
+    uint16_t doubleClickMs;
+    uint16_t longPressMs;
+    State state;
+    bool level;            // Debounced level
+    uint32_t lastEdgeMs;   // Time of the last accepted edge
+    uint32_t stateSinceMs; // Press start (PRESSED) or release time (WAIT_SECOND)
+};
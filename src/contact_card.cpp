@@ -0,0 +1,185 @@
+/**
+ * @file contact_card.cpp
+ * @brief MeCard from the personal info lines (see contact_card.h).
+ */
+#include "contact_card.h"
+
+#include <string.h>
+
+enum LineKind : uint8_t
+{
+    LINE_TEL,
+    LINE_EMAIL,
+    LINE_URL,
+    LINE_NOTE
+};
+
+struct CardWriter
+{
+    char *out;
+    uint16_t size;
+    uint16_t length;
+    bool overflow;
+};
+
+static void put(CardWriter &w, char c)
+{
+    if (w.length + 1 < w.size)
+        w.out[w.length++] = c;
+    else
+        w.overflow = true;
+}
+
+static void putText(CardWriter &w, const char *text)
+{
+    while (*text)
+        put(w, *text++);
+}
+
+// MeCard reserves '\', ';', ',' and ':' in values
+static void putEscaped(CardWriter &w, const char *value, uint16_t length)
+{
+    for (uint16_t i = 0; i < length; i++)
+    {
+        if (strchr("\\;,:", value[i]) != nullptr)
+            put(w, '\\');
+        put(w, value[i]);
+    }
+}
+
+static bool startsWithNoCase(const char *line, uint16_t length, const char *prefix)
+{
+    uint16_t n = strlen(prefix);
+    if (length < n)
+        return false;
+    for (uint16_t i = 0; i < n; i++)
+        if ((line[i] | 0x20) != prefix[i])
+            return false;
+    return true;
+}
+
+static LineKind classify(const char *line, uint16_t length)
+{
+    const char *at = (const char *)memchr(line, '@', length);
+    if (at != nullptr && memchr(line, ' ', length) == nullptr &&
+        memchr(at, '.', length - (at - line)) != nullptr)
+        return LINE_EMAIL;
+    if (startsWithNoCase(line, length, "http://") || startsWithNoCase(line, length, "https://") ||
+        startsWithNoCase(line, length, "www."))
+        return LINE_URL;
+    uint16_t digits = 0;
+    for (uint16_t i = 0; i < length; i++)
+    {
+        if (line[i] >= '0' && line[i] <= '9')
+            digits++;
+        else if (strchr("+-(). /", line[i]) == nullptr)
+            return LINE_NOTE;
+    }
+    return digits >= 5 ? LINE_TEL : LINE_NOTE;
+}
+
+// Next line of `info` without surrounding blanks; false at the end
+static bool nextLine(const char *info, uint16_t length, uint16_t &pos, const char *&line, uint16_t &lineLength)
+{
+    while (pos < length && info[pos] != '\0')
+    {
+        uint16_t start = pos;
+        while (pos < length && info[pos] != '\0' && info[pos] != '\n')
+            pos++;
+        uint16_t end = pos;
+        if (pos < length && info[pos] == '\n')
+            pos++;
+        while (start < end && (info[start] == ' ' || info[start] == '\t' || info[start] == '\r'))
+            start++;
+        while (end > start && (info[end - 1] == ' ' || info[end - 1] == '\t' || info[end - 1] == '\r'))
+            end--;
+        if (end > start)
+        {
+            line = info + start;
+            lineLength = end - start;
+            return true;
+        }
+    }
+    return false;
+}
+
+// One field per matching line after the name; NOTE lines are joined into one field
+static void putFields(CardWriter &w, const char *info, uint16_t length, LineKind kind, const char *tag)
+{
+    uint16_t pos = 0;
+    const char *line;
+    uint16_t lineLength;
+    bool first = true;
+    bool name = true;
+    while (nextLine(info, length, pos, line, lineLength))
+    {
+        if (name || classify(line, lineLength) != kind)
+        {
+            name = false;
+            continue;
+        }
+        if (kind != LINE_NOTE || first)
+            putText(w, tag);
+        else
+            putText(w, "\\, ");
+        if (kind == LINE_TEL)
+        {
+            if (line[0] == '+')
+                put(w, '+');
+            for (uint16_t i = 0; i < lineLength; i++)
+                if (line[i] >= '0' && line[i] <= '9')
+                    put(w, line[i]);
+        }
+        else
+            putEscaped(w, line, lineLength);
+        if (kind != LINE_NOTE)
+            put(w, ';');
+        first = false;
+    }
+    if (kind == LINE_NOTE && !first)
+        put(w, ';');
+}
+
+uint16_t buildContactCard(const char *info, uint16_t length, char *out, uint16_t outSize, uint8_t fields)
+{
+    if (info == nullptr || out == nullptr || outSize == 0)
+        return 0;
+    out[0] = '\0';
+    uint16_t pos = 0;
+    const char *name;
+    uint16_t nameLength;
+    if (!nextLine(info, length, pos, name, nameLength))
+        return 0;
+
+    CardWriter w = {out, outSize, 0, false};
+    putText(w, "MECARD:N:");
+    putEscaped(w, name, nameLength);
+    put(w, ';');
+    if (fields & CONTACT_TEL)
+        putFields(w, info, length, LINE_TEL, "TEL:");
+    if (fields & CONTACT_EMAIL)
+        putFields(w, info, length, LINE_EMAIL, "EMAIL:");
+    if (fields & CONTACT_URL)
+        putFields(w, info, length, LINE_URL, "URL:");
+    if (fields & CONTACT_NOTE)
+        putFields(w, info, length, LINE_NOTE, "NOTE:");
+    put(w, ';');
+    if (w.overflow)
+    {
+        out[0] = '\0';
+        return 0;
+    }
+    out[w.length] = '\0';
+    return w.length;
+}
+
+bool encodeContactCard(QrCode &code, const char *info, uint16_t length, uint8_t maxVersion, char *text,
+                       uint16_t textSize)
+{
+    const uint8_t attempts[] = {CONTACT_ALL, CONTACT_ALL & ~CONTACT_NOTE, CONTACT_TEL | CONTACT_EMAIL};
+    for (uint8_t fields : attempts)
+        if (buildContactCard(info, length, text, textSize, fields) > 0 &&
+            qrEncodeTextBestEcc(code, text, maxVersion))
+            return true;
+    return false;
+}
@@ -0,0 +1,38 @@
+/**
+ * @file contact_card.h
+ * @brief MeCard contact text built from the personal info lines, for the
+ *        CONTACT_QR screen. The first line is the name; the other lines are
+ *        sorted by what they look like: e-mail address, phone number (reduced
+ *        to '+' and digits, so it encodes as a numeric segment), web address,
+ *        or free text (title, company) that goes into NOTE. MeCard is used
+ *        instead of vCard: "MECARD:N:..;TEL:..;;" needs no BEGIN / VERSION /
+ *        END lines, which keeps the code a version or two smaller, and phone
+ *        cameras read it as a contact. Plain C++ (no Arduino calls).
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "qr_encoder.h"
+
+// Fields that can be left out of the card to make it fit (the name always stays)
+enum ContactField : uint8_t
+{
+    CONTACT_TEL = 0x01,
+    CONTACT_EMAIL = 0x02,
+    CONTACT_URL = 0x04,
+    CONTACT_NOTE = 0x08,
+    CONTACT_ALL = 0x0F
+};
+
+// Writes the MeCard for `info` (lines separated by '\n', at most `length`
+// characters) into `out`, NUL terminated. Returns its length, or 0 if there is
+// no name or the card does not fit outSize.
+uint16_t buildContactCard(const char *info, uint16_t length, char *out, uint16_t outSize,
+                          uint8_t fields = CONTACT_ALL);
+
+// Builds the card and encodes it with qrEncodeTextBestEcc(), dropping NOTE,
+// then URL, if the whole card does not fit maxVersion. `text` receives the
+// card that was encoded. Returns false if not even name, phone and e-mail fit.
+bool encodeContactCard(QrCode &code, const char *info, uint16_t length, uint8_t maxVersion, char *text,
+                       uint16_t textSize);
@@ -0,0 +1,104 @@
+/**
+ * @file display_list.cpp
+ * @brief Display list recording and band replay (see display_list.h).
+ */
+#include "display_list.h"
+
+#include "text_layout.h"
+
+DisplayList::DisplayList() : count(0), overflow(false) {}
+
+void DisplayList::clear()
+{
+    count = 0;
+    overflow = false;
+}
+
+DrawOp *DisplayList::append(DrawOpType type, bool black)
+{
+    if (count == DISPLAY_LIST_MAX_OPS)
+    {
+        overflow = true;
+        return nullptr;
+    }
+    DrawOp *op = &ops[count++];
+    op->type = type;
+    op->black = black;
+    return op;
+}
+
+bool DisplayList::addGlyphs(const GFXfont *font, int16_t x, int16_t baselineY, const char *text, uint16_t length,
+                            bool black)
+{
+    DrawOp *op = append(OP_GLYPHS, black);
+    if (op == nullptr)
+        return false;
+    op->x = x;
+    op->y = baselineY;
+    op->glyphs.font = font;
+    op->glyphs.text = text;
+    op->glyphs.length = length;
+
+    // Ink box, measured once here instead of on every band
+    int16_t x1, y1;
+    measureText(font, text, length, &x1, &y1, &op->boxW, &op->boxH);
+    op->boxX = x + x1;
+    op->boxY = baselineY + y1;
+    return true;
+}
+
+bool DisplayList::addRect(int16_t x, int16_t y, uint16_t w, uint16_t h, bool black)
+{
+    DrawOp *op = append(OP_FILL_RECT, black);
+    if (op == nullptr)
+        return false;
+    op->x = op->boxX = x;
+    op->y = op->boxY = y;
+    op->rect.w = op->boxW = w;
+    op->rect.h = op->boxH = h;
+    return true;
+}
+
+bool DisplayList::addBitmap(int16_t x, int16_t y, const uint8_t *bits, uint16_t w, uint16_t h, uint8_t scale,
+                            bool black, uint16_t rowBits)
+{
+    DrawOp *op = append(OP_BITMAP, black);
+    if (op == nullptr)
+        return false;
+    op->x = op->boxX = x;
+    op->y = op->boxY = y;
+    op->bitmap.bits = bits;
+    op->bitmap.w = w;
+    op->bitmap.h = h;
+    op->bitmap.rowBits = rowBits;
+    op->bitmap.scale = scale;
+    op->boxW = w * scale;
+    op->boxH = h * scale;
+    return true;
+}
+
+uint8_t DisplayList::replay(PackedFrame &frame) const
+{
+    uint8_t executed = 0;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const DrawOp &op = ops[i];
+        if (!frameBandIntersects(frame, op.boxX, op.boxY, op.boxW, op.boxH))
+            continue; // Nothing of it in this band
+        switch (op.type)
+        {
+        case OP_GLYPHS:
+            blitText(frame, op.glyphs.font, op.x, op.y, op.glyphs.text, op.glyphs.length, op.black);
+            break;
+        case OP_FILL_RECT:
+            frameFillRect(frame, op.x, op.y, op.rect.w, op.rect.h, op.black);
+            break;
+        case OP_BITMAP:
+            blitBitmap(frame, op.x, op.y, op.bitmap.bits, op.bitmap.w, op.bitmap.h, op.bitmap.scale, op.black,
+                       op.bitmap.rowBits);
+            break;
+        }
+        executed++;
+    }
+    return executed;
+}
@@ -0,0 +1,86 @@
+/**
+ * @file display_list.h
+ * @brief Retained-mode display list for one screen.
+ *        A paged GxEPD2 buffer holds only a band of the panel, so the screen
+ *        is drawn once per band. Recording the screen as a few draw ops (glyph
+ *        runs, filled rectangles, packed bitmaps) does the mode switch, layout
+ *        lookups and QR encoding once per frame; replaying a band then only
+ *        runs the ops whose bounding box reaches into it.
+ *        Ops point at text and bitmap data owned by the caller, which must
+ *        stay unchanged until the last replay.
+ *        Plain C++ (no Arduino calls) so it can be checked on the host.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <gfxfont.h>
+
+#include "glyph_blit.h"
+
+const uint8_t DISPLAY_LIST_MAX_OPS = 24; // Info lines + QR + status texts fit easily
+
+enum DrawOpType : uint8_t
+{
+    OP_GLYPHS,    // Text run at a cursor position
+    OP_FILL_RECT, // Solid rectangle
+    OP_BITMAP     // Packed bitmap, each bit a scale x scale square
+};
+
+struct DrawOp
+{
+    DrawOpType type;
+    bool black;
+    int16_t x, y;       // Glyphs: cursor (baseline); others: top-left
+    int16_t boxX, boxY; // Logical bounding box, for band culling
+    uint16_t boxW, boxH;
+    union
+    {
+        struct
+        {
+            const GFXfont *font;
+            const char *text;
+            uint16_t length;
+        } glyphs;
+        struct
+        {
+            uint16_t w, h;
+        } rect;
+        struct
+        {
+            const uint8_t *bits;
+            uint16_t w, h;    // In bits
+            uint16_t rowBits; // Row start to row start (0 = w)
+            uint8_t scale;
+        } bitmap;
+    };
+};
+
+class DisplayList
+{
+public:
+    DisplayList();
+
+    void clear();
+
+    // Each returns false (and marks the list overflowed) if it is full
+    bool addGlyphs(const GFXfont *font, int16_t x, int16_t baselineY, const char *text, uint16_t length,
+                   bool black = true);
+    bool addRect(int16_t x, int16_t y, uint16_t w, uint16_t h, bool black = true);
+    bool addBitmap(int16_t x, int16_t y, const uint8_t *bits, uint16_t w, uint16_t h, uint8_t scale,
+                   bool black = true, uint16_t rowBits = 0);
+
+    // Runs the ops that intersect the frame's band, in recording order.
+    // Returns the number executed.
+    uint8_t replay(PackedFrame &frame) const;
+
+    uint8_t size() const { return count; }
+    bool overflowed() const { return overflow; }
+    const DrawOp &op(uint8_t i) const { return ops[i]; }
+
+private:
+    DrawOp *append(DrawOpType type, bool black);
+
+    DrawOp ops[DISPLAY_LIST_MAX_OPS];
+    uint8_t count;
+    bool overflow;
+};
@@ -0,0 +1,65 @@
+/**
+ * @file edge_queue.h
+ * @brief Lock-free single-producer / single-consumer ring buffer.
+ *        Used to hand timestamped button edges from the GPIO ISR (producer)
+ *        to loop() (consumer). The producer only writes `head`, the consumer
+ *        only writes `tail`, so no lock or critical section is needed.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+// One button edge as seen by the ISR
+struct ButtonEdge
+{
+    uint32_t timeMs; // millis() when the edge was seen
+    bool pressed;    // Level after the edge (true = button down)
+};
+
+template <typename T, uint16_t CAPACITY>
+class EdgeQueue
+{
+    static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+public:
+    EdgeQueue() : head(0), tail(0), dropped(0) {}
+
+    // Producer side (ISR). Returns false and counts a drop if the queue is full.
+    // Always inlined: a template instance is placed in flash, not in the IRAM of
+    // the IRAM_ATTR ISR calling it, and would fault while flash cache is off.
+    // The std::atomic operations it uses are always inlined as well.
+    __attribute__((always_inline)) inline bool push(const T &item)
+    {
+        uint16_t h = head.load(std::memory_order_relaxed);
+        uint16_t next = (h + 1) & (CAPACITY - 1);
+        if (next == tail.load(std::memory_order_acquire))
+        {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        items[h] = item;
+        head.store(next, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side (loop). Returns false if the queue is empty.
+    bool pop(T &item)
+    {
+        uint16_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire))
+            return false;
+        item = items[t];
+        tail.store((t + 1) & (CAPACITY - 1), std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const { return tail.load(std::memory_order_acquire) == head.load(std::memory_order_acquire); }
+    uint32_t droppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    T items[CAPACITY];
+    std::atomic<uint16_t> head;
+    std::atomic<uint16_t> tail;
+    std::atomic<uint32_t> dropped;
+};
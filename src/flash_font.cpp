@@ -0,0 +1,293 @@
+/**
+ * @file flash_font.cpp
+ * @brief UTF-8 decoding, slot transcoding and the flash font glyph cache (see flash_font.h).
+ */
+#include "flash_font.h"
+
+#include <string.h>
+
+static const uint8_t HEADER_SIZE = 20;
+static const uint8_t ENTRY_SIZE = 16;
+static const uint8_t GLYPH_FIRST = 0x20;
+
+static uint32_t readU32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// ===================================================================================
+// UTF-8
+// ===================================================================================
+uint32_t utf8Next(const char *text, uint16_t length, uint16_t &pos)
+{
+    uint8_t lead = (uint8_t)text[pos];
+    uint8_t extra;
+    uint32_t cp;
+    if (lead < 0x80)
+    {
+        pos++;
+        return lead;
+    }
+    else if ((lead & 0xE0) == 0xC0)
+    {
+        extra = 1;
+        cp = lead & 0x1F;
+    }
+    else if ((lead & 0xF0) == 0xE0)
+    {
+        extra = 2;
+        cp = lead & 0x0F;
+    }
+    else if ((lead & 0xF8) == 0xF0)
+    {
+        extra = 3;
+        cp = lead & 0x07;
+    }
+    else
+    {
+        pos++; // Stray continuation byte or invalid lead
+        return UNICODE_REPLACEMENT;
+    }
+
+    if ((uint32_t)pos + extra >= length)
+    {
+        // Cut off by the end of the text (e.g. truncated to the length limit)
+        for (uint16_t i = pos + 1; i < length; i++)
+            if (((uint8_t)text[i] & 0xC0) != 0x80)
+            {
+                pos++;
+                return UNICODE_REPLACEMENT;
+            }
+        pos = length;
+        return 0;
+    }
+    for (uint8_t i = 1; i <= extra; i++)
+    {
+        uint8_t c = (uint8_t)text[pos + i];
+        if ((c & 0xC0) != 0x80)
+        {
+            pos++;
+            return UNICODE_REPLACEMENT;
+        }
+        cp = (cp << 6) | (c & 0x3F);
+    }
+    pos += extra + 1;
+
+    // Overlong forms, surrogates and values past U+10FFFF are not valid UTF-8
+    static const uint32_t MIN_FOR_LENGTH[] = {0, 0x80, 0x800, 0x10000};
+    if (cp < MIN_FOR_LENGTH[extra] || (cp >= 0xD800 && cp <= 0xDFFF) || cp > 0x10FFFF)
+        return UNICODE_REPLACEMENT;
+    return cp;
+}
+
+bool utf8HasNonAscii(const char *text, uint16_t length)
+{
+    for (uint16_t i = 0; i < length; i++)
+        if ((uint8_t)text[i] >= 0x80)
+            return true;
+    return false;
+}
+
+uint16_t transcodeUtf8(const char *utf8, uint16_t length, char *out, uint16_t outSize, SlotMap &map)
+{
+    map.count = 0;
+    uint16_t n = 0;
+    uint16_t pos = 0;
+    while (pos < length && n + 1 < outSize)
+    {
+        uint32_t cp = utf8Next(utf8, length, pos);
+        if (cp == '\n' || (cp >= 0x20 && cp < 0x7F))
+        {
+            out[n++] = (char)cp;
+            continue;
+        }
+        if (cp < 0x80)
+            continue; // Other control characters (and the 0 of a cut-off sequence)
+
+        uint8_t slot = 0;
+        while (slot < map.count && map.codepoint[slot] != cp)
+            slot++;
+        if (slot == map.count)
+        {
+            if (map.count == FLASH_FONT_SLOTS)
+            {
+                out[n++] = '?';
+                continue;
+            }
+            map.codepoint[map.count++] = cp;
+        }
+        out[n++] = (char)(FLASH_FONT_SLOT_FIRST + slot);
+    }
+    out[n] = '\0';
+    return n;
+}
+
+// ===================================================================================
+// FlashFont
+// ===================================================================================
+FlashFont::FlashFont()
+    : fontSource(nullptr),
+      fileGlyphs(0),
+      indexOffset(0),
+      bitmapOffset(0),
+      yAdvance(0),
+      pool(nullptr),
+      poolBytes(0),
+      cached(0),
+      missing(0),
+      dropped(0),
+      reads(0)
+{
+    memset(glyphs, 0, sizeof(glyphs));
+    gfx.bitmap = nullptr;
+    gfx.glyph = glyphs;
+    gfx.first = GLYPH_FIRST;
+    gfx.last = 0xFF;
+    gfx.yAdvance = 0;
+}
+
+bool FlashFont::read(uint32_t offset, void *dst, uint16_t length)
+{
+    reads++;
+    return fontSource->readAt(offset, dst, length);
+}
+
+bool FlashFont::begin(FontSource *source, FlashGlyphPool *pool)
+{
+    fontSource = source;
+    this->pool = pool;
+    uint8_t header[HEADER_SIZE];
+    if (source == nullptr || pool == nullptr || !read(0, header, HEADER_SIZE) ||
+        memcmp(header, "NTF1", 4) != 0 || header[4] != FLASH_FONT_VERSION)
+    {
+        fontSource = nullptr;
+        return false;
+    }
+    yAdvance = header[5];
+    fileGlyphs = readU32(header + 8);
+    indexOffset = readU32(header + 12);
+    bitmapOffset = readU32(header + 16);
+    gfx.bitmap = pool->bytes;
+    gfx.yAdvance = yAdvance;
+    return true;
+}
+
+// Binary search over the sorted index: log2(glyphCount) entry reads
+bool FlashFont::findGlyph(uint32_t codepoint, uint8_t *entry)
+{
+    uint32_t lo = 0, hi = fileGlyphs;
+    while (lo < hi)
+    {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (!read(indexOffset + mid * ENTRY_SIZE, entry, ENTRY_SIZE))
+            return false;
+        uint32_t cp = readU32(entry);
+        if (cp == codepoint)
+            return true;
+        if (cp < codepoint)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return false;
+}
+
+// Expands RLE runs (bit 7 = pixel value, bits 0-6 = run length - 1) into
+// `bits` pixels of Adafruit packing at dst
+static bool expandRuns(const uint8_t *runs, uint16_t runBytes, uint8_t *dst, uint16_t bits)
+{
+    uint16_t out = 0;
+    memset(dst, 0, (bits + 7) / 8);
+    for (uint16_t i = 0; i < runBytes; i++)
+    {
+        uint8_t run = (runs[i] & 0x7F) + 1;
+        if (out + run > bits)
+            return false;
+        if (runs[i] & 0x80)
+            for (uint8_t k = 0; k < run; k++, out++)
+                dst[out >> 3] |= 0x80 >> (out & 7);
+        else
+            out += run;
+    }
+    return out == bits;
+}
+
+bool FlashFont::loadGlyph(uint8_t code, uint32_t codepoint)
+{
+    GFXglyph &glyph = glyphs[code - GLYPH_FIRST];
+    uint8_t entry[ENTRY_SIZE];
+    if (findGlyph(codepoint, entry))
+    {
+        uint16_t pixels = (uint16_t)entry[8] * entry[9];
+        uint16_t bytes = (pixels + 7) / 8;
+        uint32_t offset = bitmapOffset + readU32(entry + 4);
+        bool loaded = false;
+        uint8_t *dst = pool->bytes + pool->used;
+        if (pool->used + bytes <= FLASH_FONT_POOL_SIZE)
+        {
+            if (bytes == 0)
+                loaded = true;
+            else if (entry[13] & FLASH_GLYPH_RLE)
+            {
+                uint8_t runs[FLASH_FONT_MAX_RUN_BYTES];
+                uint16_t runBytes = entry[14] | (entry[15] << 8);
+                loaded = runBytes <= sizeof(runs) && read(offset, runs, runBytes) &&
+                         expandRuns(runs, runBytes, dst, pixels);
+            }
+            else
+                loaded = read(offset, dst, bytes);
+        }
+        if (loaded)
+        {
+            glyph.bitmapOffset = pool->used;
+            glyph.width = entry[8];
+            glyph.height = entry[9];
+            glyph.xAdvance = entry[10];
+            glyph.xOffset = (int8_t)entry[11];
+            glyph.yOffset = (int8_t)entry[12];
+            pool->used += bytes;
+            poolBytes += bytes;
+            cached++;
+            return true;
+        }
+        dropped++;
+    }
+    else
+        missing++;
+
+    // Missing (or no room): keep the text flowing with a blank one space wide
+    glyph.bitmapOffset = 0;
+    glyph.width = 0;
+    glyph.height = 0;
+    glyph.xAdvance = yAdvance / 4;
+    glyph.xOffset = 0;
+    glyph.yOffset = 0;
+    return false;
+}
+
+void FlashFont::load(const char *text, uint16_t length, const SlotMap &map)
+{
+    memset(glyphs, 0, sizeof(glyphs));
+    poolBytes = 0;
+    cached = 0;
+    missing = 0;
+    dropped = 0;
+    if (fontSource == nullptr)
+        return;
+
+    bool used[0x7F - GLYPH_FIRST] = {false};
+    used['A' - GLYPH_FIRST] = used['j' - GLYPH_FIRST] = true; // Line metrics (text_layout fontMetrics())
+    loadGlyph('A', 'A');
+    loadGlyph('j', 'j');
+    for (uint16_t i = 0; i < length; i++)
+    {
+        uint8_t c = (uint8_t)text[i];
+        if (c >= GLYPH_FIRST && c < 0x7F && !used[c - GLYPH_FIRST])
+        {
+            used[c - GLYPH_FIRST] = true;
+            loadGlyph(c, c);
+        }
+    }
+    for (uint8_t slot = 0; slot < map.count; slot++)
+        loadGlyph(FLASH_FONT_SLOT_FIRST + slot, map.codepoint[slot]);
+}
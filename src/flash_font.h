@@ -0,0 +1,124 @@
+/**
+ * @file flash_font.h
+ * @brief UTF-8 text with Unicode glyphs loaded on demand from a font file.
+ *        The built-in FreeSans fonts only cover 7-bit ASCII. Larger glyph
+ *        sets live in a font file (LittleFS on the device) with a codepoint-
+ *        sorted index, so a lookup is a binary search over fixed-size entries.
+ *
+ *        Content is first transcoded to 8-bit codes: printable ASCII and '\n'
+ *        keep their value, each distinct non-ASCII codepoint gets a slot code
+ *        0x80 + n (SlotMap). A FlashFont then loads just the glyphs that text
+ *        uses into a small RAM cache that is itself a GFXfont (first 0x20, last
+ *        0xFF), so text_layout and glyph_blit work on it unchanged. The glyph
+ *        bitmaps of all font sizes go into one FlashGlyphPool: a short text
+ *        needs a few hundred bytes per size, so one pool is enough for all.
+ *
+ *        Font file (".ntf", little-endian):
+ *          header, 20 bytes:  "NTF1", u8 version, u8 yAdvance, u16 flags
+ *                             (bit 0: some glyphs are RLE), u32 glyphCount,
+ *                             u32 indexOffset, u32 bitmapOffset
+ *          index, 16 bytes per glyph, sorted by codepoint:
+ *                             u32 codepoint, u32 bitmap offset (from bitmapOffset),
+ *                             u8 width, u8 height, u8 xAdvance, s8 xOffset,
+ *                             s8 yOffset, u8 flags (FLASH_GLYPH_RLE),
+ *                             u16 stored bytes (RLE glyphs)
+ *          bitmaps:           Adafruit GFX packing (rows MSB first, no padding),
+ *                             or RLE runs over that bit stream: one byte per
+ *                             run, bit 7 = pixel value, bits 0-6 = length - 1
+ *        Files are built by tools/font_subset.py.
+ *        Plain C++ (no Arduino calls); the file is read through FontSource.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <gfxfont.h>
+
+const uint8_t FLASH_FONT_VERSION = 1;
+const uint8_t FLASH_FONT_SLOT_FIRST = 0x80; // Codes 0x80..0xFF are non-ASCII slots
+const uint8_t FLASH_FONT_SLOTS = 128;
+const uint16_t FLASH_FONT_POOL_SIZE = 6144; // Glyph bitmap bytes shared by all fonts of a pool
+const uint16_t FLASH_FONT_MAX_RUN_BYTES = 512; // Largest RLE glyph accepted
+const uint8_t FLASH_GLYPH_RLE = 0x01;         // Index entry flag
+const uint32_t UNICODE_REPLACEMENT = 0xFFFD;
+
+// Random access to a font file
+class FontSource
+{
+public:
+    virtual ~FontSource() {}
+    virtual bool readAt(uint32_t offset, void *dst, uint16_t length) = 0;
+};
+
+// Decodes the codepoint at text[pos] and advances pos. Malformed sequences
+// give UNICODE_REPLACEMENT (one byte consumed); a sequence cut off by the end
+// of the text gives 0 and moves pos to the end.
+uint32_t utf8Next(const char *text, uint16_t length, uint16_t &pos);
+
+bool utf8HasNonAscii(const char *text, uint16_t length);
+
+// Distinct non-ASCII codepoints of a text, in order of first use
+struct SlotMap
+{
+    uint32_t codepoint[FLASH_FONT_SLOTS];
+    uint8_t count;
+};
+
+// UTF-8 -> 8-bit codes (see above). Control characters other than '\n' are
+// dropped; once all slots are used, further new codepoints become '?'.
+// Returns the output length (out is NUL terminated).
+uint16_t transcodeUtf8(const char *utf8, uint16_t length, char *out, uint16_t outSize, SlotMap &map);
+
+// Glyph bitmaps of the FlashFonts loaded for one text
+struct FlashGlyphPool
+{
+    uint8_t bytes[FLASH_FONT_POOL_SIZE];
+    uint16_t used;
+};
+
+class FlashFont
+{
+public:
+    FlashFont();
+
+    // Reads and checks the header; false if there is no valid font. Glyph
+    // bitmaps are cached in `pool`, which may be shared with other fonts.
+    bool begin(FontSource *source, FlashGlyphPool *pool);
+    bool available() const { return fontSource != nullptr; }
+
+    // Drops the cached glyphs and loads the ones used by `text` (8-bit codes
+    // from transcodeUtf8 with `map`) after what the pool already holds; set
+    // pool.used to 0 before loading the fonts of a new text. 'A' and 'j' are
+    // always loaded: text_layout measures the line height on them. Codepoints
+    // missing from the file, or not fitting the pool, get an empty glyph one
+    // space wide.
+    void load(const char *text, uint16_t length, const SlotMap &map);
+
+    const GFXfont *font() const { return &gfx; }
+
+    uint32_t glyphCount() const { return fileGlyphs; }
+    uint16_t cachedGlyphs() const { return cached; }
+    uint16_t missingGlyphs() const { return missing; } // Not in the file
+    uint16_t droppedGlyphs() const { return dropped; } // In the file, but not loaded (no room in the pool)
+    uint16_t poolUsed() const { return poolBytes; } // Bytes of the pool this font took
+    uint32_t fileReads() const { return reads; }
+
+private:
+    bool findGlyph(uint32_t codepoint, uint8_t *entry);
+    bool loadGlyph(uint8_t code, uint32_t codepoint);
+    bool read(uint32_t offset, void *dst, uint16_t length);
+
+    FontSource *fontSource;
+    uint32_t fileGlyphs;
+    uint32_t indexOffset;
+    uint32_t bitmapOffset;
+    uint8_t yAdvance;
+
+    GFXfont gfx;
+    GFXglyph glyphs[0x100 - 0x20];
+    FlashGlyphPool *pool;
+    uint16_t poolBytes;
+    uint16_t cached;
+    uint16_t missing;
+    uint16_t dropped;
+    uint32_t reads;
+};
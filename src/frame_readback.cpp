@@ -0,0 +1,154 @@
+/**
+ * @file frame_readback.cpp
+ * @brief Streaming PackBits encoder for the frame read-back (see frame_readback.h).
+ *        Same output as image_pack.py's packbits(): runs of three or more are
+ *        repeats (up to 128), everything else gathers into literals.
+ */
+#include "frame_readback.h"
+
+#include <string.h>
+
+#include "image_stream.h"
+
+static void putLittleEndian(uint8_t *out, uint32_t value)
+{
+    out[0] = value & 0xFF;
+    out[1] = (value >> 8) & 0xFF;
+    out[2] = (value >> 16) & 0xFF;
+    out[3] = value >> 24;
+}
+
+void FrameReadback::begin(FrameRows *rows, uint16_t stride, uint16_t height)
+{
+    this->rows = rows;
+    this->stride = stride;
+    this->height = height;
+    y = 0;
+    finished = false;
+    done = false;
+    failedFlag = false;
+    crcValue = 0;
+    sentBytes = 0;
+    runCount = 0;
+    literalCount = 0;
+    pendingCount = 0;
+}
+
+void FrameReadback::emit(uint8_t value)
+{
+    pending[pendingCount++] = value;
+}
+
+void FrameReadback::flushLiteral()
+{
+    if (literalCount == 0)
+        return;
+    emit(literalCount - 1);
+    memcpy(pending + pendingCount, literal, literalCount);
+    pendingCount += literalCount;
+    literalCount = 0;
+}
+
+void FrameReadback::settleRun()
+{
+    if (runCount >= 3)
+    {
+        flushLiteral();
+        emit(257 - runCount);
+        emit(runValue);
+    }
+    else
+    {
+        for (uint8_t i = 0; i < runCount; i++)
+        {
+            literal[literalCount++] = runValue;
+            if (literalCount == sizeof(literal))
+                flushLiteral();
+        }
+    }
+    runCount = 0;
+}
+
+void FrameReadback::push(uint8_t value)
+{
+    if (runCount > 0 && value == runValue && runCount < 128)
+    {
+        runCount++;
+        return;
+    }
+    settleRun();
+    runValue = value;
+    runCount = 1;
+}
+
+bool FrameReadback::feedRow()
+{
+    const uint8_t *row = rows->readRow(y);
+    if (row == nullptr)
+    {
+        failedFlag = true;
+        return false;
+    }
+    crcValue = imageCrc32(row, stride, crcValue);
+    for (uint16_t i = 0; i < stride; i++)
+        push(row[i]);
+    if (++y == height)
+    {
+        settleRun();
+        flushLiteral();
+        finished = true;
+    }
+    return true;
+}
+
+uint16_t FrameReadback::next(uint8_t *out, uint16_t maxData)
+{
+    if (done)
+        return 0;
+    if (maxData > FRAME_CHUNK_MAX)
+        maxData = FRAME_CHUNK_MAX;
+    // One row adds at most a flushed literal (129 bytes) plus a row's worth
+    while (!finished && pendingCount < maxData)
+    {
+        if (!feedRow())
+        {
+            // End record without the checksum: the frame could not be read
+            done = true;
+            putLittleEndian(out, FRAME_END_OFFSET);
+            return 4;
+        }
+    }
+
+    uint32_t offset = sentBytes;
+    uint16_t count = pendingCount < maxData ? pendingCount : maxData;
+    if (count == 0)
+    {
+        // Everything sent: close with the checksum and size
+        offset = FRAME_END_OFFSET;
+        putLittleEndian(out + 4, crcValue);
+        putLittleEndian(out + 8, sentBytes);
+        count = 8;
+        done = true;
+    }
+    else
+    {
+        memcpy(out + 4, pending, count);
+        pendingCount -= count;
+        memmove(pending, pending + count, pendingCount);
+        sentBytes += count;
+    }
+    putLittleEndian(out, offset);
+    return 4 + count;
+}
+
+bool FrameReadback::summarize(FrameRows *rows, uint16_t stride, uint16_t height, uint32_t &crc, uint32_t &bytes)
+{
+    FrameReadback readback;
+    uint8_t chunk[4 + 64]; // Chunk size does not change the result
+    readback.begin(rows, stride, height);
+    while (readback.next(chunk, 64) > 0)
+        ;
+    crc = readback.crc();
+    bytes = readback.sent();
+    return !readback.failed();
+}
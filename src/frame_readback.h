@@ -0,0 +1,71 @@
+/**
+ * @file frame_readback.h
+ * @brief The frame on the panel, sent back over BLE for app previews and
+ *        fleet checks. Rows come from wherever the badge keeps the frame
+ *        (FrameRows, see main.cpp) and are PackBits compressed as they are
+ *        read, in the same native layout and codec as "image:begin:rle"
+ *        uploads, so the app decodes both the same way. Each chunk is
+ *        <offset, uint32 little endian><up to maxData bytes>; a last record
+ *        with offset FRAME_END_OFFSET carries <crc32><compressed bytes>
+ *        (both uint32 little endian), the CRC-32 of the decoded frame being
+ *        the value image:end: is checked against; without them if a row
+ *        could not be read. Nothing but the current chunk and
+ *        one pending literal run is buffered. Plain C++ (no Arduino calls)
+ *        so it can be checked on the host.
+ */
+#pragma once
+
+#include <stdint.h>
+
+const uint16_t FRAME_CHUNK_MAX = 508;            // Data bytes per chunk (ATT MTU 515 and up)
+const uint32_t FRAME_END_OFFSET = 0xFFFFFFFF;    // Offset of the closing record
+
+// Where the frame is read from, one native row at a time, top to bottom
+class FrameRows
+{
+public:
+    // Row y (stride bytes), valid until the next call; nullptr if it cannot be read
+    virtual const uint8_t *readRow(uint16_t y) = 0;
+};
+
+class FrameReadback
+{
+public:
+    void begin(FrameRows *rows, uint16_t stride, uint16_t height);
+
+    // Writes the next record to `out` (room for 4 + maxData bytes; maxData
+    // from 8 to FRAME_CHUNK_MAX) and returns its length; 0 once the end record
+    // was sent.
+    uint16_t next(uint8_t *out, uint16_t maxData);
+
+    bool failed() const { return failedFlag; }
+    uint32_t crc() const { return crcValue; }  // Of the rows read so far
+    uint32_t sent() const { return sentBytes; } // Compressed bytes so far
+
+    // CRC-32 and compressed size of the whole frame, without sending it
+    static bool summarize(FrameRows *rows, uint16_t stride, uint16_t height, uint32_t &crc, uint32_t &bytes);
+
+private:
+    void push(uint8_t value);
+    void settleRun();
+    void flushLiteral();
+    void emit(uint8_t value);
+    bool feedRow();
+
+    FrameRows *rows;
+    uint16_t stride;
+    uint16_t height;
+    uint16_t y;
+    bool finished; // All rows pushed and the encoder flushed
+    bool done;     // End record sent
+    bool failedFlag;
+    uint32_t crcValue;
+    uint32_t sentBytes;
+    // PackBits state: a run of runValue being counted, literals waiting for a header
+    uint8_t runValue;
+    uint8_t runCount;
+    uint8_t literal[128];
+    uint8_t literalCount;
+    uint8_t pending[FRAME_CHUNK_MAX + 2 * 130]; // Encoded bytes not sent yet
+    uint16_t pendingCount;
+};
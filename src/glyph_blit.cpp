@@ -0,0 +1,365 @@
+/**
+ * @file glyph_blit.cpp
+ * @brief Packed glyph blitter (see glyph_blit.h).
+ */
+#include "glyph_blit.h"
+
+#include <string.h>
+
+static const uint8_t MAX_LINE_BITS = 64; // Glyph lines are gathered into a uint64_t
+
+static uint32_t fastGlyphs = 0;
+static uint32_t fallbackGlyphs = 0;
+
+PackedFrame packedFrame(uint8_t *buffer, uint16_t stride, int16_t nativeW, int16_t nativeH, uint8_t rotation)
+{
+    PackedFrame frame;
+    frame.buffer = buffer;
+    frame.stride = stride;
+    frame.nativeW = nativeW;
+    frame.nativeH = nativeH;
+    frame.rotation = rotation & 3;
+    frame.bandY = 0;
+    frame.bandH = nativeH;
+    return frame;
+}
+
+int16_t frameWidth(const PackedFrame &frame)
+{
+    return (frame.rotation & 1) ? frame.nativeH : frame.nativeW;
+}
+
+int16_t frameHeight(const PackedFrame &frame)
+{
+    return (frame.rotation & 1) ? frame.nativeW : frame.nativeH;
+}
+
+void frameFill(PackedFrame &frame, bool black)
+{
+    memset(frame.buffer, black ? 0x00 : 0xFF, (size_t)frame.stride * frame.bandH);
+}
+
+void framePixel(PackedFrame &frame, int16_t x, int16_t y, bool black)
+{
+    if (x < 0 || x >= frameWidth(frame) || y < 0 || y >= frameHeight(frame))
+        return;
+    int16_t t;
+    switch (frame.rotation)
+    {
+    case 1:
+        t = x;
+        x = frame.nativeW - y - 1;
+        y = t;
+        break;
+    case 2:
+        x = frame.nativeW - x - 1;
+        y = frame.nativeH - y - 1;
+        break;
+    case 3:
+        t = x;
+        x = y;
+        y = frame.nativeH - t - 1;
+        break;
+    }
+    y -= frame.bandY;
+    if (y < 0 || y >= frame.bandH)
+        return;
+    uint8_t &byte = frame.buffer[x / 8 + y * frame.stride];
+    uint8_t bit = 0x80 >> (x & 7);
+    if (black)
+        byte &= ~bit;
+    else
+        byte |= bit;
+}
+
+// Masks `length` pixels (MSB of `value` first) into a native row starting at column nx
+static void writeSpan(uint8_t *row, int16_t nx, uint8_t length, uint64_t value, bool black)
+{
+    uint8_t *dst = row + (nx >> 3);
+    uint8_t offset = nx & 7;
+    uint8_t remaining = length;
+    while (remaining > 0)
+    {
+        uint8_t take = 8 - offset;
+        if (take > remaining)
+            take = remaining;
+        uint8_t chunk = (uint8_t)((value >> (remaining - take)) & ((1u << take) - 1));
+        uint8_t mask = (uint8_t)(chunk << (8 - offset - take));
+        if (black)
+            *dst &= ~mask;
+        else
+            *dst |= mask;
+        remaining -= take;
+        offset = 0;
+        dst++;
+    }
+}
+
+// Same bit walk as Adafruit_GFX::drawChar(), one pixel at a time
+static void drawGlyphPixels(PackedFrame &frame, const GFXfont *font, const GFXglyph *glyph,
+                            int16_t x0, int16_t y0, bool black)
+{
+    const uint8_t *bitmap = font->bitmap + glyph->bitmapOffset;
+    uint8_t bits = 0;
+    uint16_t bit = 0;
+    for (uint8_t r = 0; r < glyph->height; r++)
+    {
+        for (uint8_t c = 0; c < glyph->width; c++, bit++)
+        {
+            if (!(bit & 7))
+                bits = bitmap[bit >> 3];
+            if (bits & 0x80)
+                framePixel(frame, x0 + c, y0 + r, black);
+            bits <<= 1;
+        }
+    }
+}
+
+// Native rows [first, last] covered by a logical rectangle
+static void nativeRows(const PackedFrame &frame, int16_t x, int16_t y, int16_t w, int16_t h,
+                       int16_t &first, int16_t &last)
+{
+    switch (frame.rotation)
+    {
+    case 0:
+        first = y;
+        last = y + h - 1;
+        break;
+    case 1:
+        first = x;
+        last = x + w - 1;
+        break;
+    case 2:
+        first = frame.nativeH - y - h;
+        last = frame.nativeH - y - 1;
+        break;
+    default:
+        first = frame.nativeH - x - w;
+        last = frame.nativeH - x - 1;
+        break;
+    }
+}
+
+bool frameBandIntersects(const PackedFrame &frame, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    if (w <= 0 || h <= 0)
+        return false;
+    int16_t first, last;
+    nativeRows(frame, x, y, w, h, first, last);
+    return last >= frame.bandY && first < frame.bandY + frame.bandH;
+}
+
+// Sets / clears `length` pixels of a native row from column nx
+static void fillSpan(uint8_t *row, int16_t nx, int16_t length, bool black)
+{
+    while (length > 0)
+    {
+        uint8_t offset = nx & 7;
+        if (offset == 0 && length >= 8)
+        {
+            int16_t bytes = length / 8;
+            memset(row + (nx >> 3), black ? 0x00 : 0xFF, bytes);
+            nx += bytes * 8;
+            length -= bytes * 8;
+            continue;
+        }
+        uint8_t take = 8 - offset;
+        if (take > length)
+            take = length;
+        uint8_t mask = (uint8_t)(((1u << take) - 1) << (8 - offset - take));
+        if (black)
+            row[nx >> 3] &= ~mask;
+        else
+            row[nx >> 3] |= mask;
+        nx += take;
+        length -= take;
+    }
+}
+
+void frameFillRect(PackedFrame &frame, int16_t x, int16_t y, int16_t w, int16_t h, bool black)
+{
+    // Clip in logical coordinates, then map the rectangle to native ones
+    int16_t frameW = frameWidth(frame), frameH = frameHeight(frame);
+    if (x < 0)
+    {
+        w += x;
+        x = 0;
+    }
+    if (y < 0)
+    {
+        h += y;
+        y = 0;
+    }
+    if (x + w > frameW)
+        w = frameW - x;
+    if (y + h > frameH)
+        h = frameH - y;
+    if (w <= 0 || h <= 0)
+        return;
+
+    int16_t nx, ny, nw, nh;
+    switch (frame.rotation)
+    {
+    case 0:
+        nx = x, ny = y, nw = w, nh = h;
+        break;
+    case 1:
+        nx = frame.nativeW - y - h, ny = x, nw = h, nh = w;
+        break;
+    case 2:
+        nx = frame.nativeW - x - w, ny = frame.nativeH - y - h, nw = w, nh = h;
+        break;
+    default:
+        nx = y, ny = frame.nativeH - x - w, nw = h, nh = w;
+        break;
+    }
+    int16_t first = (ny > frame.bandY) ? ny : frame.bandY;
+    int16_t last = ny + nh - 1;
+    if (last > frame.bandY + frame.bandH - 1)
+        last = frame.bandY + frame.bandH - 1;
+    for (int16_t row = first; row <= last; row++)
+        fillSpan(frame.buffer + (row - frame.bandY) * frame.stride, nx, nw, black);
+}
+
+void blitBitmap(PackedFrame &frame, int16_t x, int16_t y, const uint8_t *bits,
+                uint16_t w, uint16_t h, uint8_t scale, bool black, uint16_t rowBits)
+{
+    if (rowBits == 0)
+        rowBits = w;
+    for (uint16_t row = 0; row < h; row++)
+    {
+        int16_t top = y + row * scale;
+        if (!frameBandIntersects(frame, x, top, w * scale, scale))
+            continue; // Row of squares outside the band
+        uint32_t bit = (uint32_t)row * rowBits;
+        uint16_t col = 0;
+        while (col < w)
+        {
+            // Runs of set bits become one rectangle
+            if (!(bits[(bit + col) >> 3] & (0x80 >> ((bit + col) & 7))))
+            {
+                col++;
+                continue;
+            }
+            uint16_t start = col;
+            while (col < w && (bits[(bit + col) >> 3] & (0x80 >> ((bit + col) & 7))))
+                col++;
+            frameFillRect(frame, x + start * scale, top, (col - start) * scale, scale, black);
+        }
+    }
+}
+
+static void drawGlyph(PackedFrame &frame, const GFXfont *font, const GFXglyph *glyph,
+                      int16_t x0, int16_t y0, bool black)
+{
+    uint8_t w = glyph->width, h = glyph->height;
+    if (w == 0 || h == 0)
+        return;
+
+    // Native rows the glyph box covers
+    int16_t rowFirst, rowLast;
+    nativeRows(frame, x0, y0, w, h, rowFirst, rowLast);
+
+    if (rowLast < frame.bandY || rowFirst >= frame.bandY + frame.bandH)
+        return; // Not in this band
+    int16_t frameW = frameWidth(frame), frameH = frameHeight(frame);
+    if (x0 >= frameW || y0 >= frameH || x0 + w <= 0 || y0 + h <= 0)
+        return; // Off the frame
+
+    // Lines are native rows, so the band clips whole lines; only glyphs
+    // crossing the frame edge need the per-pixel path
+    bool inside = x0 >= 0 && y0 >= 0 && x0 + w <= frameW && y0 + h <= frameH;
+    if (!inside || w > MAX_LINE_BITS || h > MAX_LINE_BITS)
+    {
+        fallbackGlyphs++;
+        drawGlyphPixels(frame, font, glyph, x0, y0, black);
+        return;
+    }
+    fastGlyphs++;
+
+    // Gather the glyph into native row order: glyph rows for rotation 0/2,
+    // glyph columns for 1/3. Rotations 1/2 run against the native X axis, so
+    // their lines are gathered with the first pixel in the low bit.
+    bool byRows = !(frame.rotation & 1);
+    bool reversed = (frame.rotation == 1 || frame.rotation == 2);
+    uint8_t lineCount = byRows ? h : w;
+    uint8_t lineLength = byRows ? w : h;
+    uint64_t lines[MAX_LINE_BITS];
+    memset(lines, 0, lineCount * sizeof(lines[0]));
+
+    const uint8_t *bitmap = font->bitmap + glyph->bitmapOffset;
+    uint8_t bits = 0;
+    uint16_t bit = 0;
+    for (uint8_t r = 0; r < h; r++)
+    {
+        for (uint8_t c = 0; c < w; c++, bit++)
+        {
+            if (!(bit & 7))
+                bits = bitmap[bit >> 3];
+            uint64_t set = (bits & 0x80) ? 1 : 0;
+            bits <<= 1;
+            uint8_t line = byRows ? r : c;
+            uint8_t pos = byRows ? c : r;
+            if (reversed)
+                lines[line] |= set << pos;
+            else
+                lines[line] = (lines[line] << 1) | set;
+        }
+    }
+
+    for (uint8_t i = 0; i < lineCount; i++)
+    {
+        if (lines[i] == 0)
+            continue;
+        int16_t nativeY, nativeX;
+        switch (frame.rotation)
+        {
+        case 0:
+            nativeY = y0 + i;
+            nativeX = x0;
+            break;
+        case 1:
+            nativeY = x0 + i;
+            nativeX = frame.nativeW - y0 - h;
+            break;
+        case 2:
+            nativeY = frame.nativeH - 1 - (y0 + i);
+            nativeX = frame.nativeW - x0 - w;
+            break;
+        default:
+            nativeY = frame.nativeH - 1 - (x0 + i);
+            nativeX = y0;
+            break;
+        }
+        if (nativeY < frame.bandY || nativeY >= frame.bandY + frame.bandH)
+            continue;
+        writeSpan(frame.buffer + (nativeY - frame.bandY) * frame.stride, nativeX, lineLength, lines[i], black);
+    }
+}
+
+int16_t blitText(PackedFrame &frame, const GFXfont *font, int16_t x, int16_t baselineY,
+                 const char *text, uint16_t length, bool black)
+{
+    if (font == nullptr || text == nullptr)
+        return x;
+    for (uint16_t i = 0; i < length; i++)
+    {
+        uint8_t c = (uint8_t)text[i];
+        if (c < font->first || c > font->last)
+            continue; // Not in the font, print() skips it too
+        const GFXglyph *glyph = &font->glyph[c - font->first];
+        drawGlyph(frame, font, glyph, x + glyph->xOffset, baselineY + glyph->yOffset, black);
+        x += glyph->xAdvance;
+    }
+    return x;
+}
+
+uint32_t blitFastGlyphs()
+{
+    return fastGlyphs;
+}
+
+uint32_t blitFallbackGlyphs()
+{
+    return fallbackGlyphs;
+}
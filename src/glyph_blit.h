@@ -0,0 +1,63 @@
+/**
+ * @file glyph_blit.h
+ * @brief Packed glyph blitter for Adafruit GFX fonts.
+ *        Draws text straight into a 1 bit per pixel frame laid out like the
+ *        GxEPD2 buffer (native panel orientation, MSB first, 1 = white).
+ *        Adafruit_GFX::drawChar() issues one virtual writePixel() per set bit,
+ *        each doing the rotation and bounds checks again; here a glyph is
+ *        gathered into lines (rows for rotation 0/2, columns for 1/3, which
+ *        become native rows) and each line is masked into the frame a byte
+ *        at a time. Glyphs that cross the frame or band edge, or are larger
+ *        than a line word, take the per-pixel path with the same clipping
+ *        GxEPD2_BW::drawPixel() applies, so the output is pixel-identical
+ *        (see tools/blit_check.cpp).
+ *        Plain C++ (no Arduino calls) so it can be checked on the host.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <gfxfont.h>
+
+struct PackedFrame
+{
+    uint8_t *buffer;   // bandH rows of `stride` bytes, native orientation
+    uint16_t stride;   // Bytes per native row (driver WIDTH / 8)
+    int16_t nativeW;   // Visible native width (driver WIDTH_VISIBLE)
+    int16_t nativeH;   // Native height (driver HEIGHT)
+    uint8_t rotation;  // Same meaning as Adafruit_GFX::setRotation()
+    int16_t bandY;     // First native row held in buffer (0 for a full frame)
+    int16_t bandH;     // Native rows held in buffer
+};
+
+// Frame covering the whole panel (bandY = 0, bandH = nativeH)
+PackedFrame packedFrame(uint8_t *buffer, uint16_t stride, int16_t nativeW, int16_t nativeH, uint8_t rotation);
+
+// Logical (rotated) size, like Adafruit_GFX::width() / height()
+int16_t frameWidth(const PackedFrame &frame);
+int16_t frameHeight(const PackedFrame &frame);
+
+void frameFill(PackedFrame &frame, bool black);
+
+// Generic path, same semantics as GxEPD2_BW::drawPixel()
+void framePixel(PackedFrame &frame, int16_t x, int16_t y, bool black);
+
+// Fills a logical rectangle (clipped to the frame and band), like fillRect()
+void frameFillRect(PackedFrame &frame, int16_t x, int16_t y, int16_t w, int16_t h, bool black);
+
+// Draws a packed bitmap (h rows of w bits, MSB first, set = drawn) with each
+// bit as a scale x scale square. Rows start every rowBits bits (0 = w, a
+// plain bit stream; QrCode::rows use rowBytes * 8).
+void blitBitmap(PackedFrame &frame, int16_t x, int16_t y, const uint8_t *bits,
+                uint16_t w, uint16_t h, uint8_t scale, bool black = true, uint16_t rowBits = 0);
+
+// True if any native row of the logical rectangle lies in the frame's band
+bool frameBandIntersects(const PackedFrame &frame, int16_t x, int16_t y, int16_t w, int16_t h);
+
+// Draws `length` characters with the cursor at (x, baselineY), like print()
+// without wrapping. Returns the cursor X after the text.
+int16_t blitText(PackedFrame &frame, const GFXfont *font, int16_t x, int16_t baselineY,
+                 const char *text, uint16_t length, bool black = true);
+
+// Glyphs drawn by the span path / by the per-pixel fallback so far
+uint32_t blitFastGlyphs();
+uint32_t blitFallbackGlyphs();
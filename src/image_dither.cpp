@@ -0,0 +1,97 @@
+/**
+ * @file image_dither.cpp
+ * @brief Streaming grayscale scaling and dithering (see image_dither.h).
+ */
+#include "image_dither.h"
+
+#include <string.h>
+
+static const uint8_t BAYER_8X8[8][8] = {
+    {0, 32, 8, 40, 2, 34, 10, 42},
+    {48, 16, 56, 24, 50, 18, 58, 26},
+    {12, 44, 4, 36, 14, 46, 6, 38},
+    {60, 28, 52, 20, 62, 30, 54, 22},
+    {3, 35, 11, 43, 1, 33, 9, 41},
+    {51, 19, 59, 27, 49, 17, 57, 25},
+    {15, 47, 7, 39, 13, 45, 5, 37},
+    {63, 31, 55, 23, 61, 29, 53, 21},
+};
+
+// Source index sampled by output index `out` (nearest, at the output pixel's center)
+static uint16_t sourceIndex(uint16_t out, uint16_t sourceSize, uint16_t outSize)
+{
+    return (uint16_t)(((2 * (uint32_t)out + 1) * sourceSize) / (2 * (uint32_t)outSize));
+}
+
+bool GrayDither::begin(DitherMethod method, uint16_t sourceWidth, uint16_t sourceHeight, uint16_t outWidth,
+                       uint16_t outHeight)
+{
+    this->method = method;
+    this->sourceWidth = sourceWidth;
+    this->sourceHeight = sourceHeight;
+    this->outWidth = outWidth;
+    this->outHeight = outHeight;
+    sourceX = 0;
+    sourceY = 0;
+    outX = 0;
+    outY = 0;
+    errorRow = 0;
+    memset(errorRows, 0, sizeof(errorRows));
+    return sourceWidth > 0 && sourceHeight > 0 && outWidth > 0 && outWidth <= MAX_WIDTH && outHeight > 0 &&
+           method <= DITHER_ORDERED;
+}
+
+bool GrayDither::add(uint8_t gray)
+{
+    while (outX < outWidth && sourceIndex(outX, sourceWidth, outWidth) == sourceX)
+        row[outX++] = gray;
+    if (++sourceX < sourceWidth)
+        return false;
+    sourceX = 0;
+    outX = 0;
+    sourceY++; // nextRow() works on row sourceY - 1
+    return true;
+}
+
+bool GrayDither::nextRow(uint8_t *packed, uint16_t stride)
+{
+    if (outY >= outHeight || sourceY == 0 || sourceIndex(outY, sourceHeight, outHeight) != sourceY - 1)
+        return false;
+    ditherRow(packed, stride);
+    outY++;
+    return true;
+}
+
+void GrayDither::ditherRow(uint8_t *packed, uint16_t stride)
+{
+    memset(packed, 0xFF, stride);
+    if (method == DITHER_ORDERED)
+    {
+        const uint8_t *thresholds = BAYER_8X8[outY & 7];
+        for (uint16_t x = 0; x < outWidth; x++)
+            if (row[x] < thresholds[x & 7] * 4 + 2)
+                packed[x / 8] &= ~(0x80 >> (x % 8));
+        return;
+    }
+
+    // Floyd-Steinberg, serpentine: odd rows run right to left so errors do not drift one way
+    int16_t *current = errorRows[errorRow] + 1;
+    int16_t *next = errorRows[errorRow ^ 1] + 1;
+    memset(errorRows[errorRow ^ 1], 0, sizeof(errorRows[0]));
+    int8_t step = (outY & 1) ? -1 : 1;
+    int16_t x = (outY & 1) ? outWidth - 1 : 0;
+    for (uint16_t i = 0; i < outWidth; i++, x += step)
+    {
+        int16_t value = row[x] + current[x];
+        int16_t error = value;
+        if (value >= 128)
+            error -= 255;
+        else
+            packed[x / 8] &= ~(0x80 >> (x % 8));
+        current[x + step] += error * 7 / 16;
+        next[x - step] += error * 3 / 16;
+        next[x] += error * 5 / 16;
+        next[x + step] += error / 16;
+    }
+    errorRow ^= 1;
+}
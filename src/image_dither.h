@@ -0,0 +1,60 @@
+/**
+ * @file image_dither.h
+ * @brief 8-bit grayscale rows to packed 1bpp rows, one source row at a time.
+ *        The app sends gray pixels already in the panel's native orientation
+ *        (rows of the 122 px side, see tools/image_pack.py --gray) at any
+ *        size; each pixel is scaled (nearest, sampled at the pixel center)
+ *        into the current output row as it arrives, and every output row
+ *        that maps to a finished source row is dithered and packed in the
+ *        GxEPD2 buffer layout (MSB first, set = white, padding white).
+ *        Floyd-Steinberg (serpentine) keeps two error rows; ordered
+ *        dithering uses an 8x8 Bayer matrix and no state. Nothing else is
+ *        buffered, so RAM stays at sizeof(GrayDither) whatever the source
+ *        size. Plain C++ (no Arduino calls) so it can be checked on the host.
+ */
+#pragma once
+
+#include <stdint.h>
+
+enum DitherMethod : uint8_t
+{
+    DITHER_FLOYD_STEINBERG,
+    DITHER_ORDERED
+};
+
+class GrayDither
+{
+public:
+    static const uint16_t MAX_WIDTH = 128; // Output pixels per row (the native row of the 2.13" panel)
+
+    // False if a size is 0 or outWidth is over MAX_WIDTH
+    bool begin(DitherMethod method, uint16_t sourceWidth, uint16_t sourceHeight, uint16_t outWidth,
+               uint16_t outHeight);
+
+    // Next source pixel, left to right, top to bottom; true when it ends a source row
+    bool add(uint8_t gray);
+
+    // After add() returned true: packs the next output row taken from that
+    // source row into `packed` (stride bytes). False once there are none left
+    // (downscaling skips some source rows, upscaling repeats them).
+    bool nextRow(uint8_t *packed, uint16_t stride);
+
+    uint32_t sourceBytes() const { return (uint32_t)sourceWidth * sourceHeight; }
+    uint16_t rowsOut() const { return outY; }
+
+private:
+    void ditherRow(uint8_t *packed, uint16_t stride);
+
+    DitherMethod method;
+    uint16_t sourceWidth;
+    uint16_t sourceHeight;
+    uint16_t outWidth;
+    uint16_t outHeight;
+    uint16_t sourceX; // Next source pixel
+    uint16_t sourceY;
+    uint16_t outX;    // Next output column to take from the source row
+    uint16_t outY;    // Next output row
+    uint8_t row[MAX_WIDTH];                  // Current source row, scaled to outWidth
+    int16_t errorRows[2][MAX_WIDTH + 2];     // Floyd-Steinberg: this row, next row (one guard pixel each side)
+    uint8_t errorRow;                        // Index of "this row" in errorRows
+};
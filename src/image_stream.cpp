@@ -0,0 +1,186 @@
+/**
+ * @file image_stream.cpp
+ * @brief Streaming 1bpp frame decoder (see image_stream.h).
+ */
+#include "image_stream.h"
+
+#include <stddef.h>
+
+static uint32_t crcUpdate(uint32_t crc, uint8_t value)
+{
+    crc ^= value;
+    for (uint8_t bit = 0; bit < 8; bit++)
+        crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    return crc;
+}
+
+uint32_t imageCrc32(const uint8_t *data, uint32_t length, uint32_t previous)
+{
+    uint32_t crc = ~previous;
+    for (uint32_t i = 0; i < length; i++)
+        crc = crcUpdate(crc, data[i]);
+    return ~crc;
+}
+
+ImageStream::ImageStream()
+    : codec(IMAGE_RAW),
+      stride(0),
+      height(0),
+      band(nullptr),
+      bandRows(0),
+      sink(nullptr),
+      gray(nullptr),
+      activeFlag(false),
+      lastError(""),
+      receivedBytes(0),
+      decodedBytes(0),
+      bandFill(0),
+      bandY(0),
+      crc(0xFFFFFFFF),
+      literalLeft(0),
+      repeatCount(0)
+{
+    lz.begin();
+}
+
+void ImageStream::begin(ImageCodec codec, uint16_t stride, uint16_t height, uint8_t *band, uint16_t bandRows,
+                        ImageSink *sink, GrayDither *gray)
+{
+    this->codec = codec;
+    this->stride = stride;
+    this->height = height;
+    this->band = band;
+    this->bandRows = bandRows;
+    this->sink = sink;
+    this->gray = gray;
+    activeFlag = band != nullptr && sink != nullptr && bandRows > 0 && codec <= IMAGE_LZ;
+    lastError = activeFlag ? "" : "bad parameters";
+    receivedBytes = 0;
+    decodedBytes = 0;
+    bandFill = 0;
+    bandY = 0;
+    crc = 0xFFFFFFFF;
+    literalLeft = 0;
+    repeatCount = 0;
+    lz.begin();
+}
+
+void ImageStream::abort(const char *reason)
+{
+    activeFlag = false;
+    lastError = reason;
+}
+
+uint32_t ImageStream::expected() const
+{
+    return gray != nullptr ? gray->sourceBytes() : (uint32_t)stride * height;
+}
+
+bool ImageStream::flushBand()
+{
+    uint16_t rows = bandFill / stride;
+    bool ok = sink->writeRows(bandY, band, rows);
+    bandY += rows;
+    bandFill = 0;
+    if (!ok)
+        abort("sink failed");
+    return ok;
+}
+
+bool ImageStream::put(uint8_t value)
+{
+    if (decodedBytes >= expected())
+    {
+        abort("more data than the frame holds");
+        return false;
+    }
+    decodedBytes++;
+    crc = crcUpdate(crc, value);
+    if (gray != nullptr)
+        return putGray(value);
+    band[bandFill++] = value;
+    if (bandFill == stride * bandRows || decodedBytes == (uint32_t)stride * height)
+        return flushBand();
+    return true;
+}
+
+// A finished source row gives zero or more packed rows
+bool ImageStream::putGray(uint8_t value)
+{
+    if (!gray->add(value))
+        return true;
+    while (gray->nextRow(band + bandFill, stride))
+    {
+        bandFill += stride;
+        if ((bandFill == stride * bandRows || gray->rowsOut() == height) && !flushBand())
+            return false;
+    }
+    return true;
+}
+
+bool ImageStream::feed(uint32_t offset, const uint8_t *data, uint16_t length)
+{
+    if (!activeFlag)
+        return false;
+    if (offset != receivedBytes)
+    {
+        abort("chunk missing or out of order");
+        return false;
+    }
+    receivedBytes += length;
+    for (uint16_t i = 0; i < length; i++)
+    {
+        uint8_t value = data[i];
+        if (codec == IMAGE_LZ)
+        {
+            uint8_t item[LZ_MAX_MATCH];
+            uint8_t count;
+            if (!lz.decode(value, item, count))
+            {
+                abort("bad LZ reference");
+                return false;
+            }
+            for (uint8_t j = 0; j < count; j++)
+                if (!put(item[j]))
+                    return false;
+        }
+        else if (codec == IMAGE_RAW || literalLeft > 0)
+        {
+            if (literalLeft > 0)
+                literalLeft--;
+            if (!put(value))
+                return false;
+        }
+        else if (repeatCount > 0)
+        {
+            for (; repeatCount > 0; repeatCount--)
+                if (!put(value))
+                    return false;
+        }
+        else if (value < 128)
+            literalLeft = value + 1;
+        else if (value > 128)
+            repeatCount = 257 - value;
+        // 128 is a no-op header
+    }
+    return true;
+}
+
+bool ImageStream::finish(uint32_t expectedCrc)
+{
+    if (!activeFlag)
+        return false;
+    activeFlag = false;
+    if (decodedBytes != expected() || (gray != nullptr && gray->rowsOut() != height) || literalLeft > 0 ||
+        repeatCount > 0 || !lz.idle())
+    {
+        lastError = "frame incomplete";
+        return false;
+    }
+    if (~crc != expectedCrc)
+    {
+        lastError = "CRC mismatch";
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file image_stream.h
+ * @brief 1bpp frame received in BLE chunks, decoded as it arrives.
+ *        The app sends the frame in the panel's native layout (the GxEPD2
+ *        buffer layout: rows of STRIDE bytes, MSB first, set = white), raw,
+ *        PackBits or LZSS (lz_stream.h) compressed. Decoded bytes fill a band buffer of a few rows;
+ *        every full band goes to an ImageSink, which on the badge writes it to
+ *        the controller RAM with writeImage() and appends it to the stored
+ *        copy, so the whole frame is never held in RAM. A CRC-32 of the
+ *        decoded frame, sent with the end command, is checked at the end.
+ *        With a GrayDither the decoded bytes are 8-bit gray pixels instead,
+ *        which it scales and dithers into packed rows (the CRC covers the
+ *        gray pixels, the only thing the app knows).
+ *        Plain C++ (no Arduino calls) so it can be checked on the host.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "image_dither.h"
+#include "lz_stream.h"
+
+const uint16_t IMAGE_CHUNK_MAX = 240; // Data bytes per chunk write (fits a 247 byte ATT MTU)
+
+enum ImageCodec : uint8_t
+{
+    IMAGE_RAW,
+    IMAGE_PACKBITS, // Header n < 128: n + 1 literal bytes; n > 128: next byte 257 - n times
+    IMAGE_LZ        // LzDecoder stream (better on dithered and text frames, 256 bytes more state)
+};
+
+// One write of the image characteristic, or a begin / end command, queued for loop()
+enum ImageChunkKind : uint8_t
+{
+    IMAGE_CHUNK_BEGIN, // codec
+    IMAGE_CHUNK_DATA,  // offset (in the sent stream), length, data
+    IMAGE_CHUNK_END    // crc
+};
+
+struct ImageChunk
+{
+    ImageChunkKind kind;
+    ImageCodec codec;
+    bool gray;           // BEGIN: 8-bit gray pixels to dither, not packed rows
+    DitherMethod dither; // BEGIN, gray
+    uint16_t width;      // BEGIN, gray: source size (native orientation)
+    uint16_t height;
+    uint16_t length;
+    uint32_t offset;
+    uint32_t crc;
+    uint8_t data[IMAGE_CHUNK_MAX];
+};
+
+// Receives decoded rows, top to bottom
+class ImageSink
+{
+public:
+    virtual bool writeRows(uint16_t y, const uint8_t *rows, uint16_t count) = 0;
+};
+
+class ImageStream
+{
+public:
+    ImageStream();
+
+    // Starts a frame of `height` rows of `stride` bytes. `band` holds bandRows
+    // rows and is handed to the sink each time it is full. With `gray` (begun
+    // by the caller with the source size) the stream carries gray pixels.
+    void begin(ImageCodec codec, uint16_t stride, uint16_t height, uint8_t *band, uint16_t bandRows,
+               ImageSink *sink, GrayDither *gray = nullptr);
+
+    // Decodes the next chunk. `offset` is its position in the sent stream and
+    // has to follow the previous chunk (a lost chunk ends the stream).
+    // Returns false (and stops the stream) on any error.
+    bool feed(uint32_t offset, const uint8_t *data, uint16_t length);
+
+    // True if the whole frame arrived and its CRC-32 matches; stops the stream
+    bool finish(uint32_t crc);
+
+    void abort(const char *reason);
+    bool active() const { return activeFlag; }
+    const char *error() const { return lastError; }
+    uint32_t received() const { return receivedBytes; } // Sent (possibly compressed) bytes
+    uint32_t decoded() const { return decodedBytes; }
+    uint32_t expected() const; // Decoded bytes of a whole frame
+
+private:
+    bool put(uint8_t value);
+    bool putGray(uint8_t value);
+    bool flushBand();
+
+    ImageCodec codec;
+    uint16_t stride;
+    uint16_t height;
+    uint8_t *band;
+    uint16_t bandRows;
+    ImageSink *sink;
+    GrayDither *gray;
+    bool activeFlag;
+    const char *lastError;
+    uint32_t receivedBytes;
+    uint32_t decodedBytes;
+    uint16_t bandFill; // Bytes in band
+    uint16_t bandY;    // Row of band[0]
+    uint32_t crc;      // Running CRC-32 of the decoded bytes (not finalized)
+    // PackBits state across chunks
+    uint8_t literalLeft;
+    uint16_t repeatCount; // > 0: next byte is the value to repeat
+    LzDecoder lz;
+};
+
+// CRC-32 (IEEE 802.3, as zlib's crc32()); pass the previous result to continue it
+uint32_t imageCrc32(const uint8_t *data, uint32_t length, uint32_t previous = 0);
@@ -0,0 +1,101 @@
+/**
+ * @file info_patch.cpp
+ * @brief Field and byte range edits of the personal info (see info_patch.h).
+ */
+#include "info_patch.h"
+
+#include <string.h>
+
+// Unsigned decimal up to 65535; advances `text` past it
+static bool parseNumber(const char *&text, uint16_t &value)
+{
+    uint32_t number = 0;
+    const char *start = text;
+    while (*text >= '0' && *text <= '9' && number <= 0xFFFF)
+        number = number * 10 + (*text++ - '0');
+    value = (uint16_t)number;
+    return text != start && number <= 0xFFFF;
+}
+
+bool parseInfoPatch(const char *spec, InfoPatch &patch)
+{
+    if (strncmp(spec, "field:", 6) == 0)
+    {
+        spec += 6;
+        patch.kind = INFO_PATCH_FIELD;
+        patch.count = 0;
+        if (!parseNumber(spec, patch.index))
+            return false;
+    }
+    else if (strncmp(spec, "bytes:", 6) == 0)
+    {
+        spec += 6;
+        patch.kind = INFO_PATCH_BYTES;
+        if (!parseNumber(spec, patch.index) || *spec++ != ',' || !parseNumber(spec, patch.count))
+            return false;
+    }
+    else
+        return false;
+    if (*spec++ != '=')
+        return false;
+    patch.text = spec;
+    patch.textLength = strlen(spec);
+    return true;
+}
+
+static bool utf8Continuation(char c)
+{
+    return ((uint8_t)c & 0xC0) == 0x80;
+}
+
+int32_t applyInfoPatch(const char *info, uint16_t length, const InfoPatch &patch, char *out, uint16_t maxLength)
+{
+    uint16_t start, end;
+    if (patch.kind == INFO_PATCH_FIELD)
+    {
+        if (memchr(patch.text, '\n', patch.textLength) != nullptr)
+            return -1; // Would split the field
+        // Find field `index`; the one after the last field is an append
+        uint16_t field = 0;
+        start = 0;
+        while (field < patch.index)
+        {
+            const char *newline = (const char *)memchr(info + start, '\n', length - start);
+            if (newline == nullptr)
+                break;
+            start = newline - info + 1;
+            field++;
+        }
+        if (field < patch.index)
+        {
+            uint32_t total = (uint32_t)length + 1 + patch.textLength;
+            if (patch.index != field + 1 || total > maxLength)
+                return -1;
+            memcpy(out, info, length);
+            out[length] = '\n';
+            memcpy(out + length + 1, patch.text, patch.textLength);
+            out[total] = '\0';
+            return (int32_t)total;
+        }
+        const char *newline = (const char *)memchr(info + start, '\n', length - start);
+        end = newline != nullptr ? newline - info : length;
+    }
+    else
+    {
+        if ((uint32_t)patch.index + patch.count > length)
+            return -1;
+        start = patch.index;
+        end = patch.index + patch.count;
+        if ((start < length && utf8Continuation(info[start])) || (end < length && utf8Continuation(info[end])))
+            return -1;
+    }
+
+    uint32_t total = (uint32_t)length - (end - start) + patch.textLength;
+    if (total > maxLength)
+        return -1;
+    memcpy(out, info, start);
+    memcpy(out + start, patch.text, patch.textLength);
+    memcpy(out + start + patch.textLength, info + end, length - end);
+    out[total] = '\0';
+    return (int32_t)total;
+}
@@ -0,0 +1,36 @@
+/**
+ * @file info_patch.h
+ * @brief Small edits of the personal info record ("data:patch:" commands),
+ *        so the app does not resend the whole text for one changed field.
+ *          field:<n>=<text>            sets field n ('\n' separated, 0 = name;
+ *                                      n = field count appends one)
+ *          bytes:<start>,<count>=<text> replaces count bytes at start
+ *        Byte ranges may not cut a UTF-8 sequence. Plain C++ (no Arduino
+ *        calls) so it can be checked on the host.
+ */
+#pragma once
+
+#include <stdint.h>
+
+enum InfoPatchKind : uint8_t
+{
+    INFO_PATCH_FIELD,
+    INFO_PATCH_BYTES
+};
+
+struct InfoPatch
+{
+    InfoPatchKind kind;
+    uint16_t index; // Field number, or first byte
+    uint16_t count; // Bytes replaced (INFO_PATCH_BYTES)
+    const char *text; // Points into the parsed spec
+    uint16_t textLength;
+};
+
+// Parses the part after "data:patch:"; false if it is malformed
+bool parseInfoPatch(const char *spec, InfoPatch &patch);
+
+// Writes `info` with `patch` applied to `out` (maxLength bytes at most, plus
+// a terminating NUL). Returns the new length, or -1 if the patch does not
+// apply (no such field, range outside the text, result too long).
+int32_t applyInfoPatch(const char *info, uint16_t length, const InfoPatch &patch, char *out, uint16_t maxLength);
@@ -0,0 +1,65 @@
+/**
+ * @file lz_stream.cpp
+ * @brief Streaming LZSS decoder (see lz_stream.h).
+ */
+#include "lz_stream.h"
+
+static const uint8_t LITERAL_BITS = 1 + 8;
+static const uint8_t MATCH_BITS = 1 + LZ_WINDOW_BITS + LZ_LOOKAHEAD_BITS;
+
+void LzDecoder::begin()
+{
+    windowPos = 0;
+    total = 0;
+    bits = 0;
+    bitCount = 0;
+}
+
+bool LzDecoder::decode(uint8_t in, uint8_t *out, uint8_t &count)
+{
+    count = 0;
+    bits = (bits << 8) | in;
+    bitCount += 8;
+    bool literal = (bits >> (bitCount - 1)) & 1;
+    if (literal && bitCount >= LITERAL_BITS)
+    {
+        bitCount -= LITERAL_BITS;
+        out[count++] = (uint8_t)(bits >> bitCount);
+        window[windowPos] = out[0];
+        windowPos = (windowPos + 1) & (LZ_WINDOW_SIZE - 1);
+        total++;
+    }
+    else if (!literal && bitCount >= MATCH_BITS)
+    {
+        bitCount -= MATCH_BITS;
+        uint16_t offset = ((bits >> (bitCount + LZ_LOOKAHEAD_BITS)) & (LZ_WINDOW_SIZE - 1)) + 1;
+        uint8_t length = ((bits >> bitCount) & (LZ_MAX_MATCH - 1)) + 1;
+        if (offset > total)
+            return false;
+        for (; count < length; count++)
+        {
+            out[count] = window[(windowPos - offset) & (LZ_WINDOW_SIZE - 1)];
+            window[windowPos] = out[count];
+            windowPos = (windowPos + 1) & (LZ_WINDOW_SIZE - 1);
+        }
+        total += length;
+    }
+    bits &= (1UL << bitCount) - 1;
+    return true;
+}
+
+int32_t lzDecodeBuffer(LzDecoder &decoder, const uint8_t *data, uint32_t length, uint8_t *out, uint32_t outSize)
+{
+    uint8_t item[LZ_MAX_MATCH];
+    uint8_t count;
+    uint32_t used = 0;
+    decoder.begin();
+    for (uint32_t i = 0; i < length; i++)
+    {
+        if (!decoder.decode(data[i], item, count) || used + count > outSize)
+            return -1;
+        for (uint8_t j = 0; j < count; j++)
+            out[used++] = item[j];
+    }
+    return decoder.idle() ? (int32_t)used : -1;
+}
@@ -0,0 +1,47 @@
+/**
+ * @file lz_stream.h
+ * @brief Streaming LZSS decoder for compressed BLE payloads.
+ *        heatshrink-style bit stream, MSB first: a 1 bit and 8 bits is a
+ *        literal byte; a 0 bit, LZ_WINDOW_BITS bits of offset - 1 and
+ *        LZ_LOOKAHEAD_BITS bits of length - 1 copies earlier output (the
+ *        copy may overlap itself). The last byte is padded with 0 bits,
+ *        which are too few to make an item. All state is the window of the
+ *        last LZ_WINDOW_SIZE output bytes and a bit buffer: no heap, and
+ *        input can be split anywhere. Encoder: tools/lz_pack.py.
+ *        Plain C++ (no Arduino calls) so it can be checked on the host.
+ */
+#pragma once
+
+#include <stdint.h>
+
+const uint8_t LZ_WINDOW_BITS = 8;    // 256 byte window
+const uint8_t LZ_LOOKAHEAD_BITS = 6; // Matches of up to 64 bytes (long white runs in frames)
+const uint16_t LZ_WINDOW_SIZE = 1 << LZ_WINDOW_BITS;
+const uint8_t LZ_MAX_MATCH = 1 << LZ_LOOKAHEAD_BITS;
+
+class LzDecoder
+{
+public:
+    void begin();
+
+    // Decodes one input byte into `out` (room for LZ_MAX_MATCH bytes), which
+    // gets `count` bytes (0 while an item is incomplete: items are at least
+    // 9 bits, so one input byte completes one item at most). False if a
+    // match reaches back before the first byte.
+    bool decode(uint8_t in, uint8_t *out, uint8_t &count);
+
+    // No item is half read (only padding bits are left)
+    bool idle() const { return bitCount < 8; }
+    uint32_t decoded() const { return total; }
+
+private:
+    uint8_t window[LZ_WINDOW_SIZE];
+    uint16_t windowPos; // Next write position in window
+    uint32_t total;     // Output bytes so far
+    uint32_t bits;      // Unread input bits, the low bitCount bits
+    uint8_t bitCount;
+};
+
+// Whole-buffer helper: decodes `length` bytes into `out` (outSize at most).
+// Returns the decoded length, or -1 if the data is corrupt or does not fit.
+int32_t lzDecodeBuffer(LzDecoder &decoder, const uint8_t *data, uint32_t length, uint8_t *out, uint32_t outSize);
@@ -13,10 +13,27 @@
 
 // Font library for messages
 #include <Fonts/FreeSans9pt7b.h>  // Using 9pt font for info/status
-#include <Fonts/FreeSans12pt7b.h> // Larger font for info screen maybe?
-
-// QR Code Generation Library
-#include <qrcode.h>
+#include <Fonts/FreeSans12pt7b.h> // Info screen sizes 9/12/18/24 pt, bold for the name line
+#include <Fonts/FreeSans18pt7b.h>
+#include <Fonts/FreeSans24pt7b.h>
+#include <Fonts/FreeSansBold9pt7b.h>
+#include <Fonts/FreeSansBold12pt7b.h>
+#include <Fonts/FreeSansBold18pt7b.h>
+#include <Fonts/FreeSansBold24pt7b.h>
+
+#include "text_layout.h" // Info screen layout, computed once per content change
+#include "glyph_blit.h"  // Packed glyph blitter for the info screen
+#include "display_list.h" // Screen recorded once per refresh, replayed per band
+#include "screens.h"      // What each display mode draws
+#include "qr_encoder.h"   // QR encoder with packed rows (replaces ricmoo/QRCode)
+#include "contact_card.h" // MeCard from personalInfo for the contact QR screen
+#include "flash_font.h"  // UTF-8 info text with Unicode glyphs from LittleFS
+#include "image_stream.h" // IMAGE screen received in BLE chunks, written to the panel as it arrives
+#include "lz_stream.h"    // "lz:" compressed commands on the data characteristic
+#include "info_patch.h"   // "data:patch:" edits of one field of personalInfo
+#include "frame_readback.h" // The frame on the panel, PackBits compressed back over BLE
+
+#include <LittleFS.h>
 
 // Include Arduino core
 #include <Arduino.h>
@@ -37,29 +54,40 @@
 // *** ADD BLE SECURITY INCLUDE ***
 #include <BLESecurity.h>
 
-// *** INCLUDE OneButton LIBRARY ***
-#include <OneButton.h>
+// --- Button Input (ISR edge queue + gesture recognizer) ---
+#include "button_input.h" // Gesture recognizer, gesture -> action mapping / intent queue
+#include "edge_queue.h"   // Lock-free ISR -> loop() queue
 
 // ... other includes ...
 #include <Preferences.h> // For Non-Volatile Storage
 
+#include "battery.h"       // Calibrated, filtered battery measurement
+#include "battery_model.h" // Notification policy (BatteryReporter)
+#include "sleep_scheduler.h" // Wake window, advertising phases, timer wake
+
 // NVS Keys
 const char *NVS_NAMESPACE = "badgeData";
 const char *NVS_KEY_INFO = "persInfo";
 const char *NVS_KEY_QR = "qrData";
 const char *NVS_KEY_MODE = "dispMode";
+const char *NVS_KEY_POWER = "powerCfg"; // PowerPolicy blob
+const char *NVS_KEY_LAYOUT = "infoLayout"; // InfoLayout blob for the stored personal info
+const char *NVS_KEY_BUTTONS = "buttonMap"; // ButtonMapping blob ("config:button:")
 
 // New Characteristic UUIDs (Derive from your service UUID or generate new ones)
 #define NAME_CHARACTERISTIC_UUID "beb5483e-36e1-4688-b7f5-ea07361b26aa"  // Example: +1
 #define EMAIL_CHARACTERISTIC_UUID "beb5483e-36e1-4688-b7f5-ea07361b26ab" // Example: +2
 #define PHONE_CHARACTERISTIC_UUID "beb5483e-36e1-4688-b7f5-ea07361b26ac" // Example: +3
 #define QRURL_CHARACTERISTIC_UUID "beb5483e-36e1-4688-b7f5-ea07361b26ad" // Example: +4
+#define IMAGE_CHARACTERISTIC_UUID "beb5483e-36e1-4688-b7f5-ea07361b26ae" // Image chunks (write): +5
+#define FRAME_CHARACTERISTIC_UUID "beb5483e-36e1-4688-b7f5-ea07361b26af" // Frame read-back (read/notify): +6
 // Note: Battery Service/Characteristic have standard UUIDs
 
-// Battery Monitoring (Adjust pin if needed - common on LilyGo boards)
-#define BATT_ADC_PIN 35
-#define BATT_VOLTAGE_MAX 4.2
-#define BATT_VOLTAGE_MIN 3.0
+// Battery Monitoring (pin from the board traits)
+#define BATT_ADC_PIN Badge::PIN_BATTERY
+#define BATT_ADC_CHANNEL ((adc1_channel_t)adc1ChannelForPin(BATT_ADC_PIN))
+static_assert(adc1ChannelForPin(BATT_ADC_PIN) >= 0, "Battery pin must be on ADC1 (ADC2 is used by the radio)");
+#define BATT_DIVIDER_RATIO 2.0f         // 100k/100k divider on LilyGo T5: battery V = 2 x pin V
 
 // Global Preferences object
 Preferences preferences;
@@ -69,14 +97,24 @@ BLECharacteristic *pNameCharacteristic = NULL;
 BLECharacteristic *pEmailCharacteristic = NULL;
 BLECharacteristic *pPhoneCharacteristic = NULL;
 BLECharacteristic *pQrUrlCharacteristic = NULL;
+BLECharacteristic *pImageCharacteristic = NULL;
+BLECharacteristic *pFrameCharacteristic = NULL;
 BLECharacteristic *pBatteryLevelCharacteristic = NULL;
+BLE2902 *pBatteryLevelCccd = NULL; // Client subscription state for battery notifications
 
 // Battery Notification Timer
 unsigned long lastBatteryUpdateTime = 0;
-const unsigned long BATTERY_UPDATE_INTERVAL_MS = 15000; // Update every 15 seconds
-
-// Wake Timer Control
-unsigned long wakeStartTime = 0;
+const unsigned long BATTERY_UPDATE_INTERVAL_MS = 15000; // Sample every 15 seconds (only while subscribed)
+const uint8_t BATTERY_NOTIFY_HYSTERESIS_PCT = 3;        // Notify only when the level moved this much
+BatteryReporter batteryReporter(BATTERY_NOTIFY_HYSTERESIS_PCT);
+volatile bool batterySubscriptionChanged = false; // Set by the CCCD write callback
+
+// Wake Timer Control (policy loaded from NVS, configurable over BLE with "config:power:")
+SleepScheduler sleepScheduler;
+PowerPolicy powerPolicy = powerPolicyPreset(PRESET_DEFAULT);
+AdvPhase currentAdvPhase = ADV_OFF;          // Advertising phase currently applied to the stack
+volatile bool wakeWindowRestartRequested = false; // Set by onDisconnect, handled in loop()
+volatile bool newPowerPolicyReceived = false;     // Set by onWrite, handled in loop()
 
 // ===================================================================================
 // Configuration Constants
@@ -87,25 +125,50 @@ enum DisplayMode
 {
     INFO,
     QR_CODE,
-    BLANK // Represents a cleared state
+    BLANK,     // Represents a cleared state
+    CONTACT_QR,   // MeCard built from personalInfo (appended: modes are stored in NVS by value)
+    SPLIT_SCREEN, // QR in the left square, personal info in the rest
+    IMAGE         // 1bpp frame sent over BLE, stored in LittleFS
 };
 
 // --- QR Code Configuration ---
-const int FIXED_QR_VERSION = 7;
-const int FIXED_QR_SCALE = 2;                 // Adjust scale based on your display size and desired QR size
+const int MAX_QR_VERSION = 7;                 // Largest version; shorter data gets a smaller one (bigger modules)
 const int MAX_QR_INPUT_STRING_LENGTH = 90;    // Max length for QR data
-const int MAX_INFO_INPUT_STRING_LENGTH = 150; // Max length for personal info data
+const int MAX_INFO_INPUT_STRING_LENGTH = 250; // Max length for personal info data (long lines wrap)
+const int MAX_COMMAND_LENGTH = 512;           // Decompressed "lz:" write (the longest plain attribute write)
 const int QR_QUIET_ZONE_MODULES = 4;          // Standard quiet zone
+const int QR_SIZE_MODULES = 4 * MAX_QR_VERSION + 17;
+// Split screen: QR in the Badge::HEIGHT square on the left, info text right of it
+const int16_t SPLIT_QR_SIDE = Badge::HEIGHT;
+const int16_t SPLIT_TEXT_W = Badge::WIDTH - SPLIT_QR_SIDE;
+static_assert(SPLIT_TEXT_W >= Badge::HEIGHT / 2, "Split screen needs a landscape panel");
+const int MIN_QR_SCALE = Badge::qrScale(QR_SIZE_MODULES, QR_QUIET_ZONE_MODULES); // Scale of the largest code
+static_assert(MIN_QR_SCALE >= 1, "QR code with quiet zone does not fit the panel");
+static_assert(MAX_QR_VERSION <= QR_MAX_VERSION, "qr_encoder.cpp stops at QR_MAX_VERSION");
+
+// --- Info Screen Fonts (InfoLayout stores indexes into this set, smallest first) ---
+const InfoFontSet INFO_FONTS = {
+    {&FreeSans9pt7b, &FreeSans12pt7b, &FreeSans18pt7b, &FreeSans24pt7b},
+    {&FreeSansBold9pt7b, &FreeSansBold12pt7b, &FreeSansBold18pt7b, &FreeSansBold24pt7b}};
 
 // --- BLE Configuration ---
 // TODO: Generate my own unique UUIDs for production!
 #define SERVICE_UUID "4fafc201-1fb5-459e-8fcc-c5c9c331914c"             // Changed last char for distinction
 #define DATA_CHARACTERISTIC_UUID "beb5483e-36e1-4688-b7f5-ea07361b26a9" // Changed last char
+// Attribute handles of the badge service: 3 per characteristic (declaration, value,
+// description), 4 with a CCCD, plus the service itself. The default of 15 is too few.
+const uint32_t SERVICE_HANDLES = 32;
 
 const char *bleDeviceName = "PixelTag";
 
 // --- Button Configuration ---
-#define BUTTON_PIN 39 // GPIO0 is often the 'BOOT' button on ESP32 dev boards. Change if needed.
+#define BUTTON_PIN Badge::PIN_BUTTON // From the board traits; must be an RTC GPIO (deep sleep wake)
+const int BUTTON_DEBOUNCE_MS = 30;      // Edges closer than this are contact bounce
+const int BUTTON_DOUBLE_CLICK_MS = 300; // Max gap between clicks of a double-click
+const int BUTTON_LONG_PRESS_MS = 1000;  // Hold time for a long-press
+const unsigned long BUTTON_RELEASE_WAIT_MS = 10000; // Deep sleep waits this long for the button to be released
+const int BUTTON_EDGE_QUEUE_SIZE = 32;  // Power of two; a refresh takes a few seconds, 16 presses fit
+const unsigned long LOOP_IDLE_WAIT_MS = 50; // Max time loop() sleeps waiting for a button edge
 
 // ===================================================================================
 // Global Variables
@@ -120,38 +183,203 @@ String personalInfo = "No Info Received Yet.\nUse BLE to send data.";
 String qrCodeData = "";                 // Start with no QR data
 bool displayUpdateRequestNeeded = true; // Trigger initial display update
 bool clearDisplayRequested = false;     // Flag for clear command
+InfoLayout infoLayout;                  // Layout of personalInfo (see ensureInfoLayout())
+InfoLayout splitLayout;                 // Same for the text area of SPLIT_SCREEN (RAM only, see ensureSplitLayout())
+// Rows per page of the display buffer (page_height of GxEPD2_BW<Driver, page_height>)
+template <typename Display>
+struct DisplayPageRows;
+template <typename Driver, const uint16_t PageRows>
+struct DisplayPageRows<GxEPD2_DISPLAY_CLASS<Driver, PageRows>>
+{
+    static const uint16_t value = PageRows;
+};
+const uint16_t DISPLAY_PAGE_ROWS = DisplayPageRows<decltype(display)>::value;
+const uint16_t DISPLAY_PAGES = (Badge::NATIVE_HEIGHT + DISPLAY_PAGE_ROWS - 1) / DISPLAY_PAGE_ROWS;
+#if DISPLAY_FULL_FRAME
+static_assert(DISPLAY_PAGES == 1, "DISPLAY_FULL_FRAME needs a full-height display buffer: set MAX_HEIGHT() "
+                                  "for this board in GxEPD2_display_selection_new_style.h");
+#endif
+// Screen recorded once per refresh (see recordScreen()) and replayed band by band
+// into displayBand, which is written to the panel after each band (native
+// orientation, same layout as the GxEPD2 buffer). Bands follow the display's
+// pages: one band, one render pass with DISPLAY_FULL_FRAME.
+const uint16_t DISPLAY_BAND_STRIDE = Badge::STRIDE;
+const uint16_t DISPLAY_BAND_ROWS = DISPLAY_PAGE_ROWS;
+uint8_t displayBand[DISPLAY_BAND_STRIDE * DISPLAY_BAND_ROWS];
+DisplayList displayList;
+QrCode qrCode; // QR encoded by recordScreen(), drawn by displayList
+// Contact QR: encoded once per personalInfo change (see ensureContactQr()), kept for every refresh
+QrCode contactQrCode;
+char contactCardText[2 * MAX_INFO_INPUT_STRING_LENGTH + 32]; // Room for escapes and field tags
+bool contactQrReady = false;
+bool contactQrChecked = false; // contactQrReady reflects contactQrSourceHash
+uint32_t contactQrSourceHash = 0;
+const bool USE_DISPLAY_LIST = true; // false = draw every page through the GFX calls
+// personalInfo as 8-bit codes for layout and drawing (see prepareInfoText()), and its fonts
+char infoText[MAX_INFO_INPUT_STRING_LENGTH + 1];
+InfoFontSet infoFontSet = INFO_FONTS;
+bool infoTextReady = false;
+uint32_t infoTextSourceHash = 0;
+bool infoTextUsesFlashFonts = false;
+bool infoLayoutFromThisBoot = false; // infoLayout computed since boot (not loaded from NVS)
+
+// --- Unicode Fonts (optional, uploaded with "pio run -t uploadfs") ---
+// One file per info font size; a missing size uses the nearest one present.
+// All sizes cache their glyphs in one pool (see prepareInfoText()).
+const char *const UNICODE_FONT_FILES[INFO_FONT_SIZES] = {
+    "/fonts/unicode9.ntf", "/fonts/unicode12.ntf", "/fonts/unicode18.ntf", "/fonts/unicode24.ntf"};
+
+class LittleFsFontSource : public FontSource
+{
+public:
+    bool open(const char *path)
+    {
+        file = LittleFS.open(path, "r");
+        return (bool)file;
+    }
+    bool readAt(uint32_t offset, void *dst, uint16_t length) override
+    {
+        return file.seek(offset) && file.read((uint8_t *)dst, length) == length;
+    }
+
+private:
+    File file;
+};
+
+LittleFsFontSource unicodeFontFiles[INFO_FONT_SIZES];
+FlashFont unicodeFonts[INFO_FONT_SIZES];
+FlashGlyphPool unicodeGlyphPool;
+bool unicodeFontsAvailable = false;
+
+// --- Image Screen (see image_stream.h) ---
+// BLE callbacks queue begin / data / end in order; loop() decodes them into
+// displayBand and writes each band to the panel RAM and to IMAGE_TEMP_FILE.
+const char *IMAGE_FILE = "/image.bin";      // Native frame, Badge::FRAME_BYTES
+const char *IMAGE_TEMP_FILE = "/image.tmp"; // Frame being received, renamed when complete
+const int IMAGE_QUEUE_SIZE = 16;            // Chunks between the BLE task and loop() (power of two)
+const unsigned long IMAGE_STREAM_IDLE_MS = 10000; // An upload without chunks for this long is aborted
+
+class PanelImageSink : public ImageSink
+{
+public:
+    File file;
+    bool fileOk = false;
+    bool writeRows(uint16_t y, const uint8_t *rows, uint16_t count) override
+    {
+        display.epd2.writeImage(rows, 0, y, GxEPD2_DRIVER_CLASS::WIDTH, count);
+        size_t bytes = (size_t)count * Badge::STRIDE;
+        if (fileOk && file.write(rows, bytes) != bytes)
+            fileOk = false; // Still shown, just not stored
+        return true;
+    }
+};
+
+EdgeQueue<ImageChunk, IMAGE_QUEUE_SIZE> imageChunks;
+ImageStream imageStream;
+GrayDither imageDither; // Gray uploads: scaling and dithering state (two error rows)
+PanelImageSink panelImageSink;
+unsigned long imageStreamStartMs = 0;
+unsigned long imageStreamLastChunkMs = 0;
+bool littleFsMounted = false;
+bool imageStored = false; // IMAGE_FILE holds a whole frame
+static_assert(Badge::FRAME_BYTES == DISPLAY_BAND_STRIDE * Badge::NATIVE_HEIGHT, "Image frames use the band layout");
+
+// --- Frame Read-back (see frame_readback.h) ---
+// Where the frame on the panel can be read from without drawing it again. The
+// FRAME characteristic reads "<crc32 hex>:<PackBits bytes>:<stride>x<rows>"
+// of it ("none" if it is not known); "frame:read" streams it as notifications.
+// A refresh during a read-back restarts it at offset 0 with the new frame.
+const uint8_t FRAME_NOTIFIES_PER_LOOP = 4; // Notifications per loop() pass (each waits for the stack)
+
+enum FrameSource : uint8_t
+{
+    FRAME_UNKNOWN, // Before the first refresh, after a page-by-page draw, during an upload
+    FRAME_BAND,    // displayBand holds the whole frame (DISPLAY_PAGES == 1)
+    FRAME_LIST,    // displayList replays it band by band
+    FRAME_STORED,  // IMAGE_FILE
+    FRAME_BLANK    // All white
+};
+
+class PanelFrameRows : public FrameRows
+{
+public:
+    FrameSource source = FRAME_UNKNOWN;
+    int16_t bandY = -1; // Band of the frame in displayBand (FRAME_LIST / FRAME_STORED), -1 = none
+    File file;
+    const uint8_t *readRow(uint16_t y) override;
+};
+
+PanelFrameRows frameRows;
+FrameReadback frameReadback;
+bool frameReadbackActive = false;
+volatile bool frameReadRequested = false; // Set by onWrite, handled in loop()
+char frameSummary[40] = "none";           // Value of the FRAME characteristic
 
 // --- Data Received Flags (set by BLE callback) ---
 bool newInfoDataReceived = false;
+bool infoPatchReceived = false; // newInfoDataReceived came from data:patch: (partial refresh if possible)
 bool newQrDataReceived = false;
 
+// --- Partial Refresh (INFO screen after a patch) ---
+// Only the lines a patch changed are refreshed; every few partial refreshes a
+// full one clears the ghosting they leave.
+const uint8_t PARTIAL_REFRESH_LIMIT = 5;
+uint8_t partialRefreshCount = 0; // Since the last full refresh
+
 // --- Button State ---
-unsigned long lastButtonActionTime = 0;        // <<< ADD THIS LINE (Timestamp of last action)
-const unsigned long BUTTON_COOLDOWN_MS = 5000; // <<< ADD THIS LINE (5 seco
+// The ISR timestamps edges into buttonEdges; loop() (and the display BUSY callback)
+// feed them to the recognizer. Gestures are mapped to actions by buttonInput;
+// intents made during a refresh are held until it ends.
+EdgeQueue<ButtonEdge, BUTTON_EDGE_QUEUE_SIZE> buttonEdges;
+GestureRecognizer gestureRecognizer(BUTTON_DEBOUNCE_MS, BUTTON_DOUBLE_CLICK_MS, BUTTON_LONG_PRESS_MS);
+ButtonInput buttonInput;
+TaskHandle_t loopTaskHandle = NULL; // Woken by the button ISR and by queued image chunks
 // --- BLE ---
 BLEServer *pServer = NULL;
 BLECharacteristic *pDataCharacteristic = NULL;
 bool deviceConnected = false;
 
-// *** CREATE OneButton INSTANCE ***
-// Param 1: Pin, Param 2: active LOW (true for INPUT_PULLUP), Param 3: enable internal pull-up (true)
-OneButton button(BUTTON_PIN, true, true);
-
 // ===================================================================================
 // Function Prototypes
 // ===================================================================================
 void setupBLE();
 void updateDisplay();    // Main function to refresh screen based on currentMode (FULL UPDATE)
-void drawInfoScreen();   // Draws the personal info content
+bool refreshPatchedInfo(); // Partial refresh of the INFO lines a patch changed; false = needs updateDisplay()
+void drawInfoScreen(const InfoLayout &layout, int targetX, int targetW); // Draws the personal info content
+void recordScreen();     // Records the current mode's screen into displayList
+uint16_t writeDisplayList(bool again, unsigned long &replayUs); // Replays displayList band by band to the panel
+void ensureInfoLayout(); // Recomputes (and stores) infoLayout if personalInfo changed
+void ensureSplitLayout(); // Recomputes splitLayout if personalInfo changed
+const QrCode *encodeSplitQr(); // QR of the split screen, or NULL if there is none
+void prepareInfoText();  // Transcodes personalInfo into infoText and loads the glyphs it needs
+void mountUnicodeFonts(); // Opens the optional Unicode font files
 void drawQrScreen();     // Draws the QR code content or error message
+bool ensureContactQr();  // Re-encodes contactQrCode if personalInfo changed; false if there is no card
 void performFullClear(); // Clears screen fully (FULL UPDATE)
 void drawCenteredText(const char *text, int baselineY, const GFXfont *font, uint16_t color = GxEPD_BLACK, int targetW = -1, int targetX = 0);
 bool drawQrCode(int x_target_area, int y_target_area, int w_target_area, int h_target_area, const char *text);
+void drawQrModules(int x_target_area, int y_target_area, int w_target_area, int h_target_area, const QrCode &code);
+bool encodeQrCode(QrCode &code, const char *text); // Checks and encodes text, version MAX_QR_VERSION at most
+int qrScaleFor(const QrCode &code);                 // Largest module size that fits the code on the panel
 
 uint8_t readBatteryLevel();
 void sendBatteryNotification();
 // *** ADD NEW CALLBACK PROTOTYPE ***
-void handleButtonClick(); // Callback function for OneButton
+void buttonIsr();                          // GPIO interrupt: timestamps edges into buttonEdges
+void pumpButtonEdges();                    // Feeds queued edges to the gesture recognizer
+void processButtonIntent();                // Applies the pending button action (called from loop)
+void waitForLoopWork();                    // End of loop(): sleeps until there is something to do
+DisplayMode nextAvailableMode(DisplayMode mode); // mode, or the next one in the button cycle with something to show
+void displayBusyCallback(const void *);    // Called by GxEPD2 while waiting on the panel BUSY line
+void enterDeepSleep(const char *reason);
+void applyAdvertisingPhase(AdvPhase phase); // (Re)starts advertising with the phase's interval
+void queueImageChunk(const ImageChunk &chunk); // BLE task -> loop(), dropped if the queue is full
+void pumpImageStream();                     // Decodes queued image chunks into the panel RAM
+void finishImageStream(uint32_t crc);       // Stores and refreshes a complete image
+void abortImageStream(const char *reason);  // Stops an upload, drops its temp file
+bool writeStoredImage(bool again);          // IMAGE_FILE band by band to the panel RAM
+void setFrameSource(FrameSource source);    // Records where the frame just shown lives, updates frameSummary
+void pumpFrameReadback();                   // Sends the next read-back chunks as notifications
 // ===================================================================================
 // BLE Callback Classes
 // ===================================================================================
@@ -203,6 +431,11 @@ class ReadCharacteristicCallbacks : public BLECharacteristicCallbacks
             pCharacteristic->setValue(qrCodeData.c_str());
             Serial.printf(" Responding with QR URL: %s\n", qrCodeData.c_str());
         }
+        else if (pCharacteristic == pFrameCharacteristic)
+        {
+            pCharacteristic->setValue(frameSummary); // Kept current by setFrameSource() on the loop task
+            Serial.printf(" Responding with Frame: %s\n", frameSummary);
+        }
         else if (pCharacteristic == pBatteryLevelCharacteristic)
         {
             uint8_t level = readBatteryLevel();
@@ -220,6 +453,8 @@ class MyServerCallbacks : public BLEServerCallbacks
     {
         deviceConnected = true;
         pServer = pServerInstance;
+        currentAdvPhase = ADV_OFF; // The stack stops advertising on connect
+        batteryReporter.requestImmediate(); // Fresh client gets the current level if subscribed
         Serial.println("[DEBUG] === BLE Client Connected ===");
         // Optionally log client address if available:
         // BLEAddress clientAddress = pServerInstance->getConnInfo(pServerInstance->getConnId()).getAddress();
@@ -230,18 +465,66 @@ class MyServerCallbacks : public BLEServerCallbacks
     {
         deviceConnected = false;
         Serial.println("[DEBUG] === BLE Client Disconnected ===");
-        wakeStartTime = millis(); // <<< ADD THIS LINE to restart sleep timer
-        Serial.println("[DEBUG] onDisconnect: Sleep timeout timer restarted.");
+        Serial.printf("[DEBUG] Battery notifications: %lu sent, %lu radio events saved (%lu unchanged, %lu unsubscribed)\n",
+                      (unsigned long)batteryReporter.sent(), (unsigned long)batteryReporter.radioEventsSaved(),
+                      (unsigned long)batteryReporter.suppressed(), (unsigned long)batteryReporter.skipped());
+        wakeWindowRestartRequested = true; // loop() restarts the sleep timer and advertising
+        Serial.println("[DEBUG] onDisconnect: Sleep timeout timer restart requested.");
         // Advertising is stopped in the sleep logic before sleeping
     }
 };
 
+// --- Battery CCCD Write Callback (client (un)subscribed) ---
+class BatteryCccdCallbacks : public BLEDescriptorCallbacks
+{
+    void onWrite(BLEDescriptor *pDescriptor)
+    {
+        batterySubscriptionChanged = true; // Handled in sendBatteryNotification() on the loop task
+    }
+};
+
+// --- Image Characteristic Write Callback (binary: uint32 LE offset + up to IMAGE_CHUNK_MAX bytes) ---
+class ImageCharacteristicCallbacks : public BLECharacteristicCallbacks
+{
+    void onWrite(BLECharacteristic *pCharacteristic)
+    {
+        static ImageChunk chunk; // Only the BLE task writes it
+        std::string value = pCharacteristic->getValue();
+        if (value.length() <= 4 || value.length() > 4 + IMAGE_CHUNK_MAX)
+        {
+            Serial.printf("Image chunk of %d bytes ignored.\n", value.length());
+            return;
+        }
+        const uint8_t *bytes = (const uint8_t *)value.data();
+        chunk.kind = IMAGE_CHUNK_DATA;
+        chunk.offset = bytes[0] | (uint32_t)bytes[1] << 8 | (uint32_t)bytes[2] << 16 | (uint32_t)bytes[3] << 24;
+        chunk.length = value.length() - 4;
+        memcpy(chunk.data, bytes + 4, chunk.length);
+        queueImageChunk(chunk);
+    }
+};
+
 // --- Data Characteristic Write Callback ---
 class DataCharacteristicCallbacks : public BLECharacteristicCallbacks
 {
     void onWrite(BLECharacteristic *pCharacteristic)
     {
         std::string value = pCharacteristic->getValue();
+        if (value.compare(0, 3, "lz:") == 0)
+        {
+            // Any command may arrive LZSS compressed (tools/lz_pack.py): fewer bytes on air
+            static LzDecoder decoder; // Only the BLE task uses it
+            static uint8_t command[MAX_COMMAND_LENGTH];
+            int32_t length = lzDecodeBuffer(decoder, (const uint8_t *)value.data() + 3, value.length() - 3, command,
+                                            sizeof(command));
+            if (length < 0)
+            {
+                Serial.printf("[DEBUG] onWrite: Bad lz: write (%d bytes). Ignoring.\n", value.length());
+                return;
+            }
+            Serial.printf("[DEBUG] onWrite: lz: write, %d bytes -> %ld.\n", value.length(), (long)length);
+            value.assign((const char *)command, length);
+        }
         String valueStr = String(value.c_str());
         valueStr.trim();
 
@@ -254,6 +537,7 @@ class DataCharacteristicCallbacks : public BLECharacteristicCallbacks
             Serial.println("Clear command received.");
             clearDisplayRequested = true;
             newInfoDataReceived = false;
+            infoPatchReceived = false;
             newQrDataReceived = false;
             // Optional: maybe set requestedMode to BLANK here too?
             // requestedMode = BLANK;
@@ -268,6 +552,70 @@ class DataCharacteristicCallbacks : public BLECharacteristicCallbacks
             Serial.println("Display QR command received.");
             requestedMode = QR_CODE;
         }
+        else if (valueStr.equalsIgnoreCase("display:image"))
+        {
+            Serial.println("Display Image command received.");
+            requestedMode = IMAGE;
+        }
+        else if (valueStr.startsWith("image:begin:"))
+        {
+            // "image:begin:<raw|rle|lz>" for packed rows, "image:begin:<raw|rle|lz>:gray:<w>x<h>[:ordered]"
+            // for gray pixels dithered on the badge. Chunks follow on the image
+            // characteristic, then "image:end:<crc32 hex>".
+            static ImageChunk chunk;
+            String params = valueStr.substring(strlen("image:begin:"));
+            int colon = params.indexOf(':');
+            String codecName = colon < 0 ? params : params.substring(0, colon);
+            chunk.kind = IMAGE_CHUNK_BEGIN;
+            chunk.gray = colon >= 0;
+            chunk.dither = params.endsWith(":ordered") ? DITHER_ORDERED : DITHER_FLOYD_STEINBERG;
+            chunk.width = 0;
+            chunk.height = 0;
+            if (chunk.gray && params.startsWith(codecName + ":gray:"))
+            {
+                String size = params.substring(codecName.length() + strlen(":gray:"));
+                chunk.width = size.toInt();
+                int x = size.indexOf('x');
+                if (x > 0)
+                    chunk.height = size.substring(x + 1).toInt();
+            }
+            if ((codecName.equalsIgnoreCase("raw") || codecName.equalsIgnoreCase("rle") ||
+                 codecName.equalsIgnoreCase("lz")) &&
+                (!chunk.gray || (chunk.width > 0 && chunk.height > 0)))
+            {
+                chunk.codec = codecName.equalsIgnoreCase("rle")  ? IMAGE_PACKBITS
+                              : codecName.equalsIgnoreCase("lz") ? IMAGE_LZ
+                                                                 : IMAGE_RAW;
+                queueImageChunk(chunk);
+            }
+            else
+            {
+                Serial.println("Unknown image format. Ignoring.");
+            }
+        }
+        else if (valueStr.startsWith("image:end:"))
+        {
+            static ImageChunk chunk;
+            chunk.kind = IMAGE_CHUNK_END;
+            chunk.crc = strtoul(valueStr.substring(strlen("image:end:")).c_str(), NULL, 16);
+            queueImageChunk(chunk);
+        }
+        else if (valueStr.equalsIgnoreCase("frame:read"))
+        {
+            // The frame on the panel, as notifications on the frame characteristic (see frame_readback.h)
+            Serial.println("Frame read-back requested.");
+            frameReadRequested = true;
+        }
+        else if (valueStr.equalsIgnoreCase("display:split"))
+        {
+            Serial.println("Display Split command received.");
+            requestedMode = SPLIT_SCREEN;
+        }
+        else if (valueStr.equalsIgnoreCase("display:contact"))
+        {
+            Serial.println("Display Contact QR command received.");
+            requestedMode = CONTACT_QR;
+        }
         else if (valueStr.startsWith("data:personal:"))
         {
             String infoPayload = valueStr.substring(strlen("data:personal:"));
@@ -276,12 +624,39 @@ class DataCharacteristicCallbacks : public BLECharacteristicCallbacks
                 personalInfo = infoPayload;
                 personalInfo.replace("\\n", "\n"); // Still useful if app sends literal \\n
                 newInfoDataReceived = true;
+                infoPatchReceived = false; // Whole text: full refresh
                 clearDisplayRequested = false;
                 requestedMode = INFO;
                 dataChanged = true; // Mark that NVS needs update
                 Serial.println("Automatically requesting INFO mode.");
             }
         }
+        else if (valueStr.startsWith("data:patch:"))
+        {
+            // "data:patch:field:<n>=<text>" or "data:patch:bytes:<start>,<count>=<text>" (see info_patch.h)
+            String spec = valueStr.substring(strlen("data:patch:"));
+            spec.replace("\\n", "\n");
+            static char patched[MAX_INFO_INPUT_STRING_LENGTH + 1];
+            InfoPatch patch;
+            int32_t length = -1;
+            if (parseInfoPatch(spec.c_str(), patch))
+                length = applyInfoPatch(personalInfo.c_str(), personalInfo.length(), patch, patched,
+                                        MAX_INFO_INPUT_STRING_LENGTH);
+            if (length < 0)
+            {
+                Serial.println("Invalid or out of range patch. Ignoring.");
+            }
+            else if (personalInfo != patched)
+            {
+                personalInfo = patched;
+                newInfoDataReceived = true;
+                infoPatchReceived = true;
+                clearDisplayRequested = false;
+                requestedMode = INFO;
+                dataChanged = true; // Whole record saved, same NVS key
+                Serial.printf("Personal info patched (%ld bytes now).\n", (long)length);
+            }
+        }
         else if (valueStr.startsWith("data:qr:"))
         {
             String qrPayload = valueStr.substring(strlen("data:qr:"));
@@ -298,6 +673,45 @@ class DataCharacteristicCallbacks : public BLECharacteristicCallbacks
                 }
             }
         }
+        else if (valueStr.startsWith("config:button:"))
+        {
+            // e.g. "config:button:click=next,double=split,long=sleep"; gestures not listed keep their action
+            ButtonMapping mapping = buttonInput.mapping();
+            if (parseButtonMapping(valueStr.substring(strlen("config:button:")).c_str(), mapping))
+            {
+                buttonInput.setMapping(mapping); // Only loop() reads the map, one byte per gesture
+                preferences.begin(NVS_NAMESPACE, false);
+                preferences.putBytes(NVS_KEY_BUTTONS, &mapping, sizeof(mapping));
+                preferences.end();
+                Serial.printf("Button mapping updated and saved to NVS: click=%u double=%u long=%u\n",
+                              mapping.action[GESTURE_CLICK], mapping.action[GESTURE_DOUBLE_CLICK],
+                              mapping.action[GESTURE_LONG_PRESS]);
+            }
+            else
+            {
+                Serial.println("Invalid button mapping. Ignoring.");
+            }
+        }
+        else if (valueStr.startsWith("config:power:"))
+        {
+            // e.g. "config:power:awake=30,fast=5,wake=600,burst=3000" or "config:power:preset=beacon"
+            PowerPolicy candidate = powerPolicy;
+            if (parsePowerPolicy(valueStr.substring(strlen("config:power:")).c_str(), candidate))
+            {
+                powerPolicy = candidate;
+                newPowerPolicyReceived = true;
+                preferences.begin(NVS_NAMESPACE, false);
+                preferences.putBytes(NVS_KEY_POWER, &powerPolicy, sizeof(powerPolicy));
+                preferences.end();
+                Serial.printf("Power policy updated and saved to NVS: awake=%us fast=%us wake=%lus burst=%ums\n",
+                              powerPolicy.awakeTimeoutS, powerPolicy.fastAdvDurationS,
+                              (unsigned long)powerPolicy.timerWakePeriodS, powerPolicy.timerWakeAdvMs);
+            }
+            else
+            {
+                Serial.println("Invalid power policy. Ignoring.");
+            }
+        }
         else
         {
             Serial.println("Received unrecognized command/data format. Ignoring.");
@@ -346,6 +760,16 @@ void setup()
         personalInfo = preferences.getString(NVS_KEY_INFO, "Default Name\nDefault Title\n"); // Load or default
         qrCodeData = preferences.getString(NVS_KEY_QR, "");                                  // Load or default (empty)
         currentMode = (DisplayMode)preferences.getUInt(NVS_KEY_MODE, (unsigned int)INFO);    // Load or default
+        PowerPolicy storedPolicy;
+        if (preferences.getBytes(NVS_KEY_POWER, &storedPolicy, sizeof(storedPolicy)) == sizeof(storedPolicy) &&
+            powerPolicyValid(storedPolicy))
+        {
+            powerPolicy = storedPolicy; // Otherwise keep the default preset
+        }
+        preferences.getBytes(NVS_KEY_LAYOUT, &infoLayout, sizeof(infoLayout)); // Validated in ensureInfoLayout()
+        ButtonMapping storedMapping;
+        if (preferences.getBytes(NVS_KEY_BUTTONS, &storedMapping, sizeof(storedMapping)) == sizeof(storedMapping))
+            buttonInput.setMapping(storedMapping); // Ignored if invalid: default mapping
         preferences.end();                                                                   // Close NVS after reading
         Serial.println("[DEBUG] setup: NVS Loaded.");
         Serial.printf(" Loaded Mode: %d\n", currentMode);
@@ -358,16 +782,32 @@ void setup()
     }
     requestedMode = currentMode; // Sync requested mode
 
+    // --- Initialize Battery ADC ---
+    batteryBegin(BATT_ADC_CHANNEL, BATT_DIVIDER_RATIO);
+
+    mountUnicodeFonts();
+    if (littleFsMounted)
+    {
+        File image = LittleFS.open(IMAGE_FILE, "r");
+        imageStored = image && image.size() == Badge::FRAME_BYTES;
+        Serial.printf("[DEBUG] setup: %s\n", imageStored ? "Stored image found." : "No stored image.");
+    }
+
     // --- Initialize Display ---
     display.init(115200);
-    display.setRotation(1);
+    display.setRotation(Badge::ROTATION);
+    Serial.printf("[DEBUG] Display buffer: %u rows per page, %u page(s).\n", DISPLAY_PAGE_ROWS, DISPLAY_PAGES);
     Serial.println("[DEBUG] setup: Display initialized");
 
-    // --- Button Setup (OneButton) ---
-    button.attachClick(handleButtonClick);
+    // --- Button Setup (GPIO interrupt on both edges) ---
     // Set pinMode explicitly just in case
     pinMode(BUTTON_PIN, INPUT_PULLUP);
-    Serial.printf("Button configured on GPIO %d\n", BUTTON_PIN);
+    gestureRecognizer.begin(digitalRead(BUTTON_PIN) == LOW, millis()); // Release of the wake-up press is no click
+    loopTaskHandle = xTaskGetCurrentTaskHandle();
+    attachInterrupt(digitalPinToInterrupt(BUTTON_PIN), buttonIsr, CHANGE);
+    // Drain the edge queue while a refresh blocks, so presses become pending intents
+    display.epd2.setBusyCallback(displayBusyCallback);
+    Serial.printf("Button configured on GPIO %d (interrupt)\n", BUTTON_PIN);
 
     // --- Setup BLE (Done ONCE on boot) ---
     // We set it up fully, but only advertise when needed
@@ -377,32 +817,37 @@ void setup()
     Serial.println("[DEBUG] setup: Determining wake reason...");
     esp_sleep_wakeup_cause_t wakeup_reason;
     wakeup_reason = esp_sleep_get_wakeup_cause();
-    wakeStartTime = millis(); // Record when we woke up
+    WakeReason wakeReason = WAKE_POWER_ON;
 
     switch (wakeup_reason)
     {
     case ESP_SLEEP_WAKEUP_EXT0: // GPIO Wakeup
         Serial.println("[DEBUG] setup: Wakeup cause = Button Press (EXT0)");
-        // Button press should keep us awake longer, maybe start advertising?
+        wakeReason = WAKE_BUTTON;
         displayUpdateRequestNeeded = true; // Show current screen immediately
-        BLEDevice::startAdvertising();     // Start advertising immediately
-        Serial.println("[DEBUG] setup: Advertising started (Button Wake).");
+        break;
 
+    case ESP_SLEEP_WAKEUP_TIMER: // Periodic wake: short advertising burst, screen is unchanged
+        Serial.println("[DEBUG] setup: Wakeup cause = Timer");
+        wakeReason = WAKE_TIMER;
+        displayUpdateRequestNeeded = false;
         break;
 
     default: // Includes power-on reset
         Serial.printf("[DEBUG] setup: Wakeup cause = Power On / Other (%d)\n", wakeup_reason);
         displayUpdateRequestNeeded = true; // Initial display update on power-on
-        BLEDevice::startAdvertising();     // Start advertising on initial boot
-        Serial.println("[DEBUG] setup: Advertising started (Power On).");
-
         break;
     }
 
-    // Wake on Button Press (GPIO 39 = RTC GPIO 3)
-    // Check ESP32 datasheet/pinout for RTC GPIO mapping if BUTTON_PIN changes
-    esp_sleep_enable_ext0_wakeup(GPIO_NUM_39, 0); // 0 = Wake on LOW level
-    Serial.println("[DEBUG] setup: Button wakeup configured (EXT0 GPIO 39 LOW).");
+    // --- Start Wake Window & Advertising (per power policy) ---
+    sleepScheduler.begin(powerPolicy, wakeReason, millis());
+    applyAdvertisingPhase(sleepScheduler.advPhase(millis(), false));
+    Serial.printf("[DEBUG] setup: Advertising started. Window %lu ms, timer wake every %lu s.\n",
+                  (unsigned long)sleepScheduler.windowRemainingMs(millis()), (unsigned long)powerPolicy.timerWakePeriodS);
+
+    // Wake on Button Press (BUTTON_PIN must be an RTC GPIO, e.g. GPIO 39 = RTC GPIO 3)
+    esp_sleep_enable_ext0_wakeup((gpio_num_t)BUTTON_PIN, 0); // 0 = Wake on LOW level
+    Serial.printf("[DEBUG] setup: Button wakeup configured (EXT0 GPIO %d LOW).\n", BUTTON_PIN);
 
     // Initial Display (only if needed based on wake reason)
     if (displayUpdateRequestNeeded)
@@ -427,7 +872,40 @@ void setup()
 // ===================================================================================
 void loop()
 {
-    button.tick(); // Let the library process button state and call handleButtonClick if needed
+    pumpButtonEdges();     // Turn queued button edges into gestures
+    processButtonIntent(); // Turn the latest button intent (if any) into a mode request
+    pumpImageStream();     // Image chunks received over BLE go to the panel RAM
+    pumpFrameReadback();   // Frame read-back chunks go out as notifications
+
+    // An upload owns displayBand and the panel RAM until it ends: mode changes,
+    // clears and redraws stay pending, and the wake window cannot run out
+    if (imageStream.active())
+    {
+        if (!deviceConnected)
+            abortImageStream("disconnected");
+        else if (millis() - imageStreamLastChunkMs >= IMAGE_STREAM_IDLE_MS)
+            abortImageStream("no data");
+        else
+        {
+            waitForLoopWork();
+            return;
+        }
+    }
+
+    // --- Wake Window Events (from BLE callbacks) ---
+    if (wakeWindowRestartRequested)
+    {
+        wakeWindowRestartRequested = false;
+        sleepScheduler.restartWindow(millis());
+        currentAdvPhase = ADV_OFF; // Advertising restarts below
+        Serial.println("[DEBUG] loop: Sleep timeout timer restarted.");
+    }
+    if (newPowerPolicyReceived)
+    {
+        newPowerPolicyReceived = false;
+        sleepScheduler.setPolicy(powerPolicy, millis());
+        currentAdvPhase = ADV_OFF; // Re-apply intervals
+    }
 
     if (deviceConnected)
     {
@@ -455,32 +933,18 @@ void loop()
                 Serial.println("[DEBUG] loop(Connected): ...already blank.");
             }
             newInfoDataReceived = false; // Reset flags
+            infoPatchReceived = false;
             newQrDataReceived = false;
         }
         // Priority 2: Mode Change Request (from Button or BLE callback)
         else if (requestedMode != currentMode)
         {
             Serial.printf("[DEBUG] loop(Connected): Processing Mode Change Request: %d -> %d\n", currentMode, requestedMode);
-            bool allowSwitch = false;
-            switch (requestedMode)
+            bool allowSwitch = nextAvailableMode(requestedMode) == requestedMode;
+            if (!allowSwitch)
             {
-            case INFO:
-                allowSwitch = true;
-                break;
-            case QR_CODE:
-                if (qrCodeData.length() > 0)
-                {
-                    allowSwitch = true;
-                }
-                else
-                {
-                    Serial.println("...QR mode requested, but no QR data. Reverting.");
-                    requestedMode = currentMode;
-                }
-                break;
-            case BLANK:
-                allowSwitch = true;
-                break;
+                Serial.printf("...Mode %d requested, but it has nothing to show. Reverting.\n", requestedMode);
+                requestedMode = currentMode;
             }
 
             if (allowSwitch)
@@ -497,19 +961,28 @@ void loop()
             }
         }
         // Priority 3: New Data Received (Redundant check, but harmless)
-        else if (newInfoDataReceived && currentMode == INFO)
+        else if (newInfoDataReceived && (currentMode == INFO || currentMode == CONTACT_QR || currentMode == SPLIT_SCREEN))
         {
             Serial.println("[DEBUG] loop(Connected): Processing New Info Data for Current Screen...");
             needsRedraw = true;
         }
-        else if (newQrDataReceived && currentMode == QR_CODE)
+        else if (newQrDataReceived && (currentMode == QR_CODE || currentMode == SPLIT_SCREEN))
         {
             Serial.println("[DEBUG] loop(Connected): Processing New QR Data for Current Screen...");
             needsRedraw = true;
         }
 
+        // New personal info: encode its contact card now, not on every refresh of CONTACT_QR
+        if (newInfoDataReceived)
+            ensureContactQr();
+
+        // A patch of the INFO screen on display can be a partial refresh of the lines it changed
+        bool patchOnly = newInfoDataReceived && infoPatchReceived && previousMode == INFO && currentMode == INFO &&
+                         !displayUpdateRequestNeeded;
+
         // Consume data flags
         newInfoDataReceived = false;
+        infoPatchReceived = false;
         newQrDataReceived = false;
 
         // Save mode to NVS if changed
@@ -529,7 +1002,8 @@ void loop()
         if (shouldUpdate && currentMode != BLANK)
         { // Don't redraw if just cleared
             Serial.println("[DEBUG] loop(Connected): Updating Display...");
-            updateDisplay();
+            if (!patchOnly || !refreshPatchedInfo())
+                updateDisplay();
             Serial.println("[DEBUG] loop(Connected): Display Update Complete.");
             display.hibernate();
         }
@@ -540,30 +1014,15 @@ void loop()
         bool needsRedrawDisconnected = false;
         DisplayMode previousModeDisconnected = currentMode;
 
-        // Check for Mode Change Request triggered by Button press via button.tick() above
+        // Check for Mode Change Request triggered by Button press via processButtonIntent() above
         if (requestedMode != currentMode)
         {
             Serial.printf("[DEBUG] loop(Disconnected): Processing Mode Change Request: %d -> %d\n", currentMode, requestedMode);
-            bool allowSwitch = false;
-            switch (requestedMode)
+            bool allowSwitch = nextAvailableMode(requestedMode) == requestedMode;
+            if (!allowSwitch)
             {
-            case INFO:
-                allowSwitch = true;
-                break;
-            case QR_CODE:
-                if (qrCodeData.length() > 0)
-                {
-                    allowSwitch = true;
-                }
-                else
-                {
-                    Serial.println("...QR mode requested, but no QR data. Reverting.");
-                    requestedMode = currentMode;
-                }
-                break;
-            case BLANK:
-                allowSwitch = true;
-                break;
+                Serial.printf("...Mode %d requested, but it has nothing to show. Reverting.\n", requestedMode);
+                requestedMode = currentMode;
             }
 
             if (allowSwitch)
@@ -603,21 +1062,31 @@ void loop()
         }
         // *** END ADDED/MODIFIED SECTION ***
 
-        // Check Button/Power-On Wake Timeout
-        if (millis() - wakeStartTime >= 60000) // Example: 60 second timeout
-        {                                      // Example: 60 second timeout
-            Serial.printf("[DEBUG] loop(Disconnected): Button/Power-on wake timeout reached (%lu ms elapsed).\n", millis() - wakeStartTime);
-            Serial.println("[DEBUG] loop(Disconnected): Stopping advertising...");
-            BLEDevice::stopAdvertising();
-            Serial.println("[DEBUG] loop(Disconnected): Hibernating display...");
-            display.hibernate();
-            Serial.println("[DEBUG] loop(Disconnected): >>> ENTERING DEEP SLEEP (Button/Power-On Timeout) <<<");
-            Serial.flush();
-            esp_deep_sleep_start();
+        // Advertising phase (fast -> slow) for the current point of the wake window
+        AdvPhase advPhase = sleepScheduler.advPhase(millis(), false);
+        if (advPhase != ADV_OFF && advPhase != currentAdvPhase)
+            applyAdvertisingPhase(advPhase);
+
+        // Check Wake Window Timeout
+        if (sleepScheduler.sleepDue(millis(), false))
+        {
+            Serial.println("[DEBUG] loop(Disconnected): Wake window elapsed.");
+            enterDeepSleep("Wake Window Timeout");
         }
     }
 
-    delay(10);
+    waitForLoopWork();
+}
+
+void waitForLoopWork()
+{
+    // Sleep until the button ISR or an image chunk wakes us, a gesture timeout is due, or the idle wait expires
+    uint32_t waitMs = gestureRecognizer.msUntilDeadline(millis());
+    if (waitMs > LOOP_IDLE_WAIT_MS)
+        waitMs = LOOP_IDLE_WAIT_MS;
+    if (frameReadbackActive)
+        waitMs = 0; // More chunks to send
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs) + 1);
 }
 
 // ===================================================================================
@@ -639,7 +1108,7 @@ void setupBLE()
     // --- Create Server & Service ---
     pServer = BLEDevice::createServer();
     pServer->setCallbacks(new MyServerCallbacks()); // Handles connect/disconnect flags
-    BLEService *pService = pServer->createService(SERVICE_UUID);
+    BLEService *pService = pServer->createService(BLEUUID(SERVICE_UUID), SERVICE_HANDLES);
 
     // --- Existing WRITE Characteristic (for commands/data updates) ---
     pDataCharacteristic = pService->createCharacteristic(
@@ -697,6 +1166,28 @@ void setupBLE()
     pQrUrlCharacteristic->addDescriptor(pQrUrlDesc);
     Serial.println(" QR URL characteristic created.");
 
+    // Image Characteristic (binary chunks, see ImageCharacteristicCallbacks)
+    // Write with response only: the response is held while loop() catches up
+    pImageCharacteristic = pService->createCharacteristic(
+        IMAGE_CHARACTERISTIC_UUID,
+        BLECharacteristic::PROPERTY_WRITE);
+    pImageCharacteristic->setCallbacks(new ImageCharacteristicCallbacks());
+    BLEDescriptor *pImageDesc = new BLEDescriptor(BLEUUID((uint16_t)0x2901));
+    pImageDesc->setValue("Image Chunks (Write)");
+    pImageCharacteristic->addDescriptor(pImageDesc);
+    Serial.println(" Image characteristic created.");
+
+    // Frame Characteristic (read: summary of the frame on the panel; notify: "frame:read" chunks)
+    pFrameCharacteristic = pService->createCharacteristic(
+        FRAME_CHARACTERISTIC_UUID,
+        BLECharacteristic::PROPERTY_READ | BLECharacteristic::PROPERTY_NOTIFY);
+    pFrameCharacteristic->setCallbacks(new ReadCharacteristicCallbacks());
+    pFrameCharacteristic->addDescriptor(new BLE2902());
+    BLEDescriptor *pFrameDesc = new BLEDescriptor(BLEUUID((uint16_t)0x2901));
+    pFrameDesc->setValue("Frame Read-back (Read/Notify)");
+    pFrameCharacteristic->addDescriptor(pFrameDesc);
+    Serial.println(" Frame characteristic created.");
+
     // --- Standard Battery Service & Characteristic ---
     BLEService *pBatteryService = pServer->createService(BLEUUID((uint16_t)0x180F));
     pBatteryLevelCharacteristic = pBatteryService->createCharacteristic(
@@ -706,7 +1197,9 @@ void setupBLE()
     // Add CCCD (Client Characteristic Configuration Descriptor - UUID 0x2902)
     // This is REQUIRED for notifications to work. The library adds it implicitly usually
     // but adding manually is safer. Needs BLESecurity.h included.
-    pBatteryLevelCharacteristic->addDescriptor(new BLE2902()); // Use standard BLE2902 descriptor helper
+    pBatteryLevelCccd = new BLE2902(); // Use standard BLE2902 descriptor helper
+    pBatteryLevelCccd->setCallbacks(new BatteryCccdCallbacks());
+    pBatteryLevelCharacteristic->addDescriptor(pBatteryLevelCccd);
     Serial.println(" Battery characteristic created.");
 
     // --- Start Services ---
@@ -724,67 +1217,217 @@ void setupBLE()
 }
 
 // ===================================================================================
-// Handle Button Press Function (Callback for OneButton)
+// Button Interrupt (both edges)
 // ===================================================================================
-void handleButtonClick()
+// Only timestamps the edge; recognition happens in pumpButtonEdges().
+void IRAM_ATTR buttonIsr()
 {
-    // Cooldown Check
-    if (millis() - lastButtonActionTime < BUTTON_COOLDOWN_MS)
+    ButtonEdge edge;
+    edge.timeMs = millis();
+    edge.pressed = (digitalRead(BUTTON_PIN) == LOW); // Active LOW; re-read filters GPIO39 glitches
+    buttonEdges.push(edge);
+
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    if (loopTaskHandle != NULL)
+        vTaskNotifyGiveFromISR(loopTaskHandle, &higherPriorityTaskWoken);
+    if (higherPriorityTaskWoken)
+        portYIELD_FROM_ISR();
+}
+
+// ===================================================================================
+// Feed Queued Button Edges to the Gesture Recognizer
+// ===================================================================================
+// Edges carry their ISR timestamp, so gestures made during a blocking refresh
+// are recognized with the right timing even if they are processed later.
+void pumpButtonEdges()
+{
+    ButtonEdge edge;
+    ButtonGesture gesture;
+    uint32_t atMs;
+    while (buttonEdges.pop(edge))
+    {
+        if (gestureRecognizer.onEdge(edge.pressed, edge.timeMs, gesture, atMs))
+        {
+            Serial.printf("[DEBUG] Button Gesture Detected: %d\n", gesture);
+            buttonInput.onGesture(gesture, atMs);
+        }
+    }
+    // Timeouts (single click, long-press) and level re-sync
+    if (gestureRecognizer.poll(millis(), digitalRead(BUTTON_PIN) == LOW, gesture, atMs))
     {
-        Serial.println("[DEBUG] Button Click Ignored (Cooldown Active)");
-        return; // Exit if within cooldown period
+        Serial.printf("[DEBUG] Button Gesture Detected: %d\n", gesture);
+        buttonInput.onGesture(gesture, atMs);
     }
+    static uint32_t reportedDrops = 0;
+    if (buttonEdges.droppedCount() != reportedDrops)
+    {
+        reportedDrops = buttonEdges.droppedCount();
+        Serial.printf("[DEBUG] Button edge queue overflowed (%lu edges dropped).\n", (unsigned long)reportedDrops);
+    }
+}
 
-    // If cooldown passed, proceed:
-    Serial.println("[DEBUG] Button Click Detected (OneButton)");
-
-    // Store the mode *before* potentially changing the request
-    // to see if an actual state change is likely needed later.
-    DisplayMode modeBeforeRequest = requestedMode;
-
-    // --- Mode Switching Logic (INFO -> QR -> BLANK -> INFO) ---
-    Serial.printf("[DEBUG] Button Check: currentMode=%d, qrCodeData.length()=%d\n", currentMode, qrCodeData.length());
+// ===================================================================================
+// Display BUSY Callback (GxEPD2)
+// ===================================================================================
+void displayBusyCallback(const void *)
+{
+    pumpButtonEdges(); // Gestures made during the refresh end up as a pending intent
+}
 
-    switch (currentMode)
+// ===================================================================================
+// Mode Fallback (button cycle: INFO -> QR_CODE -> CONTACT_QR -> IMAGE -> BLANK)
+// ===================================================================================
+DisplayMode nextAvailableMode(DisplayMode mode)
+{
+    switch (mode)
     {
     case INFO:
+        return INFO;
+    case SPLIT_SCREEN:
+        if (qrCodeData.length() > 0 || ensureContactQr())
+            return SPLIT_SCREEN;
+        return BLANK; // Not part of the cycle
+    case QR_CODE:
         if (qrCodeData.length() > 0)
+            return QR_CODE;
+        // fall through - no QR data
+    case CONTACT_QR:
+        if (ensureContactQr())
+            return CONTACT_QR;
+        // fall through - personal info has no card
+    case IMAGE:
+        if (imageStored)
+            return IMAGE;
+        // fall through - no image stored
+    case BLANK:
+    default:
+        return BLANK;
+    }
+}
+
+// ===================================================================================
+// Apply Pending Button Intent
+// ===================================================================================
+void processButtonIntent()
+{
+    if (!buttonInput.hasIntent())
+        return;
+    uint32_t ageMs = buttonInput.intentAgeMs(millis());
+    ButtonAction action = buttonInput.takeIntent();
+    if (action == ACTION_NONE)
+        return; // Display still busy, keep it pending
+    sleepScheduler.restartWindow(millis()); // User is interacting, stay awake
+
+    Serial.printf("[DEBUG] Button Intent: action=%d (age %lu ms, queued during refresh so far: %u)\n",
+                  action, (unsigned long)ageMs, buttonInput.queuedWhileBusy());
+
+    switch (action)
+    {
+    case ACTION_NEXT_MODE:
+    {
+        // --- Mode Switching Logic (INFO -> QR -> CONTACT_QR -> IMAGE -> BLANK -> INFO) ---
+        Serial.printf("[DEBUG] Button Check: currentMode=%d, qrCodeData.length()=%d\n", currentMode, qrCodeData.length());
+        DisplayMode following;
+        switch (currentMode)
         {
-            requestedMode = QR_CODE;
-            Serial.println("[DEBUG] Button: Requesting QR_CODE mode.");
-        }
-        else
-        {
-            requestedMode = BLANK; // Go to blank if no QR data
-            Serial.println("[DEBUG] Button: Requesting BLANK mode (QR data missing).");
+        case INFO:
+            following = QR_CODE;
+            break;
+        case QR_CODE:
+            following = CONTACT_QR;
+            break;
+        case CONTACT_QR:
+            following = IMAGE;
+            break;
+        case BLANK:
+            following = INFO;
+            break;
+        default: // IMAGE, and SPLIT_SCREEN, which already shows everything: a click clears it
+            following = BLANK;
+            break;
         }
+        requestedMode = nextAvailableMode(following);
+        Serial.printf("[DEBUG] Button: Requesting mode %d%s.\n", requestedMode,
+                      requestedMode != following ? " (skipped screens with nothing to show)" : "");
         break;
-    case QR_CODE:
-        requestedMode = BLANK; // Next state is BLANK
-        Serial.println("[DEBUG] Button: Requesting BLANK mode (Clear).");
+    }
+    case ACTION_SHOW_INFO:
+        requestedMode = INFO;
+        Serial.println("[DEBUG] Button: Requesting INFO mode.");
         break;
-    case BLANK:
-        requestedMode = INFO; // Next state is INFO
-        Serial.println("[DEBUG] Button: Requesting INFO mode (from BLANK).");
+    case ACTION_SHOW_QR:
+        requestedMode = QR_CODE; // loop() reverts this if there is no QR data
+        Serial.println("[DEBUG] Button: Requesting QR_CODE mode.");
+        break;
+    case ACTION_SHOW_SPLIT:
+        requestedMode = SPLIT_SCREEN; // loop() reverts this if there is no QR to show
+        Serial.println("[DEBUG] Button: Requesting SPLIT_SCREEN mode.");
+        break;
+    case ACTION_SHOW_BLANK:
+        requestedMode = BLANK;
+        Serial.println("[DEBUG] Button: Requesting BLANK mode.");
+        break;
+    case ACTION_SLEEP:
+        enterDeepSleep("Button Long-Press");
         break;
     default:
-        requestedMode = INFO; // Fallback
         break;
     }
+}
+
+// ===================================================================================
+// Apply Advertising Phase (fast / slow interval)
+// ===================================================================================
+void applyAdvertisingPhase(AdvPhase phase)
+{
+    if (phase == ADV_OFF)
+        return;
+    // Intervals are in 0.625 ms units, max 10.24 s
+    uint32_t minUnits = (uint32_t)sleepScheduler.advIntervalMs(phase) * 1000 / 625;
+    uint32_t maxUnits = minUnits + minUnits / 8; // Small window lets the controller schedule around other events
+    if (maxUnits > 0x4000)
+        maxUnits = 0x4000;
+
+    BLEAdvertising *pAdvertising = BLEDevice::getAdvertising();
+    BLEDevice::stopAdvertising();
+    pAdvertising->setMinInterval((uint16_t)minUnits);
+    pAdvertising->setMaxInterval((uint16_t)maxUnits);
+    BLEDevice::startAdvertising();
+    currentAdvPhase = phase;
+    Serial.printf("[DEBUG] Advertising %s (%u ms interval).\n", phase == ADV_FAST ? "fast" : "slow", sleepScheduler.advIntervalMs(phase));
+}
 
-    // --- UPDATE ACTION TIMESTAMP ---
-    // Update only if a mode change was successfully requested AND
-    // it's different from the current mode (meaning the loop will process it)
-    // OR if the requested mode itself changed from before the switch logic ran
-    if (requestedMode != currentMode || requestedMode != modeBeforeRequest)
+// ===================================================================================
+// Enter Deep Sleep (wakes on button press, or timer if the policy has one)
+// ===================================================================================
+void enterDeepSleep(const char *reason)
+{
+    // EXT0 wakes on a LOW level, and a long-press fires with the button still
+    // down: sleeping now would wake again at once. Wait for a debounced release.
+    unsigned long waitStart = millis();
+    while (!gestureRecognizer.isReleased(millis()) && millis() - waitStart < BUTTON_RELEASE_WAIT_MS)
     {
-        lastButtonActionTime = millis(); // Start cooldown timer
-        Serial.println("[DEBUG] Cooldown timer started.");
+        pumpButtonEdges();
+        delay(10);
     }
-    else
+    if (!gestureRecognizer.isReleased(millis()))
+    {
+        // Stuck button: no button wake, or the chip would never stay asleep
+        esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_EXT0);
+        Serial.println("[DEBUG] enterDeepSleep: Button still down, button wakeup disabled.");
+    }
+    Serial.println("[DEBUG] enterDeepSleep: Stopping advertising...");
+    BLEDevice::stopAdvertising();
+    Serial.println("[DEBUG] enterDeepSleep: Hibernating display...");
+    display.hibernate();
+    if (sleepScheduler.timerWakeUs() > 0)
     {
-        Serial.println("[DEBUG] Button press resulted in no mode change request, cooldown not started.");
+        esp_sleep_enable_timer_wakeup(sleepScheduler.timerWakeUs()); // Button wake (EXT0) stays enabled
+        Serial.printf("[DEBUG] enterDeepSleep: Timer wakeup in %lu s.\n", (unsigned long)sleepScheduler.policy().timerWakePeriodS);
     }
+    Serial.printf("[DEBUG] enterDeepSleep: >>> ENTERING DEEP SLEEP (%s) <<<\n", reason);
+    Serial.flush();
+    esp_deep_sleep_start();
 }
 
 // ===================================================================================
@@ -792,15 +1435,62 @@ void handleButtonClick()
 // ===================================================================================
 void updateDisplay()
 {
+    buttonInput.setBusy(true); // Hold button intents until the refresh is done
+    partialRefreshCount = 0;
+    if (currentMode == INFO)
+        ensureInfoLayout(); // Once per content change, not per page
+    else if (currentMode == SPLIT_SCREEN)
+        ensureSplitLayout();
+    uint32_t metricCallsBefore = textMetricCalls();
+    uint16_t pageCount = 0;
+    if (currentMode == IMAGE && imageStored)
+    {
+        // Straight from flash to the panel RAM, one band at a time
+        unsigned long start = millis();
+        if (writeStoredImage(false))
+        {
+            display.epd2.refresh(false);
+            writeStoredImage(true);
+            buttonInput.setBusy(false);
+            setFrameSource(DISPLAY_PAGES == 1 ? FRAME_BAND : FRAME_STORED);
+            Serial.printf("Full display update performed for mode: %d (stored image, %lu ms)\n", currentMode,
+                          millis() - start);
+            return;
+        }
+        Serial.println("[DEBUG] Stored image unreadable.");
+        imageStored = false; // Shows the message below
+    }
+    if (USE_DISPLAY_LIST)
+    {
+        recordScreen(); // Mode switch, layout lookup and QR encoding happen here, once
+        if (!displayList.overflowed())
+        {
+            unsigned long replayUs = 0;
+            uint16_t executed = writeDisplayList(false, replayUs);
+            display.epd2.refresh(false);
+            if (DISPLAY_PAGES == 1) // The band still holds the whole frame: no second render pass
+                display.epd2.writeImageAgain(displayBand, 0, 0, GxEPD2_DRIVER_CLASS::WIDTH, DISPLAY_BAND_ROWS);
+            else
+                executed += writeDisplayList(true, replayUs);
+            buttonInput.setBusy(false);
+            setFrameSource(DISPLAY_PAGES == 1 ? FRAME_BAND : FRAME_LIST);
+            Serial.printf("Full display update performed for mode: %d (display list: %u ops, %u executed over %u bands, %lu us replay, %lu text metric calls)\n",
+                          currentMode, displayList.size(), executed, DISPLAY_PAGES, replayUs,
+                          (unsigned long)(textMetricCalls() - metricCallsBefore));
+            return;
+        }
+        Serial.println("[DEBUG] Display list overflowed, drawing page by page.");
+    }
     display.setFullWindow();
     display.firstPage();
     do
     {
+        pageCount++;
         display.fillScreen(GxEPD_WHITE); // Clear buffer for this page
         switch (currentMode)
         {
         case INFO:
-            drawInfoScreen();
+            drawInfoScreen(infoLayout, 0, Badge::WIDTH);
             break;
         case QR_CODE:
             // Only attempt to draw QR if data actually exists
@@ -813,15 +1503,82 @@ void updateDisplay()
                 // This case should ideally be prevented by the logic in loop()
                 // but as a fallback, show an error message.
                 Serial.println("Error: Tried to draw QR screen with no data!");
-                drawCenteredText("No QR Data Available", display.height() / 2, &FreeSans9pt7b, GxEPD_BLACK);
+                drawCenteredText("No QR Data Available", Badge::HEIGHT / 2, &FreeSans9pt7b, GxEPD_BLACK);
             }
             break;
+        case CONTACT_QR:
+            if (ensureContactQr())
+                drawQrModules(0, 0, Badge::WIDTH, Badge::HEIGHT, contactQrCode);
+            else
+                drawCenteredText("QR Generation Failed", Badge::HEIGHT / 2, &FreeSans9pt7b, GxEPD_BLACK);
+            break;
+        case IMAGE:
+            drawCenteredText("No Image Stored", Badge::HEIGHT / 2, &FreeSans9pt7b, GxEPD_BLACK);
+            break;
+        case SPLIT_SCREEN:
+        {
+            const QrCode *code = encodeSplitQr();
+            if (code != NULL)
+                drawQrModules(0, 0, SPLIT_QR_SIDE, Badge::HEIGHT, *code);
+            drawInfoScreen(splitLayout, SPLIT_QR_SIDE, SPLIT_TEXT_W);
+            break;
+        }
         case BLANK:
             // Already cleared by fillScreen, do nothing else
             break;
         }
     } while (display.nextPage());
-    Serial.printf("Full display update performed for mode: %d\n", currentMode);
+    buttonInput.setBusy(false);
+    setFrameSource(FRAME_UNKNOWN); // Drawn into the display's own buffer
+    Serial.printf("Full display update performed for mode: %d (%u pages, %lu text metric calls)\n",
+                  currentMode, pageCount, (unsigned long)(textMetricCalls() - metricCallsBefore));
+}
+
+// ===================================================================================
+// Partial Refresh of a Patched INFO Screen
+// ===================================================================================
+bool refreshPatchedInfo()
+{
+    // infoLayout / infoText still describe the screen on the panel (nothing relaid them since)
+    static InfoLayout before;
+    static char beforeText[sizeof(infoText)];
+    if (!GxEPD2_DRIVER_CLASS::hasFastPartialUpdate || partialRefreshCount >= PARTIAL_REFRESH_LIMIT ||
+        !infoTextReady || infoTextUsesFlashFonts || !USE_DISPLAY_LIST ||
+        !infoLayoutMatches(infoLayout, infoText, MAX_INFO_INPUT_STRING_LENGTH, Badge::WIDTH, Badge::HEIGHT))
+        return false;
+    before = infoLayout;
+    memcpy(beforeText, infoText, sizeof(infoText));
+
+    ensureInfoLayout(); // Relays the patched text (a few metric calls, see computeInfoLayout())
+    int16_t x, y, w, h;
+    uint8_t changed = infoLayoutChangedArea(before, beforeText, infoLayout, infoText, infoFontSet, x, y, w, h);
+    if (before.lineCount == 0 || infoLayout.lineCount == 0 || infoTextUsesFlashFonts)
+        return false; // "No Info" message, or Unicode glyphs the old frame did not use
+    if (changed == 0 || w == 0)
+    {
+        Serial.println("[DEBUG] Patch changed nothing on screen, no refresh.");
+        return true;
+    }
+
+    recordScreen();
+    if (displayList.overflowed())
+        return false;
+    buttonInput.setBusy(true);
+    unsigned long replayUs = 0;
+    uint16_t executed = writeDisplayList(false, replayUs); // Whole frame: unchanged lines match the old RAM
+    int16_t nx = x, ny = y, nw = w, nh = h;
+    Badge::toNative(nx, ny, nw, nh);
+    display.epd2.refresh(nx, ny, nw, nh); // GxEPD2 widens it to whole bytes (and goes full after a reset)
+    if (DISPLAY_PAGES == 1)
+        display.epd2.writeImageAgain(displayBand, 0, 0, GxEPD2_DRIVER_CLASS::WIDTH, DISPLAY_BAND_ROWS);
+    else
+        executed += writeDisplayList(true, replayUs);
+    buttonInput.setBusy(false);
+    setFrameSource(DISPLAY_PAGES == 1 ? FRAME_BAND : FRAME_LIST);
+    partialRefreshCount++;
+    Serial.printf("Partial display update: %u of %u lines changed, %dx%d at (%d,%d), %u ops executed, %u/%u before a full refresh\n",
+                  changed, infoLayout.lineCount, w, h, x, y, executed, partialRefreshCount, PARTIAL_REFRESH_LIMIT);
+    return true;
 }
 
 // ===================================================================================
@@ -830,65 +1587,490 @@ void updateDisplay()
 void performFullClear()
 {
     Serial.println("Performing full screen clear...");
+    buttonInput.setBusy(true);
     display.setFullWindow();
     display.firstPage();
     do
     {
         display.fillScreen(GxEPD_WHITE);
     } while (display.nextPage());
+    buttonInput.setBusy(false);
+    setFrameSource(FRAME_BLANK);
     Serial.println("Screen cleared.");
     currentMode = BLANK;   // Ensure state reflects the cleared screen
     requestedMode = BLANK; // Sync requested mode too
 }
 
 // ===================================================================================
-// Draw Info Screen Function (Called during FULL UPDATE)
+// Unicode Text (UTF-8 personalInfo -> 8-bit codes + glyphs cached from LittleFS)
 // ===================================================================================
-void drawInfoScreen()
+void mountUnicodeFonts()
 {
-    Serial.printf("Drawing Info Screen with data: '%s'\n", personalInfo.c_str());
-    const GFXfont *infoFont = &FreeSans12pt7b; // Use a slightly larger font
-    display.setFont(infoFont);
-    display.setTextColor(GxEPD_BLACK);
+    // Formats an empty partition, so images can be stored without "pio run -t uploadfs"
+    if (!LittleFS.begin(true))
+    {
+        Serial.println("[DEBUG] LittleFS not mounted, non-ASCII characters will show as '?', images are not stored.");
+        return;
+    }
+    littleFsMounted = true;
+    for (uint8_t i = 0; i < INFO_FONT_SIZES; i++)
+    {
+        if (unicodeFontFiles[i].open(UNICODE_FONT_FILES[i]) && unicodeFonts[i].begin(&unicodeFontFiles[i], &unicodeGlyphPool))
+        {
+            unicodeFontsAvailable = true;
+            Serial.printf("[DEBUG] Unicode font %s: %lu glyphs.\n", UNICODE_FONT_FILES[i],
+                          (unsigned long)unicodeFonts[i].glyphCount());
+        }
+    }
+}
 
-    // Basic multi-line handling (split by '\n')
-    int16_t x1, y1;
-    uint16_t w, h;
-    char textBuf[MAX_INFO_INPUT_STRING_LENGTH + 1]; // Buffer for manipulation
-    strncpy(textBuf, personalInfo.c_str(), MAX_INFO_INPUT_STRING_LENGTH);
-    textBuf[MAX_INFO_INPUT_STRING_LENGTH] = '\0'; // Ensure null termination
+void prepareInfoText()
+{
+    uint16_t length = personalInfo.length();
+    if (length > MAX_INFO_INPUT_STRING_LENGTH)
+        length = MAX_INFO_INPUT_STRING_LENGTH;
+    uint32_t hash = contentHash(personalInfo.c_str(), length);
+    if (infoTextReady && hash == infoTextSourceHash)
+        return; // Glyph caches still hold this content
+
+    SlotMap slots;
+    uint16_t textLength = transcodeUtf8(personalInfo.c_str(), length, infoText, sizeof(infoText), slots);
+    infoFontSet = INFO_FONTS;
+    infoTextUsesFlashFonts = (slots.count > 0 && unicodeFontsAvailable);
+    if (infoTextUsesFlashFonts)
+    {
+        // Smallest size first: if the pool runs out, it is a large size that
+        // lacks glyphs, and that size is replaced by a smaller one below
+        unicodeGlyphPool.used = 0;
+        bool usable[INFO_FONT_SIZES];
+        bool anyComplete = false;
+        for (uint8_t i = 0; i < INFO_FONT_SIZES; i++)
+        {
+            if (unicodeFonts[i].available())
+                unicodeFonts[i].load(infoText, textLength, slots);
+            usable[i] = unicodeFonts[i].available() && unicodeFonts[i].droppedGlyphs() == 0;
+            anyComplete = anyComplete || usable[i];
+        }
+        resetFontMetrics(); // Same GFXfont pointers, new glyphs
+        for (uint8_t i = 0; i < INFO_FONT_SIZES && !anyComplete; i++)
+            usable[i] = unicodeFonts[i].available(); // Nothing fits: blanks rather than no text
+        for (uint8_t i = 0; i < INFO_FONT_SIZES; i++)
+        {
+            // Nearest size present, smaller first
+            int8_t source = -1;
+            for (int8_t d = 0; source < 0 && d < INFO_FONT_SIZES; d++)
+            {
+                if (i - d >= 0 && usable[i - d])
+                    source = i - d;
+                else if (i + d < INFO_FONT_SIZES && usable[i + d])
+                    source = i + d;
+            }
+            infoFontSet.regular[i] = unicodeFonts[source].font();
+            infoFontSet.emphasis[i] = unicodeFonts[source].font(); // No bold Unicode set
+        }
+        uint16_t cachedGlyphs = 0, missingGlyphs = 0, droppedGlyphs = 0;
+        for (uint8_t i = 0; i < INFO_FONT_SIZES; i++)
+        {
+            cachedGlyphs += unicodeFonts[i].cachedGlyphs();
+            missingGlyphs += unicodeFonts[i].missingGlyphs();
+            droppedGlyphs += unicodeFonts[i].droppedGlyphs();
+        }
+        Serial.printf("[DEBUG] Info text: %u non-ASCII codepoints, %u glyphs cached (%u of %u bytes), "
+                      "%u missing, %u without room.\n",
+                      slots.count, cachedGlyphs, unicodeGlyphPool.used, FLASH_FONT_POOL_SIZE, missingGlyphs,
+                      droppedGlyphs);
+    }
+    else if (slots.count > 0)
+    {
+        for (uint16_t i = 0; i < textLength; i++)
+            if ((uint8_t)infoText[i] >= FLASH_FONT_SLOT_FIRST)
+                infoText[i] = '?'; // No Unicode fonts: at least show where characters are
+    }
+    infoTextSourceHash = hash;
+    infoTextReady = true;
+}
 
-    int lineCount = 0;
-    char *lines[10]; // Max 10 lines, adjust if needed
-    char *ptr = strtok(textBuf, "\n");
-    while (ptr != NULL && lineCount < 10)
+// ===================================================================================
+// Info Layout (computed once per content change, stored in NVS with the content)
+// ===================================================================================
+void ensureInfoLayout()
+{
+    prepareInfoText();
+    if (infoLayoutMatches(infoLayout, infoText, MAX_INFO_INPUT_STRING_LENGTH, Badge::WIDTH, Badge::HEIGHT) &&
+        (!infoTextUsesFlashFonts || infoLayoutFromThisBoot))
+        return; // Still valid (same content, same rotation)
+
+    uint32_t callsBefore = textMetricCalls();
+    computeInfoLayout(infoText, MAX_INFO_INPUT_STRING_LENGTH, infoFontSet,
+                      Badge::WIDTH, Badge::HEIGHT, infoLayout);
+    infoLayoutFromThisBoot = true;
+    Serial.printf("[DEBUG] Info layout recomputed: %d lines%s, %lu text metric calls.\n",
+                  infoLayout.lineCount, infoLayout.truncated ? " (truncated)" : "",
+                  (unsigned long)(textMetricCalls() - callsBefore));
+
+    // Layouts on Unicode font files are not stored: the files can change between boots
+    if (!infoTextUsesFlashFonts)
     {
-        lines[lineCount++] = ptr;
-        ptr = strtok(NULL, "\n");
+        preferences.begin(NVS_NAMESPACE, false);
+        preferences.putBytes(NVS_KEY_LAYOUT, &infoLayout, sizeof(infoLayout));
+        preferences.end();
     }
+}
+
+// Text area of the split screen: computed from the same infoText, not stored
+void ensureSplitLayout()
+{
+    prepareInfoText();
+    if (infoLayoutMatches(splitLayout, infoText, MAX_INFO_INPUT_STRING_LENGTH, SPLIT_TEXT_W, Badge::HEIGHT))
+        return;
+
+    uint32_t callsBefore = textMetricCalls();
+    computeInfoLayout(infoText, MAX_INFO_INPUT_STRING_LENGTH, infoFontSet, SPLIT_TEXT_W, Badge::HEIGHT, splitLayout);
+    Serial.printf("[DEBUG] Split layout recomputed: %d lines%s, %lu text metric calls.\n",
+                  splitLayout.lineCount, splitLayout.truncated ? " (truncated)" : "",
+                  (unsigned long)(textMetricCalls() - callsBefore));
+}
 
-    if (lineCount == 0)
+// ===================================================================================
+// Draw Info Screen Function (Called during FULL UPDATE, once per page)
+// ===================================================================================
+void drawInfoScreen(const InfoLayout &layout, int targetX, int targetW)
+{
+    // Positions and fonts come from the layout (computed for targetW), so a page only emits glyphs
+    if (layout.lineCount == 0)
     { // Handle empty string case
-        drawCenteredText("No Info", display.height() / 2, infoFont, GxEPD_BLACK);
+        drawCenteredText("No Info", Badge::HEIGHT / 2, &FreeSans12pt7b, GxEPD_BLACK, targetW, targetX);
         return;
     }
 
-    // Calculate total height needed
-    display.getTextBounds("Aj", 0, 0, &x1, &y1, &w, &h); // Get height of a typical line
-    int lineHeight = h + 5;                              // Add some spacing between lines
-    int totalTextHeight = (lineCount * h) + ((lineCount - 1) * 5);
+    const char *text = infoText;
+    display.setTextColor(GxEPD_BLACK);
+    display.setTextSize(1);
+    display.setTextWrap(false); // Layout already decided where lines go
+    uint8_t activeFont = 0xFF;
+    for (uint8_t i = 0; i < layout.lineCount; i++)
+    {
+        const InfoLine &line = layout.lines[i];
+        if (line.fontIndex != activeFont)
+        {
+            display.setFont(infoFont(infoFontSet, line.fontIndex));
+            activeFont = line.fontIndex;
+        }
+        display.setCursor(targetX + line.x, line.baselineY);
+        for (uint16_t k = 0; k < line.length; k++)
+            display.write((uint8_t)text[line.start + k]);
+    }
+}
 
-    // Calculate starting Y position for vertical centering
-    int startY = (display.height() - totalTextHeight) / 2;
-    // Ensure it doesn't start above the top edge (adjust baseline relative to top)
-    int baselineY = startY - y1; // y1 is typically negative (offset from baseline up to top)
-    if (baselineY < -y1)
-        baselineY = -y1; // Prevent drawing off the top
+// ===================================================================================
+// Display List (recorded once per refresh, replayed per band)
+// ===================================================================================
+void recordScreen()
+{
+    // Same output as the drawInfoScreen() / drawQrScreen() page loop
+    ScreenFonts fonts = {infoFontSet, &FreeSans12pt7b, &FreeSans9pt7b};
+    displayList.clear();
+    switch (currentMode)
+    {
+    case INFO:
+        recordInfoScreen(displayList, infoLayout, infoText, fonts, Badge::WIDTH, Badge::HEIGHT);
+        break;
+    case QR_CODE:
+    {
+        QrScreenStatus status = QR_SCREEN_OK;
+        if (qrCodeData.length() == 0)
+        {
+            Serial.println("Error: Tried to draw QR screen with no data!");
+            status = QR_SCREEN_NO_DATA;
+        }
+        else if (!encodeQrCode(qrCode, qrCodeData.c_str()))
+        {
+            Serial.println("QR Code drawing failed. Displaying error message.");
+            status = QR_SCREEN_FAILED;
+        }
+        recordQrScreen(displayList, status, status == QR_SCREEN_OK ? &qrCode : nullptr,
+                       status == QR_SCREEN_OK ? qrScaleFor(qrCode) : 0, fonts, Badge::WIDTH, Badge::HEIGHT);
+        break;
+    }
+    case IMAGE: // Only recorded when there is no stored image (see updateDisplay())
+        recordCenteredText(displayList, "No Image Stored", Badge::HEIGHT / 2, fonts.message, Badge::WIDTH,
+                           Badge::HEIGHT);
+        break;
+    case SPLIT_SCREEN:
+    {
+        const QrCode *code = encodeSplitQr();
+        recordSplitScreen(displayList, splitLayout, infoText, code, code != NULL ? qrScaleFor(*code) : 0, fonts,
+                          Badge::WIDTH, Badge::HEIGHT);
+        break;
+    }
+    case CONTACT_QR:
+    {
+        bool ready = ensureContactQr(); // Cached: only encodes on the first refresh after boot
+        recordQrScreen(displayList, ready ? QR_SCREEN_OK : QR_SCREEN_FAILED, ready ? &contactQrCode : nullptr,
+                       ready ? qrScaleFor(contactQrCode) : 0, fonts, Badge::WIDTH, Badge::HEIGHT);
+        break;
+    }
+    case BLANK:
+        break;
+    }
+}
 
-    // Draw each line centered horizontally
-    for (int i = 0; i < lineCount; i++)
+uint16_t writeDisplayList(bool again, unsigned long &replayUs)
+{
+    PackedFrame frame = packedFrame(displayBand, DISPLAY_BAND_STRIDE, Badge::NATIVE_WIDTH, Badge::NATIVE_HEIGHT,
+                                    Badge::ROTATION);
+    uint16_t executed = 0;
+    for (int16_t bandY = 0; bandY < Badge::NATIVE_HEIGHT; bandY += DISPLAY_BAND_ROWS)
     {
-        drawCenteredText(lines[i], baselineY + (i * lineHeight), infoFont, GxEPD_BLACK);
+        frame.bandY = bandY;
+        frame.bandH = (bandY + DISPLAY_BAND_ROWS <= Badge::NATIVE_HEIGHT) ? DISPLAY_BAND_ROWS : Badge::NATIVE_HEIGHT - bandY;
+        unsigned long start = micros();
+        frameFill(frame, false);
+        executed += displayList.replay(frame);
+        replayUs += micros() - start;
+        if (again)
+            display.epd2.writeImageAgain(displayBand, 0, bandY, GxEPD2_DRIVER_CLASS::WIDTH, frame.bandH);
+        else
+            display.epd2.writeImage(displayBand, 0, bandY, GxEPD2_DRIVER_CLASS::WIDTH, frame.bandH);
+    }
+    return executed;
+}
+
+// ===================================================================================
+// Image Screen (streamed over BLE into the panel RAM, stored in LittleFS)
+// ===================================================================================
+void queueImageChunk(const ImageChunk &chunk)
+{
+    // Never blocks the BLE task: the write response is already sent, so a full
+    // queue drops the chunk and the offset gap rejects the image at image:end
+    if (!imageChunks.push(chunk))
+        Serial.println("Image chunk dropped (queue full).");
+    if (loopTaskHandle != NULL)
+        xTaskNotifyGive(loopTaskHandle); // Decode now, not after the idle wait
+}
+
+void pumpImageStream()
+{
+    static ImageChunk chunk;
+    while (imageChunks.pop(chunk))
+    {
+        imageStreamLastChunkMs = millis();
+        switch (chunk.kind)
+        {
+        case IMAGE_CHUNK_BEGIN:
+            frameRows.bandY = -1; // The upload is decoded into displayBand
+            if (frameRows.source == FRAME_BAND)
+                setFrameSource(FRAME_UNKNOWN);
+            if (panelImageSink.file)
+                panelImageSink.file.close();
+            panelImageSink.fileOk = false;
+            if (littleFsMounted)
+            {
+                panelImageSink.file = LittleFS.open(IMAGE_TEMP_FILE, "w");
+                panelImageSink.fileOk = (bool)panelImageSink.file;
+            }
+            if (chunk.gray && !imageDither.begin(chunk.dither, chunk.width, chunk.height, Badge::NATIVE_WIDTH,
+                                                 Badge::NATIVE_HEIGHT))
+            {
+                Serial.printf("Image stream: gray size %ux%u not supported.\n", chunk.width, chunk.height);
+                imageStream.abort("bad gray size");
+                break;
+            }
+            imageStream.begin(chunk.codec, DISPLAY_BAND_STRIDE, Badge::NATIVE_HEIGHT, displayBand, DISPLAY_BAND_ROWS,
+                              &panelImageSink, chunk.gray ? &imageDither : NULL);
+            imageStreamStartMs = millis();
+            Serial.printf("Image stream started (%s%s, %lu bytes expected).\n",
+                          chunk.codec == IMAGE_PACKBITS ? "rle" : chunk.codec == IMAGE_LZ ? "lz" : "raw",
+                          !chunk.gray ? "" : chunk.dither == DITHER_ORDERED ? ", gray, ordered" : ", gray, Floyd-Steinberg",
+                          (unsigned long)imageStream.expected());
+            break;
+        case IMAGE_CHUNK_DATA:
+            if (imageStream.active() && !imageStream.feed(chunk.offset, chunk.data, chunk.length))
+                Serial.printf("Image stream stopped: %s (at %lu bytes).\n", imageStream.error(),
+                              (unsigned long)imageStream.received());
+            break;
+        case IMAGE_CHUNK_END:
+            finishImageStream(chunk.crc);
+            break;
+        }
+    }
+}
+
+void abortImageStream(const char *reason)
+{
+    imageStream.abort(reason);
+    if (panelImageSink.file)
+    {
+        panelImageSink.file.close();
+        LittleFS.remove(IMAGE_TEMP_FILE);
+    }
+    // The panel RAM is rewritten by the next refresh, the screen itself never changed
+    Serial.printf("Image stream aborted: %s (at %lu bytes).\n", reason, (unsigned long)imageStream.received());
+}
+
+void finishImageStream(uint32_t crc)
+{
+    bool ok = imageStream.finish(crc);
+    bool stored = false;
+    if (panelImageSink.file)
+    {
+        panelImageSink.file.close();
+        if (ok && panelImageSink.fileOk)
+        {
+            LittleFS.remove(IMAGE_FILE);
+            stored = LittleFS.rename(IMAGE_TEMP_FILE, IMAGE_FILE);
+        }
+        else
+            LittleFS.remove(IMAGE_TEMP_FILE);
+    }
+    if (!ok)
+    {
+        // The panel RAM is rewritten by the next refresh, the screen itself never changed
+        Serial.printf("Image rejected: %s (%lu of %lu bytes decoded).\n", imageStream.error(),
+                      (unsigned long)imageStream.decoded(), (unsigned long)imageStream.expected());
+        return;
+    }
+    imageStored = stored;
+    Serial.printf("Image received: %lu bytes sent for %lu, %lu ms, %s.\n", (unsigned long)imageStream.received(),
+                  (unsigned long)imageStream.expected(), millis() - imageStreamStartMs, stored ? "stored" : "NOT stored");
+
+    // The frame is already in the panel RAM: refresh without drawing anything
+    buttonInput.setBusy(true);
+    display.epd2.refresh(false);
+    if (stored)
+        writeStoredImage(true); // Previous-frame RAM for the next update
+    buttonInput.setBusy(false);
+    setFrameSource(DISPLAY_PAGES == 1 ? FRAME_BAND : stored ? FRAME_STORED : FRAME_UNKNOWN);
+    display.hibernate();
+    clearDisplayRequested = false;
+    currentMode = requestedMode = IMAGE;
+    preferences.begin(NVS_NAMESPACE, false);
+    preferences.putUInt(NVS_KEY_MODE, (unsigned int)currentMode);
+    preferences.end();
+}
+
+bool writeStoredImage(bool again)
+{
+    File file = LittleFS.open(IMAGE_FILE, "r");
+    if (!file || file.size() != Badge::FRAME_BYTES)
+        return false;
+    for (int16_t bandY = 0; bandY < Badge::NATIVE_HEIGHT; bandY += DISPLAY_BAND_ROWS)
+    {
+        int16_t rows = (bandY + DISPLAY_BAND_ROWS <= Badge::NATIVE_HEIGHT) ? DISPLAY_BAND_ROWS : Badge::NATIVE_HEIGHT - bandY;
+        size_t bytes = (size_t)rows * DISPLAY_BAND_STRIDE;
+        if (file.read(displayBand, bytes) != bytes)
+            return false;
+        if (again)
+            display.epd2.writeImageAgain(displayBand, 0, bandY, GxEPD2_DRIVER_CLASS::WIDTH, rows);
+        else
+            display.epd2.writeImage(displayBand, 0, bandY, GxEPD2_DRIVER_CLASS::WIDTH, rows);
+    }
+    return true;
+}
+
+// ===================================================================================
+// Frame Read-back (the frame on the panel, back over BLE, see frame_readback.h)
+// ===================================================================================
+const uint8_t *PanelFrameRows::readRow(uint16_t y)
+{
+    static uint8_t whiteRow[DISPLAY_BAND_STRIDE];
+    switch (source)
+    {
+    case FRAME_BAND:
+        return displayBand + (size_t)y * DISPLAY_BAND_STRIDE;
+    case FRAME_BLANK:
+        memset(whiteRow, 0xFF, sizeof(whiteRow));
+        return whiteRow;
+    case FRAME_LIST:
+    case FRAME_STORED:
+        break;
+    default:
+        return NULL;
+    }
+    // Paged builds: bring the row's band into displayBand (not needed again until the next refresh)
+    int16_t wantedY = y / DISPLAY_BAND_ROWS * DISPLAY_BAND_ROWS;
+    if (bandY != wantedY)
+    {
+        int16_t rows = (wantedY + DISPLAY_BAND_ROWS <= Badge::NATIVE_HEIGHT) ? DISPLAY_BAND_ROWS : Badge::NATIVE_HEIGHT - wantedY;
+        bandY = -1;
+        if (source == FRAME_LIST)
+        {
+            PackedFrame frame = packedFrame(displayBand, DISPLAY_BAND_STRIDE, Badge::NATIVE_WIDTH,
+                                            Badge::NATIVE_HEIGHT, Badge::ROTATION);
+            frame.bandY = wantedY;
+            frame.bandH = rows;
+            frameFill(frame, false);
+            displayList.replay(frame);
+        }
+        else
+        {
+            if (wantedY == 0 || !file)
+            {
+                if (file)
+                    file.close();
+                file = LittleFS.open(IMAGE_FILE, "r");
+            }
+            size_t bytes = (size_t)rows * DISPLAY_BAND_STRIDE;
+            if (!file || !file.seek((size_t)wantedY * DISPLAY_BAND_STRIDE) || file.read(displayBand, bytes) != bytes)
+                return NULL;
+        }
+        bandY = wantedY;
+    }
+    return displayBand + (size_t)(y - bandY) * DISPLAY_BAND_STRIDE;
+}
+
+void setFrameSource(FrameSource source)
+{
+    frameRows.source = source;
+    frameRows.bandY = -1;
+    if (frameRows.file)
+        frameRows.file.close();
+    uint32_t crc = 0, bytes = 0;
+    unsigned long start = micros();
+    if (source != FRAME_UNKNOWN &&
+        FrameReadback::summarize(&frameRows, DISPLAY_BAND_STRIDE, Badge::NATIVE_HEIGHT, crc, bytes))
+        snprintf(frameSummary, sizeof(frameSummary), "%08lx:%lu:%ux%u", (unsigned long)crc, (unsigned long)bytes,
+                 DISPLAY_BAND_STRIDE, Badge::NATIVE_HEIGHT);
+    else
+        strcpy(frameSummary, "none");
+    Serial.printf("[DEBUG] Frame source %d: %s (%lu us)\n", source, frameSummary, micros() - start);
+    if (frameReadbackActive)
+        frameReadback.begin(&frameRows, DISPLAY_BAND_STRIDE, Badge::NATIVE_HEIGHT); // Resent from offset 0
+}
+
+void pumpFrameReadback()
+{
+    static uint8_t record[4 + FRAME_CHUNK_MAX];
+    if (frameReadRequested)
+    {
+        frameReadRequested = false;
+        frameRows.bandY = -1;
+        frameReadback.begin(&frameRows, DISPLAY_BAND_STRIDE, Badge::NATIVE_HEIGHT);
+        frameReadbackActive = true;
+    }
+    if (!frameReadbackActive || imageStream.active())
+        return; // An upload is decoded into displayBand: wait for it
+    if (!deviceConnected)
+    {
+        frameReadbackActive = false;
+        Serial.println("Frame read-back stopped (disconnected).");
+        return;
+    }
+    // As much as one notification of the negotiated MTU holds: 3 bytes ATT header, 4 bytes offset
+    uint16_t mtu = pServer->getPeerMTU(pServer->getConnId());
+    uint16_t maxData = mtu < 23 ? 16 : mtu - 7 > FRAME_CHUNK_MAX ? FRAME_CHUNK_MAX : mtu - 7;
+    for (uint8_t i = 0; i < FRAME_NOTIFIES_PER_LOOP; i++)
+    {
+        uint16_t length = frameReadback.next(record, maxData);
+        if (length == 0)
+        {
+            frameReadbackActive = false;
+            Serial.printf("Frame read-back %s: %lu bytes in chunks of %u.\n",
+                          frameReadback.failed() ? "failed" : "sent", (unsigned long)frameReadback.sent(), maxData);
+            return;
+        }
+        pFrameCharacteristic->setValue(record, length);
+        pFrameCharacteristic->notify();
     }
 }
 
@@ -899,13 +2081,13 @@ void drawQrScreen()
 {
     // Use the global qrCodeData
     Serial.printf("Drawing QR Screen for: '%s'\n", qrCodeData.c_str());
-    bool qrSuccess = drawQrCode(0, 0, display.width(), display.height(), qrCodeData.c_str());
+    bool qrSuccess = drawQrCode(0, 0, Badge::WIDTH, Badge::HEIGHT, qrCodeData.c_str());
 
     if (!qrSuccess)
     {
         Serial.println("QR Code drawing failed. Displaying error message.");
         // Use a standard font for the error message
-        drawCenteredText("QR Generation Failed", display.height() / 2, &FreeSans9pt7b, GxEPD_BLACK);
+        drawCenteredText("QR Generation Failed", Badge::HEIGHT / 2, &FreeSans9pt7b, GxEPD_BLACK);
     }
     else
     {
@@ -928,7 +2110,7 @@ void drawCenteredText(const char *text, int baselineY, const GFXfont *font, uint
     display.setTextSize(1);
     display.getTextBounds(text, 0, 0, &x1, &y1, &w, &h); // x1,y1 are offsets from cursor pos to top-left; w,h are bounds size
 
-    int areaWidth = (targetW <= 0) ? display.width() : targetW;
+    int areaWidth = (targetW <= 0) ? Badge::WIDTH : targetW;
     int areaOriginX = (targetW <= 0) ? 0 : targetX;
 
     // Calculate cursor X to center the text's bounding box
@@ -939,8 +2121,8 @@ void drawCenteredText(const char *text, int baselineY, const GFXfont *font, uint
     // Adjust Y baseline if needed (e.g., prevent drawing off screen)
     if (baselineY < -y1)
         baselineY = -y1; // Make sure top of text isn't above screen (y1 is negative)
-    if (baselineY > display.height() - (h + y1))
-        baselineY = display.height() - (h + y1); // Prevent bottom going off screen
+    if (baselineY > Badge::HEIGHT - (h + y1))
+        baselineY = Badge::HEIGHT - (h + y1); // Prevent bottom going off screen
 
     display.setCursor(cursorX, baselineY);
     display.print(text);
@@ -952,52 +2134,20 @@ void drawCenteredText(const char *text, int baselineY, const GFXfont *font, uint
 bool drawQrCode(int x_target_area, int y_target_area, int w_target_area, int h_target_area, const char *text)
 {
     // (Function remains the same as previous version, just ensure logging is clear)
-    if (text == NULL || text[0] == '\0')
-    {
-        Serial.println("QR Error: No text provided.");
-        return false;
-    }
-    int inputLength = strlen(text);
-    if (inputLength > MAX_QR_INPUT_STRING_LENGTH)
-    {
-        Serial.printf("QR Error: Input text too long (%d > %d).\n", inputLength, MAX_QR_INPUT_STRING_LENGTH);
-        return false;
-    }
-    Serial.printf("Generating QR Code for: '%s' (Length: %d)\n", text, inputLength);
-
-    // --- QR Code Generation ---
-    // Ensure sufficient buffer. qrcode_getBufferSize is recommended.
-    uint32_t bufferSize = qrcode_getBufferSize(FIXED_QR_VERSION);
-    if (bufferSize == 0)
-    {
-        Serial.printf("QR Error: Could not get buffer size for version %d.\n", FIXED_QR_VERSION);
+    QrCode qrcode;
+    if (!encodeQrCode(qrcode, text))
         return false;
-    }
-    // Dynamically allocate if large, or use large static/stack buffer if feasible
-    const int MAX_STACK_QR_BUFFER = 4096; // Adjust based on ESP32 memory
-    if (bufferSize > MAX_STACK_QR_BUFFER)
-    {
-        Serial.printf("QR Error: Calculated buffer size (%d) too large for stack buffer (%d).\n", bufferSize, MAX_STACK_QR_BUFFER);
-        // Consider dynamic allocation here if needed: uint8_t* qrcodeData = new uint8_t[bufferSize];
-        // Remember to delete[] qrcodeData; later!
-        return false;
-    }
-    uint8_t qrcodeData[bufferSize]; // Use stack allocation if size is acceptable
-
-    QRCode qrcode;
-    // ECC_LOW allows more data, ECC_MEDIUM/ECC_QUARTILE/ECC_HIGH provide better error correction
-    esp_err_t err = qrcode_initText(&qrcode, qrcodeData, FIXED_QR_VERSION, ECC_LOW, text);
-    if (err != ESP_OK)
-    {
-        Serial.printf("QR Error: qrcode_initText failed. Error code: %d. Input may be too long for Version %d/ECC_LOW.\n", err, FIXED_QR_VERSION);
-        // If using dynamic allocation, delete[] qrcodeData here.
-        return false;
-    }
     Serial.printf("QR generated: Version=%d, Size=%dx%d modules\n", qrcode.version, qrcode.size, qrcode.size);
+    drawQrModules(x_target_area, y_target_area, w_target_area, h_target_area, qrcode);
+    return true; // Success
+}
 
+// Draws an encoded code centered in the target area, at qrScaleFor() pixels per module
+void drawQrModules(int x_target_area, int y_target_area, int w_target_area, int h_target_area, const QrCode &qrcode)
+{
     // --- QR Code Drawing ---
     int qr_modules_size = qrcode.size;
-    int module_pixel_size = FIXED_QR_SCALE; // Scale factor
+    int module_pixel_size = qrScaleFor(qrcode); // Scale factor
     int final_qr_pixel_size = qr_modules_size * module_pixel_size;
 
     // Calculate centering offset within the target area
@@ -1024,12 +2174,12 @@ bool drawQrCode(int x_target_area, int y_target_area, int w_target_area, int h_t
     {
         for (int x = 0; x < qr_modules_size; x++)
         {
-            if (qrcode_getModule(&qrcode, x, y))
+            if (qrModule(qrcode, x, y))
             { // Check if module is black
                 int moduleX = x_offset + x * module_pixel_size;
                 int moduleY = y_offset + y * module_pixel_size;
                 // Draw the scaled module (rectangle) - check bounds!
-                if (moduleX + module_pixel_size <= display.width() && moduleY + module_pixel_size <= display.height())
+                if (moduleX + module_pixel_size <= Badge::WIDTH && moduleY + module_pixel_size <= Badge::HEIGHT)
                 {
                     display.fillRect(moduleX, moduleY, module_pixel_size, module_pixel_size, GxEPD_BLACK);
                 }
@@ -1037,52 +2187,120 @@ bool drawQrCode(int x_target_area, int y_target_area, int w_target_area, int h_t
         }
     }
     // display.endWrite(); // GxEPD2 manages this
+}
 
-    // If using dynamic allocation: delete[] qrcodeData;
-    return true; // Success
+bool encodeQrCode(QrCode &code, const char *text)
+{
+    if (text == NULL || text[0] == '\0')
+    {
+        Serial.println("QR Error: No text provided.");
+        return false;
+    }
+    int inputLength = strlen(text);
+    if (inputLength > MAX_QR_INPUT_STRING_LENGTH)
+    {
+        Serial.printf("QR Error: Input text too long (%d > %d).\n", inputLength, MAX_QR_INPUT_STRING_LENGTH);
+        return false;
+    }
+    Serial.printf("Generating QR Code for: '%s' (Length: %d)\n", text, inputLength);
+
+    // QR_ECC_LOW allows more data, QR_ECC_MEDIUM/QUARTILE/HIGH provide better error correction
+    unsigned long start = micros();
+    if (!qrEncodeText(code, text, MAX_QR_VERSION, QR_ECC_LOW))
+    {
+        Serial.printf("QR Error: Input may be too long for Version %d/ECC_LOW.\n", MAX_QR_VERSION);
+        return false;
+    }
+    Serial.printf("QR encoded in %lu us: version %d, %d segments (%u bits), scale %d, mask %d, %u of %u lines scored\n",
+                  micros() - start, code.version, code.segments, code.dataBits, qrScaleFor(code), code.mask,
+                  qrLinesScored(), 8 * 2 * code.size);
+    return true;
+}
+
+bool ensureContactQr()
+{
+    uint16_t length = personalInfo.length();
+    if (length > MAX_INFO_INPUT_STRING_LENGTH)
+        length = MAX_INFO_INPUT_STRING_LENGTH;
+    uint32_t hash = contentHash(personalInfo.c_str(), length);
+    if (contactQrChecked && hash == contactQrSourceHash)
+        return contactQrReady;
+
+    // Best ECC level for the smallest version: same module size, survives scuffs better
+    unsigned long start = micros();
+    contactQrReady = encodeContactCard(contactQrCode, personalInfo.c_str(), length, MAX_QR_VERSION,
+                                       contactCardText, sizeof(contactCardText));
+    contactQrSourceHash = hash;
+    contactQrChecked = true;
+    if (contactQrReady)
+        Serial.printf("Contact QR encoded in %lu us: '%s' (%u chars), version %d, ECC %c, scale %d\n",
+                      micros() - start, contactCardText, (unsigned)strlen(contactCardText), contactQrCode.version,
+                      "LMQH"[contactQrCode.ecc], qrScaleFor(contactQrCode));
+    else
+        Serial.println("Contact QR: personal info has no name, or the card does not fit.");
+    return contactQrReady;
+}
+
+const QrCode *encodeSplitQr()
+{
+    // The pushed QR data if there is any, otherwise the contact card
+    if (qrCodeData.length() > 0)
+    {
+        if (encodeQrCode(qrCode, qrCodeData.c_str()))
+            return &qrCode;
+        Serial.println("Split screen: QR data did not encode, drawing the text only.");
+        return NULL;
+    }
+    return ensureContactQr() ? &contactQrCode : NULL;
+}
+
+int qrScaleFor(const QrCode &code)
+{
+    return Badge::qrScale(code.size, QR_QUIET_ZONE_MODULES);
 }
 
 // Function to read battery voltage and convert to percentage
 uint8_t readBatteryLevel()
 {
-    // Configure ADC (might be needed once in setup if not default)
-    // analogReadResolution(12); // 12-bit ADC
-    // analogSetAttenuation(ADC_11db); // Set attenuation based on voltage divider (if any)
-
-    uint16_t adc_value = analogRead(BATT_ADC_PIN);
-    // Simple mapping assuming direct connection or known divider
-    // Adjust the multiplier based on your board's voltage divider (if any)
-    // Example: If ADC pin reads half the battery voltage, multiply by 2.
-    // Check LilyGo T5 V2.3.1 schematic for battery circuit! Often uses a voltage divider.
-    // Common dividers result in needing to multiply ADC voltage reading by ~2 or slightly more.
-    // Let's assume a rough factor for now - **THIS NEEDS CALIBRATION**
-    float voltage = adc_value * (3.3 / 4095.0) * 2.0; // Example: *2 for half-voltage divider
-
-    // Clamp voltage to expected min/max
-    if (voltage < BATT_VOLTAGE_MIN)
-        voltage = BATT_VOLTAGE_MIN;
-    if (voltage > BATT_VOLTAGE_MAX)
-        voltage = BATT_VOLTAGE_MAX;
-
-    // Calculate percentage
-    uint8_t percentage = (uint8_t)(((voltage - BATT_VOLTAGE_MIN) / (BATT_VOLTAGE_MAX - BATT_VOLTAGE_MIN)) * 100.0);
-
-    // Serial.printf("ADC: %d, Voltage: %.2fV, Percentage: %d%%\n", adc_value, voltage, percentage); // Debug
+    // Calibrated, oversampled and filtered; percent from the LiPo discharge curve (see battery.cpp)
+    uint8_t percentage = batteryReadPercent();
+    // Serial.printf("Battery Percentage: %d%%\n", percentage); // Debug
     return percentage;
 }
 
-// Function to send battery notification if connected and interval passed
+// Function to send battery notification if connected, subscribed and the level changed
 void sendBatteryNotification()
 {
-    if (deviceConnected && pBatteryLevelCharacteristic != NULL)
+    if (!deviceConnected || pBatteryLevelCharacteristic == NULL)
+        return;
+
+    bool subscribed = (pBatteryLevelCccd != NULL) && pBatteryLevelCccd->getNotifications();
+    if (batterySubscriptionChanged)
     {
-        if (millis() - lastBatteryUpdateTime >= BATTERY_UPDATE_INTERVAL_MS)
-        {
-            uint8_t level = readBatteryLevel();
-            Serial.printf("[DEBUG] sendBatteryNotification: Interval passed. Level=%d%%. Notifying...\n", level);
-            pBatteryLevelCharacteristic->setValue(&level, 1); // Set value (pointer to byte, length 1)
-            pBatteryLevelCharacteristic->notify();            // Send notification
-            lastBatteryUpdateTime = millis();                 // Reset timer
-        }
+        batterySubscriptionChanged = false;
+        Serial.printf("[DEBUG] sendBatteryNotification: Client %s battery notifications.\n", subscribed ? "subscribed to" : "unsubscribed from");
+        if (subscribed)
+            batteryReporter.requestImmediate(); // Send the current level right away
+    }
+
+    bool immediate = subscribed && batteryReporter.wantsImmediate();
+    if (!immediate && millis() - lastBatteryUpdateTime < BATTERY_UPDATE_INTERVAL_MS)
+        return;
+    lastBatteryUpdateTime = millis(); // Reset timer
+
+    if (!subscribed)
+    {
+        batteryReporter.noteSkippedSample(); // Nobody listening: don't even wake the ADC
+        return;
     }
-}
\ No newline at end of file
+
+    uint8_t level = readBatteryLevel();
+    if (!batteryReporter.offer(level))
+        return; // Within the hysteresis band, nothing new to say
+
+    Serial.printf("[DEBUG] sendBatteryNotification: Level=%d%%. Notifying (%lu radio events saved so far)...\n",
+                  level, (unsigned long)batteryReporter.radioEventsSaved());
+    pBatteryLevelCharacteristic->setValue(&level, 1); // Set value (pointer to byte, length 1)
+    pBatteryLevelCharacteristic->notify();            // Send notification
+    batteryNoteRadioActivity();                       // Keep the next ADC burst off this TX
+}
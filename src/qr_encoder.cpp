@@ -0,0 +1,775 @@
+/**
+ * @file qr_encoder.cpp
+ * @brief Word-per-row QR encoder (see qr_encoder.h).
+ *        Bit 63 - x of a row word is module x; bits past the symbol stay 0.
+ */
+#include "qr_encoder.h"
+
+#include <string.h>
+
+// GF(256) with the QR polynomial x^8 + x^4 + x^3 + x^2 + 1: antilog (exp)
+// and log tables, so a product is one add of logs
+static const uint8_t GF_EXP[256] = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1D, 0x3A, 0x74, 0xE8, 0xCD, 0x87, 0x13, 0x26,
+    0x4C, 0x98, 0x2D, 0x5A, 0xB4, 0x75, 0xEA, 0xC9, 0x8F, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0,
+    0x9D, 0x27, 0x4E, 0x9C, 0x25, 0x4A, 0x94, 0x35, 0x6A, 0xD4, 0xB5, 0x77, 0xEE, 0xC1, 0x9F, 0x23,
+    0x46, 0x8C, 0x05, 0x0A, 0x14, 0x28, 0x50, 0xA0, 0x5D, 0xBA, 0x69, 0xD2, 0xB9, 0x6F, 0xDE, 0xA1,
+    0x5F, 0xBE, 0x61, 0xC2, 0x99, 0x2F, 0x5E, 0xBC, 0x65, 0xCA, 0x89, 0x0F, 0x1E, 0x3C, 0x78, 0xF0,
+    0xFD, 0xE7, 0xD3, 0xBB, 0x6B, 0xD6, 0xB1, 0x7F, 0xFE, 0xE1, 0xDF, 0xA3, 0x5B, 0xB6, 0x71, 0xE2,
+    0xD9, 0xAF, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0D, 0x1A, 0x34, 0x68, 0xD0, 0xBD, 0x67, 0xCE,
+    0x81, 0x1F, 0x3E, 0x7C, 0xF8, 0xED, 0xC7, 0x93, 0x3B, 0x76, 0xEC, 0xC5, 0x97, 0x33, 0x66, 0xCC,
+    0x85, 0x17, 0x2E, 0x5C, 0xB8, 0x6D, 0xDA, 0xA9, 0x4F, 0x9E, 0x21, 0x42, 0x84, 0x15, 0x2A, 0x54,
+    0xA8, 0x4D, 0x9A, 0x29, 0x52, 0xA4, 0x55, 0xAA, 0x49, 0x92, 0x39, 0x72, 0xE4, 0xD5, 0xB7, 0x73,
+    0xE6, 0xD1, 0xBF, 0x63, 0xC6, 0x91, 0x3F, 0x7E, 0xFC, 0xE5, 0xD7, 0xB3, 0x7B, 0xF6, 0xF1, 0xFF,
+    0xE3, 0xDB, 0xAB, 0x4B, 0x96, 0x31, 0x62, 0xC4, 0x95, 0x37, 0x6E, 0xDC, 0xA5, 0x57, 0xAE, 0x41,
+    0x82, 0x19, 0x32, 0x64, 0xC8, 0x8D, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xDD, 0xA7, 0x53, 0xA6,
+    0x51, 0xA2, 0x59, 0xB2, 0x79, 0xF2, 0xF9, 0xEF, 0xC3, 0x9B, 0x2B, 0x56, 0xAC, 0x45, 0x8A, 0x09,
+    0x12, 0x24, 0x48, 0x90, 0x3D, 0x7A, 0xF4, 0xF5, 0xF7, 0xF3, 0xFB, 0xEB, 0xCB, 0x8B, 0x0B, 0x16,
+    0x2C, 0x58, 0xB0, 0x7D, 0xFA, 0xE9, 0xCF, 0x83, 0x1B, 0x36, 0x6C, 0xD8, 0xAD, 0x47, 0x8E, 0x01,
+};
+static const uint8_t GF_LOG[256] = {
+    0x00, 0x00, 0x01, 0x19, 0x02, 0x32, 0x1A, 0xC6, 0x03, 0xDF, 0x33, 0xEE, 0x1B, 0x68, 0xC7, 0x4B,
+    0x04, 0x64, 0xE0, 0x0E, 0x34, 0x8D, 0xEF, 0x81, 0x1C, 0xC1, 0x69, 0xF8, 0xC8, 0x08, 0x4C, 0x71,
+    0x05, 0x8A, 0x65, 0x2F, 0xE1, 0x24, 0x0F, 0x21, 0x35, 0x93, 0x8E, 0xDA, 0xF0, 0x12, 0x82, 0x45,
+    0x1D, 0xB5, 0xC2, 0x7D, 0x6A, 0x27, 0xF9, 0xB9, 0xC9, 0x9A, 0x09, 0x78, 0x4D, 0xE4, 0x72, 0xA6,
+    0x06, 0xBF, 0x8B, 0x62, 0x66, 0xDD, 0x30, 0xFD, 0xE2, 0x98, 0x25, 0xB3, 0x10, 0x91, 0x22, 0x88,
+    0x36, 0xD0, 0x94, 0xCE, 0x8F, 0x96, 0xDB, 0xBD, 0xF1, 0xD2, 0x13, 0x5C, 0x83, 0x38, 0x46, 0x40,
+    0x1E, 0x42, 0xB6, 0xA3, 0xC3, 0x48, 0x7E, 0x6E, 0x6B, 0x3A, 0x28, 0x54, 0xFA, 0x85, 0xBA, 0x3D,
+    0xCA, 0x5E, 0x9B, 0x9F, 0x0A, 0x15, 0x79, 0x2B, 0x4E, 0xD4, 0xE5, 0xAC, 0x73, 0xF3, 0xA7, 0x57,
+    0x07, 0x70, 0xC0, 0xF7, 0x8C, 0x80, 0x63, 0x0D, 0x67, 0x4A, 0xDE, 0xED, 0x31, 0xC5, 0xFE, 0x18,
+    0xE3, 0xA5, 0x99, 0x77, 0x26, 0xB8, 0xB4, 0x7C, 0x11, 0x44, 0x92, 0xD9, 0x23, 0x20, 0x89, 0x2E,
+    0x37, 0x3F, 0xD1, 0x5B, 0x95, 0xBC, 0xCF, 0xCD, 0x90, 0x87, 0x97, 0xB2, 0xDC, 0xFC, 0xBE, 0x61,
+    0xF2, 0x56, 0xD3, 0xAB, 0x14, 0x2A, 0x5D, 0x9E, 0x84, 0x3C, 0x39, 0x53, 0x47, 0x6D, 0x41, 0xA2,
+    0x1F, 0x2D, 0x43, 0xD8, 0xB7, 0x7B, 0xA4, 0x76, 0xC4, 0x17, 0x49, 0xEC, 0x7F, 0x0C, 0x6F, 0xF6,
+    0x6C, 0xA1, 0x3B, 0x52, 0x29, 0x9D, 0x55, 0xAA, 0xFB, 0x60, 0x86, 0xB1, 0xBB, 0xCC, 0x3E, 0x5A,
+    0xCB, 0x59, 0x5F, 0xB0, 0x9C, 0xA9, 0xA0, 0x51, 0x0B, 0xF5, 0x16, 0xEB, 0x7A, 0x75, 0x2C, 0xD7,
+    0x4F, 0xAE, 0xD5, 0xE9, 0xE6, 0xE7, 0xAD, 0xE8, 0x74, 0xD6, 0xF4, 0xEA, 0xA8, 0x50, 0x58, 0xAF,
+};
+
+// Per ECC level (LOW, MEDIUM, QUARTILE, HIGH), versions 1..QR_MAX_VERSION
+static const uint8_t ECC_CODEWORDS_PER_BLOCK[4][QR_MAX_VERSION] = {
+    {7, 10, 15, 20, 26, 18, 20, 24, 30, 18},
+    {10, 16, 26, 18, 24, 16, 18, 22, 22, 26},
+    {13, 22, 18, 26, 18, 24, 18, 22, 20, 24},
+    {17, 28, 22, 16, 22, 28, 26, 26, 24, 28}};
+static const uint8_t ECC_BLOCKS[4][QR_MAX_VERSION] = {
+    {1, 1, 1, 1, 1, 2, 2, 2, 2, 4},
+    {1, 1, 1, 2, 2, 4, 4, 4, 5, 5},
+    {1, 1, 2, 2, 4, 4, 6, 6, 8, 8},
+    {1, 1, 2, 4, 4, 4, 5, 6, 8, 8}};
+static const uint8_t ECC_FORMAT_BITS[4] = {1, 0, 3, 2};
+static const uint8_t MAX_ECC_PER_BLOCK = 30;
+
+// Alignment pattern centers (0 ends the list), versions 1..QR_MAX_VERSION
+static const uint8_t ALIGNMENT_POSITIONS[QR_MAX_VERSION][4] = {
+    {0}, {6, 18}, {6, 22}, {6, 26}, {6, 30}, {6, 34}, {6, 22, 38}, {6, 24, 42}, {6, 26, 46}, {6, 28, 50}};
+
+// Penalty weights (ISO/IEC 18004 8.8.2)
+static const uint16_t PENALTY_N1 = 3;
+static const uint16_t PENALTY_N2 = 3;
+static const uint16_t PENALTY_N3 = 40;
+static const uint16_t PENALTY_N4 = 10;
+
+static const uint8_t ROW_BITS = 64;
+static const uint8_t MASK_PERIOD = 12; // Every mask repeats every 12 rows / columns
+
+// Segment modes, in segmentation order, and their mode indicators
+enum QrMode : uint8_t
+{
+    MODE_NUMERIC,
+    MODE_ALPHANUMERIC,
+    MODE_BYTE,
+    MODE_COUNT
+};
+static const uint8_t MODE_INDICATOR[MODE_COUNT] = {1, 2, 4};
+// Bits per character in sixths (10 per 3 digits, 11 per 2 characters, 8)
+static const uint8_t MODE_SIXTHS[MODE_COUNT] = {20, 33, 48};
+
+// Working matrix: rows and the same matrix transposed (columns), each as
+// module values without the mask and as the function module map
+static uint64_t baseRows[ROW_BITS], baseCols[ROW_BITS];
+static uint64_t funcRows[ROW_BITS], funcCols[ROW_BITS];
+static uint8_t charModes[QR_MAX_TEXT_LENGTH]; // Segmentation back pointers, then the chosen modes
+static uint8_t dataCodewords[QR_MAX_CODEWORDS];
+static uint8_t allCodewords[QR_MAX_CODEWORDS];
+static uint16_t linesScored = 0;
+
+static inline uint64_t moduleBit(uint8_t x)
+{
+    return (uint64_t)1 << (ROW_BITS - 1 - x);
+}
+
+static inline uint8_t popcount(uint64_t v)
+{
+    return (uint8_t)__builtin_popcountll(v);
+}
+
+static uint16_t rawDataModules(uint8_t version)
+{
+    uint16_t result = (16 * version + 128) * version + 64;
+    if (version >= 2)
+    {
+        uint8_t alignments = version / 7 + 2;
+        result -= (25 * alignments - 10) * alignments - 55;
+        if (version >= 7)
+            result -= 36; // Two version blocks
+    }
+    return result;
+}
+
+static uint16_t dataCodewordCount(uint8_t version, QrEcc ecc)
+{
+    return rawDataModules(version) / 8 -
+           ECC_CODEWORDS_PER_BLOCK[ecc][version - 1] * ECC_BLOCKS[ecc][version - 1];
+}
+
+uint16_t qrDataCapacityBits(uint8_t version, QrEcc ecc)
+{
+    if (version < 1 || version > QR_MAX_VERSION || ecc > QR_ECC_HIGH)
+        return 0;
+    return dataCodewordCount(version, ecc) * 8;
+}
+
+uint16_t qrLinesScored()
+{
+    return linesScored;
+}
+
+// --- Data codewords ----------------------------------------------------------
+
+struct BitWriter
+{
+    uint8_t *buffer;
+    uint16_t bits;
+    uint16_t capacity; // In bits
+};
+
+static bool appendBits(BitWriter &writer, uint16_t value, uint8_t count)
+{
+    if (writer.bits + count > writer.capacity)
+        return false;
+    for (int8_t i = count - 1; i >= 0; i--, writer.bits++)
+        if ((value >> i) & 1)
+            writer.buffer[writer.bits >> 3] |= 0x80 >> (writer.bits & 7);
+    return true;
+}
+
+static int8_t alphanumericValue(uint8_t c)
+{
+    static const char SYMBOLS[] = " $%*+-./:";
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'A' && c <= 'Z')
+        return c - 'A' + 10;
+    for (uint8_t i = 0; i < sizeof(SYMBOLS) - 1; i++)
+        if (c == (uint8_t)SYMBOLS[i])
+            return 36 + i;
+    return -1;
+}
+
+static bool encodable(QrMode mode, uint8_t c)
+{
+    switch (mode)
+    {
+    case MODE_NUMERIC:
+        return c >= '0' && c <= '9';
+    case MODE_ALPHANUMERIC:
+        return alphanumericValue(c) >= 0;
+    default:
+        return true;
+    }
+}
+
+static uint8_t countBits(QrMode mode, uint8_t version)
+{
+    // Versions 1-9, then 10-26 (QR_MAX_VERSION stops below 27)
+    switch (mode)
+    {
+    case MODE_NUMERIC:
+        return version < 10 ? 10 : 12;
+    case MODE_ALPHANUMERIC:
+        return version < 10 ? 9 : 11;
+    default:
+        return version < 10 ? 8 : 16;
+    }
+}
+
+static uint16_t segmentBits(QrMode mode, uint16_t length, uint8_t version)
+{
+    uint16_t bits = 4 + countBits(mode, version);
+    switch (mode)
+    {
+    case MODE_NUMERIC:
+        return bits + 10 * (length / 3) + (length % 3 == 0 ? 0 : (length % 3 == 1 ? 4 : 7));
+    case MODE_ALPHANUMERIC:
+        return bits + 11 * (length / 2) + 6 * (length % 2);
+    default:
+        return bits + 8 * length;
+    }
+}
+
+// Optimal split into numeric / alphanumeric / byte segments for the count
+// field sizes of `version`, by dynamic programming over the characters:
+// cost[m] is the cheapest encoding (in sixths of a bit) of the text so far
+// that ends in a mode m segment. A character either extends a segment of
+// its own mode or, after it, a new segment starts (whole bits so far plus a
+// header). Leaves the mode of each character in charModes and returns the
+// segment bits, or 0xFFFF if the text is too long for the version.
+static uint16_t chooseModes(const uint8_t *data, uint16_t length, uint8_t version)
+{
+    const uint32_t NONE = 0xFFFFFFFF;
+    uint32_t head[MODE_COUNT], cost[MODE_COUNT];
+    for (uint8_t m = 0; m < MODE_COUNT; m++)
+        cost[m] = head[m] = (4 + countBits((QrMode)m, version)) * 6;
+
+    for (uint16_t i = 0; i < length; i++)
+    {
+        // Back pointer per mode (2 bits each): the mode character i is in when
+        // the text up to i ends in that mode; 3 = not possible
+        uint8_t from = 0x3F;
+        uint32_t extended[MODE_COUNT];
+        for (uint8_t m = 0; m < MODE_COUNT; m++)
+        {
+            extended[m] = NONE;
+            if (encodable((QrMode)m, data[i]))
+            {
+                extended[m] = cost[m] + MODE_SIXTHS[m];
+                from = (from & ~(3 << (2 * m))) | m << (2 * m);
+            }
+            cost[m] = extended[m];
+        }
+        for (uint8_t to = 0; to < MODE_COUNT; to++)
+            for (uint8_t m = 0; m < MODE_COUNT; m++)
+            {
+                if (extended[m] == NONE)
+                    continue;
+                uint32_t switched = (extended[m] + 5) / 6 * 6 + head[to];
+                if (switched < cost[to])
+                {
+                    cost[to] = switched;
+                    from = (from & ~(3 << (2 * to))) | m << (2 * to);
+                }
+            }
+        charModes[i] = from;
+    }
+
+    // Walk back from the cheapest final mode
+    uint8_t mode = 0;
+    for (uint8_t m = 1; m < MODE_COUNT; m++)
+        if (cost[m] < cost[mode])
+            mode = m;
+    for (uint16_t i = length; i-- > 0;)
+    {
+        mode = (charModes[i] >> (2 * mode)) & 3;
+        charModes[i] = mode;
+    }
+
+    uint32_t bits = 0;
+    for (uint16_t start = 0, end; start < length; start = end)
+    {
+        for (end = start + 1; end < length && charModes[end] == charModes[start]; end++)
+            ;
+        QrMode segment = (QrMode)charModes[start];
+        if ((uint16_t)(end - start) >= (1u << countBits(segment, version)))
+            return 0xFFFF; // Count field overflow
+        bits += segmentBits(segment, end - start, version);
+    }
+    return bits > 0xFFFE ? 0xFFFF : bits;
+}
+
+static bool writeSegment(BitWriter &writer, QrMode mode, const uint8_t *data, uint16_t length, uint8_t version)
+{
+    if (!appendBits(writer, MODE_INDICATOR[mode], 4) || !appendBits(writer, length, countBits(mode, version)))
+        return false;
+    uint16_t i = 0;
+    switch (mode)
+    {
+    case MODE_NUMERIC:
+        for (; i + 3 <= length; i += 3)
+            if (!appendBits(writer, (data[i] - '0') * 100 + (data[i + 1] - '0') * 10 + (data[i + 2] - '0'), 10))
+                return false;
+        if (length - i == 2)
+            return appendBits(writer, (data[i] - '0') * 10 + (data[i + 1] - '0'), 7);
+        if (length - i == 1)
+            return appendBits(writer, data[i] - '0', 4);
+        return true;
+    case MODE_ALPHANUMERIC:
+        for (; i + 2 <= length; i += 2)
+            if (!appendBits(writer, alphanumericValue(data[i]) * 45 + alphanumericValue(data[i + 1]), 11))
+                return false;
+        if (i < length)
+            return appendBits(writer, alphanumericValue(data[i]), 6);
+        return true;
+    default:
+        for (; i < length; i++)
+            if (!appendBits(writer, data[i], 8))
+                return false;
+        return true;
+    }
+}
+
+// Terminator, bit padding and the 0xEC / 0x11 pad codewords
+static void padCodewords(BitWriter &writer)
+{
+    uint16_t terminator = writer.capacity - writer.bits;
+    appendBits(writer, 0, terminator > 4 ? 4 : terminator);
+    appendBits(writer, 0, (8 - (writer.bits & 7)) & 7);
+    for (uint8_t pad = 0xEC; writer.bits < writer.capacity; pad ^= 0xEC ^ 0x11)
+        appendBits(writer, pad, 8);
+}
+
+// --- Reed-Solomon ------------------------------------------------------------
+
+// Generator polynomial of `degree`, as logs of its coefficients (x^(degree-1)
+// first; the leading 1 is implied)
+static void generatorLogs(uint8_t degree, uint8_t *logs)
+{
+    uint8_t poly[MAX_ECC_PER_BLOCK];
+    memset(poly, 0, degree);
+    poly[degree - 1] = 1;
+    uint8_t rootLog = 0; // Multiply by (x - a^i), i = 0 .. degree - 1
+    for (uint8_t i = 0; i < degree; i++, rootLog++)
+    {
+        for (uint8_t j = 0; j < degree; j++)
+        {
+            uint8_t product = 0;
+            if (poly[j] != 0)
+            {
+                uint16_t sum = GF_LOG[poly[j]] + rootLog;
+                product = GF_EXP[sum >= 255 ? sum - 255 : sum];
+            }
+            poly[j] = product ^ (j + 1 < degree ? poly[j + 1] : 0);
+        }
+    }
+    for (uint8_t j = 0; j < degree; j++)
+        logs[j] = GF_LOG[poly[j]]; // Coefficients of a QR generator are never 0
+}
+
+static void eccRemainder(const uint8_t *data, uint8_t length, const uint8_t *genLogs, uint8_t degree,
+                         uint8_t *remainder)
+{
+    memset(remainder, 0, degree);
+    for (uint8_t i = 0; i < length; i++)
+    {
+        uint8_t factor = data[i] ^ remainder[0];
+        memmove(remainder, remainder + 1, degree - 1);
+        remainder[degree - 1] = 0;
+        if (factor == 0)
+            continue;
+        uint8_t factorLog = GF_LOG[factor];
+        for (uint8_t j = 0; j < degree; j++)
+        {
+            uint16_t sum = factorLog + genLogs[j];
+            remainder[j] ^= GF_EXP[sum >= 255 ? sum - 255 : sum];
+        }
+    }
+}
+
+// Splits the data codewords into blocks, adds each block's ECC and
+// interleaves everything into allCodewords
+static uint16_t interleaveBlocks(uint8_t version, QrEcc ecc)
+{
+    uint8_t blocks = ECC_BLOCKS[ecc][version - 1];
+    uint8_t eccLength = ECC_CODEWORDS_PER_BLOCK[ecc][version - 1];
+    uint16_t total = rawDataModules(version) / 8;
+    uint8_t shortBlocks = blocks - total % blocks;
+    uint8_t shortData = total / blocks - eccLength;
+
+    uint8_t genLogs[MAX_ECC_PER_BLOCK];
+    uint8_t remainder[MAX_ECC_PER_BLOCK];
+    generatorLogs(eccLength, genLogs);
+
+    uint16_t dataTotal = dataCodewordCount(version, ecc);
+    uint16_t offset = 0;
+    for (uint8_t b = 0; b < blocks; b++)
+    {
+        uint8_t length = shortData + (b < shortBlocks ? 0 : 1);
+        // Data: column j of the block table, skipping the missing last
+        // codeword of short blocks
+        for (uint8_t j = 0; j < length; j++)
+        {
+            uint16_t index = j * blocks + b;
+            if (j == shortData)
+                index -= shortBlocks;
+            allCodewords[index] = dataCodewords[offset + j];
+        }
+        eccRemainder(dataCodewords + offset, length, genLogs, eccLength, remainder);
+        for (uint8_t j = 0; j < eccLength; j++)
+            allCodewords[dataTotal + j * blocks + b] = remainder[j];
+        offset += length;
+    }
+    return total;
+}
+
+// --- Matrix ------------------------------------------------------------------
+
+static void setFunction(uint8_t x, uint8_t y, bool dark)
+{
+    funcRows[y] |= moduleBit(x);
+    if (dark)
+        baseRows[y] |= moduleBit(x);
+    else
+        baseRows[y] &= ~moduleBit(x);
+}
+
+// Format modules change with the mask, so they are written to both views
+static void setFormatModule(uint8_t x, uint8_t y, bool dark)
+{
+    if (dark)
+    {
+        baseRows[y] |= moduleBit(x);
+        baseCols[x] |= moduleBit(y);
+    }
+    else
+    {
+        baseRows[y] &= ~moduleBit(x);
+        baseCols[x] &= ~moduleBit(y);
+    }
+}
+
+static void drawFormatBits(QrEcc ecc, uint8_t mask, uint8_t size, void (*set)(uint8_t, uint8_t, bool))
+{
+    uint16_t data = ECC_FORMAT_BITS[ecc] << 3 | mask;
+    uint16_t remainder = data;
+    for (uint8_t i = 0; i < 10; i++)
+        remainder = (remainder << 1) ^ ((remainder >> 9) * 0x537);
+    uint16_t bits = (data << 10 | remainder) ^ 0x5412;
+
+    // Around the top-left finder
+    for (uint8_t i = 0; i <= 5; i++)
+        set(8, i, (bits >> i) & 1);
+    set(8, 7, (bits >> 6) & 1);
+    set(8, 8, (bits >> 7) & 1);
+    set(7, 8, (bits >> 8) & 1);
+    for (uint8_t i = 9; i < 15; i++)
+        set(14 - i, 8, (bits >> i) & 1);
+    // Copy next to the other two finders, plus the dark module
+    for (uint8_t i = 0; i < 8; i++)
+        set(size - 1 - i, 8, (bits >> i) & 1);
+    for (uint8_t i = 8; i < 15; i++)
+        set(8, size - 15 + i, (bits >> i) & 1);
+    set(8, size - 8, true);
+}
+
+static void drawFinder(uint8_t cx, uint8_t cy, uint8_t size)
+{
+    for (int8_t dy = -4; dy <= 4; dy++)
+        for (int8_t dx = -4; dx <= 4; dx++)
+        {
+            int16_t x = cx + dx, y = cy + dy;
+            if (x < 0 || y < 0 || x >= size || y >= size)
+                continue;
+            uint8_t distance = (dx < 0 ? -dx : dx) > (dy < 0 ? -dy : dy) ? (dx < 0 ? -dx : dx) : (dy < 0 ? -dy : dy);
+            setFunction(x, y, distance != 2 && distance != 4);
+        }
+}
+
+static void drawFunctionPatterns(uint8_t version, QrEcc ecc, uint8_t size)
+{
+    memset(baseRows, 0, sizeof(baseRows));
+    for (uint8_t y = 0; y < ROW_BITS; y++)
+        funcRows[y] = y < size ? ~(~(uint64_t)0 << (ROW_BITS - size)) : ~(uint64_t)0; // Past the symbol
+
+    for (uint8_t i = 0; i < size; i++)
+    {
+        setFunction(6, i, i % 2 == 0);
+        setFunction(i, 6, i % 2 == 0);
+    }
+    drawFinder(3, 3, size);
+    drawFinder(size - 4, 3, size);
+    drawFinder(3, size - 4, size);
+
+    const uint8_t *positions = ALIGNMENT_POSITIONS[version - 1];
+    uint8_t count = 0;
+    while (count < 4 && positions[count] != 0)
+        count++;
+    for (uint8_t i = 0; i < count; i++)
+        for (uint8_t j = 0; j < count; j++)
+        {
+            if ((i == 0 && j == 0) || (i == 0 && j == count - 1) || (i == count - 1 && j == 0))
+                continue; // Finder corners
+            for (int8_t dy = -2; dy <= 2; dy++)
+                for (int8_t dx = -2; dx <= 2; dx++)
+                    setFunction(positions[i] + dx, positions[j] + dy,
+                                dx == -2 || dx == 2 || dy == -2 || dy == 2 || (dx == 0 && dy == 0));
+        }
+
+    drawFormatBits(ecc, 0, size, setFunction); // Reserves the area; real bits per mask
+
+    if (version >= 7)
+    {
+        uint32_t remainder = version;
+        for (uint8_t i = 0; i < 12; i++)
+            remainder = (remainder << 1) ^ ((remainder >> 11) * 0x1F25);
+        uint32_t bits = (uint32_t)version << 12 | remainder;
+        for (uint8_t i = 0; i < 18; i++)
+        {
+            bool dark = (bits >> i) & 1;
+            uint8_t a = size - 11 + i % 3, b = i / 3;
+            setFunction(a, b, dark);
+            setFunction(b, a, dark);
+        }
+    }
+}
+
+// Zigzag placement of the codeword bits in the non-function modules
+static void placeCodewords(uint16_t count, uint8_t size)
+{
+    uint16_t bit = 0, totalBits = count * 8;
+    for (int16_t right = size - 1; right >= 1; right -= 2)
+    {
+        if (right == 6)
+            right = 5; // Skip the vertical timing pattern
+        bool upward = ((right + 1) & 2) == 0;
+        for (uint8_t vert = 0; vert < size; vert++)
+        {
+            uint8_t y = upward ? size - 1 - vert : vert;
+            for (uint8_t j = 0; j < 2; j++)
+            {
+                uint8_t x = right - j;
+                if (funcRows[y] & moduleBit(x))
+                    continue;
+                if (bit < totalBits && (allCodewords[bit >> 3] & (0x80 >> (bit & 7))))
+                    baseRows[y] |= moduleBit(x);
+                bit++; // Remainder bits past the codewords stay light
+            }
+        }
+    }
+}
+
+// 64 x 64 bit matrix transpose (Hacker's Delight 7-3): row k bit 63 - x
+// becomes row x bit 63 - k
+static void transpose(uint64_t *m)
+{
+    uint64_t mask = 0x00000000FFFFFFFFull;
+    for (uint8_t j = 32; j != 0; j >>= 1, mask ^= mask << j)
+        for (uint8_t k = 0; k < ROW_BITS; k = ((k | j) + 1) & ~j)
+        {
+            uint64_t t = (m[k] ^ (m[k | j] >> j)) & mask;
+            m[k] ^= t;
+            m[k | j] ^= t << j;
+        }
+}
+
+// --- Masks and penalty -------------------------------------------------------
+
+static bool maskCondition(uint8_t mask, uint8_t i, uint8_t j) // i = row, j = column
+{
+    switch (mask)
+    {
+    case 0:
+        return (i + j) % 2 == 0;
+    case 1:
+        return i % 2 == 0;
+    case 2:
+        return j % 3 == 0;
+    case 3:
+        return (i + j) % 3 == 0;
+    case 4:
+        return (i / 2 + j / 3) % 2 == 0;
+    case 5:
+        return i * j % 2 + i * j % 3 == 0;
+    case 6:
+        return (i * j % 2 + i * j % 3) % 2 == 0;
+    default:
+        return ((i + j) % 2 + i * j % 3) % 2 == 0;
+    }
+}
+
+// Mask bits of a row (column = false: fixed row i, bits over j) or of a
+// column (fixed column j, bits over i), one period repeated over the word
+static uint64_t maskWord(uint8_t mask, uint8_t fixed, bool column)
+{
+    uint16_t period = 0;
+    for (uint8_t k = 0; k < MASK_PERIOD; k++)
+        if (column ? maskCondition(mask, k, fixed) : maskCondition(mask, fixed, k))
+            period |= 1 << (MASK_PERIOD - 1 - k);
+    uint64_t word = 0;
+    for (uint8_t x = 0; x < ROW_BITS; x += MASK_PERIOD)
+        word |= ((uint64_t)period << (ROW_BITS - MASK_PERIOD)) >> x;
+    return word;
+}
+
+struct LineMasks
+{
+    uint64_t pairs;   // x in [0, size - 2]: module x has a right neighbour
+    uint64_t windows; // x in [0, size - 11]: an 11 module window starts here
+};
+
+// Rule 1 (runs of 5+ of one color) and rule 3 (1:1:3:1:1 with 4 light) on one line
+static uint16_t linePenalty(uint64_t line, const LineMasks &masks)
+{
+    // same bit x: module x equals module x + 1; a run of n >= 5 modules is
+    // n - 1 such bits and costs N1 + (n - 5) = (n - 4) + 2
+    uint64_t same = ~(line ^ (line << 1)) & masks.pairs;
+    uint64_t run5 = same & (same << 1) & (same << 2) & (same << 3);
+    uint16_t score = popcount(run5) + 2 * popcount(run5 & ~(run5 >> 1));
+
+    // Windows equal to 0000 1011101 or 1011101 0000
+    static const uint16_t FINDER_LEFT = 0x05D, FINDER_RIGHT = 0x5D0;
+    uint64_t left = masks.windows, right = masks.windows;
+    for (uint8_t k = 0; k < 11; k++)
+    {
+        uint64_t shifted = line << k;
+        left &= (FINDER_LEFT >> (10 - k)) & 1 ? shifted : ~shifted;
+        right &= (FINDER_RIGHT >> (10 - k)) & 1 ? shifted : ~shifted;
+    }
+    return score + PENALTY_N3 * popcount(left | right);
+}
+
+// Rule 2: 2 x 2 blocks of one color between two neighbouring rows
+static uint16_t blockPenalty(uint64_t upper, uint64_t lower, uint64_t pairs)
+{
+    uint64_t blocks = ~(upper ^ lower) & ~(upper ^ (upper << 1)) & ~(lower ^ (lower << 1)) & pairs;
+    return PENALTY_N2 * popcount(blocks);
+}
+
+// Penalty of a mask, or a value >= `limit` as soon as it cannot be lower
+static uint32_t maskPenalty(uint8_t mask, uint8_t size, uint32_t limit)
+{
+    uint64_t rowMasks[MASK_PERIOD], colMasks[MASK_PERIOD];
+    for (uint8_t k = 0; k < MASK_PERIOD; k++)
+    {
+        rowMasks[k] = maskWord(mask, k, false);
+        colMasks[k] = maskWord(mask, k, true);
+    }
+    uint64_t symbol = ~(uint64_t)0 << (ROW_BITS - size);
+    LineMasks masks = {symbol << 1, ~(uint64_t)0 << (ROW_BITS - (size - 10))};
+
+    uint32_t score = 0;
+    uint16_t dark = 0;
+    uint64_t previous = 0;
+    for (uint8_t y = 0; y < size; y++)
+    {
+        uint64_t row = baseRows[y] ^ (rowMasks[y % MASK_PERIOD] & ~funcRows[y]);
+        score += linePenalty(row, masks);
+        if (y > 0)
+            score += blockPenalty(previous, row, masks.pairs);
+        dark += popcount(row);
+        previous = row;
+        linesScored++;
+        if (score >= limit)
+            return score;
+    }
+    for (uint8_t x = 0; x < size; x++)
+    {
+        uint64_t column = baseCols[x] ^ (colMasks[x % MASK_PERIOD] & ~funcCols[x]);
+        score += linePenalty(column, masks);
+        linesScored++;
+        if (score >= limit)
+            return score;
+    }
+
+    // Rule 4: N4 per 5% step the dark share is away from 45..55%
+    uint16_t total = size * size;
+    for (uint16_t k = 0; dark * 20 < (9 - (int16_t)k) * total || dark * 20 > (11 + k) * total; k++)
+        score += PENALTY_N4;
+    return score;
+}
+
+// --- Encoding ----------------------------------------------------------------
+
+static bool encode(QrCode &code, const uint8_t *data, uint16_t length, uint8_t minVersion, uint8_t maxVersion,
+                   QrEcc ecc, bool raiseEcc);
+
+bool qrEncodeText(QrCode &code, const char *text, uint8_t maxVersion, QrEcc ecc, uint8_t minVersion)
+{
+    if (text == nullptr)
+        return false;
+    return encode(code, (const uint8_t *)text, strlen(text), minVersion, maxVersion, ecc, false);
+}
+
+bool qrEncodeBytes(QrCode &code, const uint8_t *data, uint16_t length, uint8_t maxVersion, QrEcc ecc,
+                   uint8_t minVersion)
+{
+    return encode(code, data, length, minVersion, maxVersion, ecc, false);
+}
+
+bool qrEncodeTextBestEcc(QrCode &code, const char *text, uint8_t maxVersion, QrEcc minEcc)
+{
+    if (text == nullptr)
+        return false;
+    return encode(code, (const uint8_t *)text, strlen(text), 1, maxVersion, minEcc, true);
+}
+
+static bool encode(QrCode &code, const uint8_t *data, uint16_t length, uint8_t minVersion, uint8_t maxVersion,
+                   QrEcc ecc, bool raiseEcc)
+{
+    if (data == nullptr || length == 0 || length > QR_MAX_TEXT_LENGTH || minVersion < 1 ||
+        maxVersion > QR_MAX_VERSION || minVersion > maxVersion || ecc > QR_ECC_HIGH)
+        return false;
+
+    // Count fields grow at version 10, so the split is redone there
+    uint8_t version = minVersion;
+    uint16_t bits = chooseModes(data, length, version);
+    while (bits > qrDataCapacityBits(version, ecc))
+    {
+        if (++version > maxVersion)
+            return false; // Does not fit
+        if (version == 10)
+            bits = chooseModes(data, length, version);
+    }
+    // Segments only depend on the version: spend what is left of it on error correction
+    while (raiseEcc && ecc < QR_ECC_HIGH && bits <= qrDataCapacityBits(version, (QrEcc)(ecc + 1)))
+        ecc = (QrEcc)(ecc + 1);
+
+    BitWriter writer = {dataCodewords, 0, qrDataCapacityBits(version, ecc)};
+    memset(dataCodewords, 0, sizeof(dataCodewords));
+    uint8_t segments = 0;
+    for (uint16_t start = 0, end; start < length; start = end, segments++)
+    {
+        for (end = start + 1; end < length && charModes[end] == charModes[start]; end++)
+            ;
+        if (!writeSegment(writer, (QrMode)charModes[start], data + start, end - start, version))
+            return false;
+    }
+    code.dataBits = writer.bits;
+    code.segments = segments;
+    padCodewords(writer);
+    uint16_t total = interleaveBlocks(version, ecc);
+
+    uint8_t size = 4 * version + 17;
+    drawFunctionPatterns(version, ecc, size);
+    placeCodewords(total, size);
+    memcpy(baseCols, baseRows, sizeof(baseRows));
+    memcpy(funcCols, funcRows, sizeof(funcRows));
+    transpose(baseCols);
+    transpose(funcCols);
+
+    // Lowest penalty wins, the first one on a tie
+    linesScored = 0;
+    uint8_t best = 0;
+    uint32_t bestScore = 0xFFFFFFFF;
+    for (uint8_t mask = 0; mask < 8; mask++)
+    {
+        drawFormatBits(ecc, mask, size, setFormatModule);
+        uint32_t score = maskPenalty(mask, size, bestScore);
+        if (score < bestScore)
+        {
+            best = mask;
+            bestScore = score;
+        }
+    }
+
+    drawFormatBits(ecc, best, size, setFormatModule);
+    code.version = version;
+    code.size = size;
+    code.ecc = ecc;
+    code.mask = best;
+    code.rowBytes = (size + 7) / 8;
+    uint8_t *out = code.rows;
+    for (uint8_t y = 0; y < size; y++)
+    {
+        uint64_t row = baseRows[y] ^ (maskWord(best, y % MASK_PERIOD, false) & ~funcRows[y]);
+        for (uint8_t b = 0; b < code.rowBytes; b++)
+            *out++ = (uint8_t)(row >> (ROW_BITS - 8 - 8 * b));
+    }
+    return true;
+}
+
+bool qrModule(const QrCode &code, uint8_t x, uint8_t y)
+{
+    if (x >= code.size || y >= code.size)
+        return false;
+    return code.rows[y * code.rowBytes + x / 8] & (0x80 >> (x % 8));
+}
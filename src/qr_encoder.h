@@ -0,0 +1,70 @@
+/**
+ * @file qr_encoder.h
+ * @brief QR code encoder for versions 1 to QR_MAX_VERSION.
+ *        The text is split into numeric, alphanumeric and byte segments by
+ *        dynamic programming over its characters, so digit and upper case
+ *        runs in URLs or phone numbers cost 3.3 or 5.5 bits a character
+ *        instead of 8, and the smallest version that holds the result is
+ *        used. Text of a single mode gives the same symbol as ricmoo/QRCode's
+ *        qrcode_initText() (same padding, block layout and mask penalty
+ *        rules), but the matrix lives in one 64-bit word per row: function
+ *        patterns, masks and the penalty rules work on whole rows (and on the
+ *        transposed matrix for columns) instead of module by module.
+ *        Reed-Solomon remainders use GF(256) log / antilog tables, and mask
+ *        scoring stops as soon as a mask can no longer beat the best one so
+ *        far. The result is kept as packed rows (MSB first, set = dark) that
+ *        blitBitmap() draws directly. See tools/qr_bench.cpp.
+ *        Plain C++ (no Arduino calls) so it can be checked on the host.
+ *        Not reentrant: the working matrix is a static buffer.
+ */
+#pragma once
+
+#include <stdint.h>
+
+const uint8_t QR_MAX_VERSION = 10;                           // Rows fit a 64-bit word
+const uint8_t QR_MAX_SIZE = 4 * QR_MAX_VERSION + 17;         // Modules per side
+const uint8_t QR_MAX_ROW_BYTES = (QR_MAX_SIZE + 7) / 8;      // Bytes per packed row
+const uint16_t QR_MAX_CODEWORDS = 346;                       // Data + ECC at QR_MAX_VERSION
+const uint16_t QR_MAX_TEXT_LENGTH = 2 * QR_MAX_CODEWORDS;    // More than any version holds (652 digits)
+
+// Same order (and values) as ricmoo/QRCode's ECC_LOW .. ECC_HIGH
+enum QrEcc : uint8_t
+{
+    QR_ECC_LOW,
+    QR_ECC_MEDIUM,
+    QR_ECC_QUARTILE,
+    QR_ECC_HIGH
+};
+
+struct QrCode
+{
+    uint8_t version;
+    uint8_t size;      // Modules per side, 4 * version + 17
+    QrEcc ecc;
+    uint8_t mask;      // Mask pattern chosen by the penalty rules
+    uint8_t segments;  // Numeric / alphanumeric / byte segments used
+    uint16_t dataBits; // Segment bits before the terminator and padding
+    uint8_t rowBytes;  // Bytes per packed row, (size + 7) / 8
+    uint8_t rows[QR_MAX_SIZE * QR_MAX_ROW_BYTES];
+};
+
+// Encodes `text` in the smallest version from minVersion to maxVersion that
+// holds its optimal segmentation (minVersion = maxVersion for a fixed one).
+// Returns false if it is empty or does not fit maxVersion at that ECC level.
+bool qrEncodeText(QrCode &code, const char *text, uint8_t maxVersion, QrEcc ecc, uint8_t minVersion = 1);
+bool qrEncodeBytes(QrCode &code, const uint8_t *data, uint16_t length, uint8_t maxVersion, QrEcc ecc,
+                   uint8_t minVersion = 1);
+
+// Smallest version (up to maxVersion) at minEcc, then the highest ECC level
+// that still holds the text in that version: same size, more damage tolerated
+bool qrEncodeTextBestEcc(QrCode &code, const char *text, uint8_t maxVersion, QrEcc minEcc = QR_ECC_LOW);
+
+// Module at (x, y), true = dark
+bool qrModule(const QrCode &code, uint8_t x, uint8_t y);
+
+// Bits available for segments (mode + count + data) at a version and ECC level
+uint16_t qrDataCapacityBits(uint8_t version, QrEcc ecc);
+
+// Rows and columns scored by the last encode, over all masks (8 * 2 * size
+// when no mask was cut short)
+uint16_t qrLinesScored();
@@ -0,0 +1,75 @@
+/**
+ * @file screens.cpp
+ * @brief Display mode screens as display lists (see screens.h).
+ */
+#include "screens.h"
+
+#include <string.h>
+
+void recordCenteredText(DisplayList &list, const char *text, int16_t baselineY, const GFXfont *font,
+                        int16_t areaW, int16_t areaH, int16_t originX)
+{
+    if (!font || !text || text[0] == '\0')
+        return;
+    int16_t x1, y1;
+    uint16_t w, h;
+    uint16_t length = strlen(text);
+    measureText(font, text, length, &x1, &y1, &w, &h);
+    int16_t cursorX = originX + (areaW - (int16_t)w) / 2;
+    if (baselineY < -y1)
+        baselineY = -y1; // Top of the text on screen
+    if (baselineY > areaH - ((int16_t)h + y1))
+        baselineY = areaH - ((int16_t)h + y1); // Bottom on screen
+    list.addGlyphs(font, cursorX, baselineY, text, length);
+}
+
+void recordInfoScreen(DisplayList &list, const InfoLayout &layout, const char *text, const ScreenFonts &fonts,
+                      int16_t areaW, int16_t areaH, int16_t originX)
+{
+    if (layout.lineCount == 0)
+    {
+        recordCenteredText(list, "No Info", areaH / 2, fonts.noInfo, areaW, areaH, originX);
+        return;
+    }
+    for (uint8_t i = 0; i < layout.lineCount; i++)
+    {
+        const InfoLine &line = layout.lines[i];
+        list.addGlyphs(infoFont(fonts.info, line.fontIndex), originX + line.x, line.baselineY, text + line.start,
+                       line.length);
+    }
+}
+
+void recordQrScreen(DisplayList &list, QrScreenStatus status, const QrCode *code, uint8_t scale,
+                    const ScreenFonts &fonts, int16_t areaW, int16_t areaH)
+{
+    if (status == QR_SCREEN_NO_DATA)
+    {
+        recordCenteredText(list, "No QR Data Available", areaH / 2, fonts.message, areaW, areaH);
+        return;
+    }
+    if (status == QR_SCREEN_FAILED || code == nullptr)
+    {
+        recordCenteredText(list, "QR Generation Failed", areaH / 2, fonts.message, areaW, areaH);
+        return;
+    }
+    // Centered like drawQrCode(), never starting off screen
+    int16_t pixels = code->size * scale;
+    int16_t x = (areaW - pixels) / 2;
+    int16_t y = (areaH - pixels) / 2;
+    list.addBitmap(x < 0 ? 0 : x, y < 0 ? 0 : y, code->rows, code->size, code->size, scale, true, code->rowBytes * 8);
+}
+
+void recordSplitScreen(DisplayList &list, const InfoLayout &layout, const char *text, const QrCode *code,
+                       uint8_t scale, const ScreenFonts &fonts, int16_t areaW, int16_t areaH)
+{
+    if (code != nullptr)
+    {
+        // Same margins on all four sides of the square: the quiet zone also separates it from the text
+        int16_t pixels = code->size * scale;
+        int16_t offset = (areaH - pixels) / 2;
+        if (offset < 0)
+            offset = 0;
+        list.addBitmap(offset, offset, code->rows, code->size, code->size, scale, true, code->rowBytes * 8);
+    }
+    recordInfoScreen(list, layout, text, fonts, areaW - areaH, areaH, areaH);
+}
@@ -0,0 +1,50 @@
+/**
+ * @file screens.h
+ * @brief What each display mode draws, recorded into a DisplayList.
+ *        updateDisplay() and the host golden-image check (tools/golden_check.cpp)
+ *        share these, so the host renders exactly what the badge shows.
+ *        Plain C++ (no Arduino calls); fonts and sizes come from the caller.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <gfxfont.h>
+
+#include "display_list.h"
+#include "qr_encoder.h"
+#include "text_layout.h"
+
+struct ScreenFonts
+{
+    InfoFontSet info;
+    const GFXfont *noInfo;  // "No Info" (empty personal info)
+    const GFXfont *message; // QR status messages
+};
+
+enum QrScreenStatus : uint8_t
+{
+    QR_SCREEN_OK,      // code holds the symbol
+    QR_SCREEN_NO_DATA, // No QR data stored
+    QR_SCREEN_FAILED   // Data did not encode (too long, ...)
+};
+
+// Centered horizontally in [originX, originX + areaW) like drawCenteredText()
+// with targetX / targetW, baseline kept inside areaH
+void recordCenteredText(DisplayList &list, const char *text, int16_t baselineY, const GFXfont *font,
+                        int16_t areaW, int16_t areaH, int16_t originX = 0);
+
+// INFO: the layout's lines (text must outlive the list), or "No Info". The
+// layout is computed for areaW x areaH and drawn originX to the right.
+void recordInfoScreen(DisplayList &list, const InfoLayout &layout, const char *text, const ScreenFonts &fonts,
+                      int16_t areaW, int16_t areaH, int16_t originX = 0);
+
+// QR_CODE: the code's packed rows centered at `scale` pixels per module
+// (code must outlive the list), or the status message
+void recordQrScreen(DisplayList &list, QrScreenStatus status, const QrCode *code, uint8_t scale,
+                    const ScreenFonts &fonts, int16_t areaW, int16_t areaH);
+
+// SPLIT: the code centered in the areaH x areaH square on the left (left
+// empty if code is null), and the layout's lines right of it. The layout has
+// to be computed for (areaW - areaH) x areaH.
+void recordSplitScreen(DisplayList &list, const InfoLayout &layout, const char *text, const QrCode *code,
+                       uint8_t scale, const ScreenFonts &fonts, int16_t areaW, int16_t areaH);
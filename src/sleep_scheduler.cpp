@@ -0,0 +1,266 @@
+/**
+ * @file sleep_scheduler.cpp
+ * @brief Power policies, scheduler and host power simulation (see sleep_scheduler.h).
+ */
+#include "sleep_scheduler.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ===================================================================================
+// Policies
+// ===================================================================================
+PowerPolicy powerPolicyPreset(PowerPreset preset)
+{
+    PowerPolicy p;
+    p.version = POWER_POLICY_VERSION;
+    p.awakeTimeoutS = 60;
+    p.fastAdvDurationS = 10;
+    p.fastAdvIntervalMs = 100;
+    p.slowAdvIntervalMs = 1000;
+    p.timerWakePeriodS = 0;
+    p.timerWakeAdvMs = 3000;
+
+    switch (preset)
+    {
+    case PRESET_LOW_POWER:
+        p.awakeTimeoutS = 20;
+        p.fastAdvDurationS = 0;
+        p.slowAdvIntervalMs = 1500;
+        break;
+    case PRESET_BEACON:
+        p.timerWakePeriodS = 300;
+        break;
+    default:
+        break;
+    }
+    return p;
+}
+
+const char *powerPresetName(PowerPreset preset)
+{
+    switch (preset)
+    {
+    case PRESET_DEFAULT:
+        return "default";
+    case PRESET_LOW_POWER:
+        return "lowpower";
+    case PRESET_BEACON:
+        return "beacon";
+    default:
+        return "?";
+    }
+}
+
+bool powerPolicyValid(const PowerPolicy &p)
+{
+    return p.version == POWER_POLICY_VERSION &&
+           p.awakeTimeoutS >= 5 && p.awakeTimeoutS <= 3600 &&
+           p.fastAdvDurationS <= p.awakeTimeoutS &&
+           p.fastAdvIntervalMs >= 20 && p.fastAdvIntervalMs <= 10240 && // BLE advertising interval limits
+           p.slowAdvIntervalMs >= 20 && p.slowAdvIntervalMs <= 10240 &&
+           (p.timerWakePeriodS == 0 || (p.timerWakePeriodS >= 30 && p.timerWakePeriodS <= 86400)) &&
+           p.timerWakeAdvMs >= 500 && p.timerWakeAdvMs <= 60000;
+}
+
+// Decimal digits only, range checked before the caller narrows it to the field type
+static bool parseField(const char *value, unsigned long max, unsigned long &number)
+{
+    if (*value < '0' || *value > '9') // strtoul() also takes a sign: "-1" would wrap
+        return false;
+    char *valueEnd = nullptr;
+    errno = 0;
+    number = strtoul(value, &valueEnd, 10);
+    return *valueEnd == '\0' && errno != ERANGE && number <= max;
+}
+
+bool parsePowerPolicy(const char *text, PowerPolicy &policy)
+{
+    if (text == nullptr)
+        return false;
+
+    PowerPolicy p = policy;
+    const char *cursor = text;
+    while (*cursor != '\0')
+    {
+        const char *end = strchr(cursor, ',');
+        size_t len = end ? (size_t)(end - cursor) : strlen(cursor);
+        char pair[32];
+        if (len == 0 || len >= sizeof(pair))
+            return false;
+        memcpy(pair, cursor, len);
+        pair[len] = '\0';
+
+        char *eq = strchr(pair, '=');
+        if (eq == nullptr)
+            return false;
+        *eq = '\0';
+        const char *key = pair;
+        const char *value = eq + 1;
+        unsigned long number = 0;
+
+        if (strcmp(key, "preset") == 0)
+        {
+            int found = -1;
+            for (int i = 0; i < PRESET_COUNT; i++)
+                if (strcmp(value, powerPresetName((PowerPreset)i)) == 0)
+                    found = i;
+            if (found < 0)
+                return false;
+            p = powerPolicyPreset((PowerPreset)found);
+        }
+        else if (strcmp(key, "awake") == 0 && parseField(value, UINT16_MAX, number))
+            p.awakeTimeoutS = (uint16_t)number;
+        else if (strcmp(key, "fast") == 0 && parseField(value, UINT16_MAX, number))
+            p.fastAdvDurationS = (uint16_t)number;
+        else if (strcmp(key, "fastint") == 0 && parseField(value, UINT16_MAX, number))
+            p.fastAdvIntervalMs = (uint16_t)number;
+        else if (strcmp(key, "slowint") == 0 && parseField(value, UINT16_MAX, number))
+            p.slowAdvIntervalMs = (uint16_t)number;
+        else if (strcmp(key, "wake") == 0 && parseField(value, UINT32_MAX, number))
+            p.timerWakePeriodS = (uint32_t)number;
+        else if (strcmp(key, "burst") == 0 && parseField(value, UINT16_MAX, number))
+            p.timerWakeAdvMs = (uint16_t)number;
+        else
+            return false; // Unknown key, or a value that is not a number of the field's range
+
+        cursor = end ? end + 1 : cursor + len;
+    }
+
+    if (!powerPolicyValid(p))
+        return false;
+    policy = p;
+    return true;
+}
+
+// ===================================================================================
+// SleepScheduler
+// ===================================================================================
+SleepScheduler::SleepScheduler()
+    : activePolicy(powerPolicyPreset(PRESET_DEFAULT)),
+      wakeReason(WAKE_POWER_ON),
+      windowStartMs(0)
+{
+}
+
+void SleepScheduler::begin(const PowerPolicy &policy, WakeReason reason, uint32_t nowMs)
+{
+    activePolicy = policy;
+    wakeReason = reason;
+    windowStartMs = nowMs;
+}
+
+void SleepScheduler::setPolicy(const PowerPolicy &policy, uint32_t nowMs)
+{
+    activePolicy = policy;
+    windowStartMs = nowMs;
+}
+
+void SleepScheduler::restartWindow(uint32_t nowMs)
+{
+    // Any interaction turns a timer-wake burst into a normal wake window
+    if (wakeReason == WAKE_TIMER)
+        wakeReason = WAKE_BUTTON;
+    windowStartMs = nowMs;
+}
+
+uint32_t SleepScheduler::windowMs() const
+{
+    if (wakeReason == WAKE_TIMER)
+        return activePolicy.timerWakeAdvMs;
+    return (uint32_t)activePolicy.awakeTimeoutS * 1000UL;
+}
+
+uint32_t SleepScheduler::windowRemainingMs(uint32_t nowMs) const
+{
+    uint32_t elapsed = nowMs - windowStartMs;
+    return (elapsed >= windowMs()) ? 0 : windowMs() - elapsed;
+}
+
+AdvPhase SleepScheduler::advPhase(uint32_t nowMs, bool connected) const
+{
+    if (connected)
+        return ADV_OFF; // The stack stops advertising once a client is connected
+    uint32_t elapsed = nowMs - windowStartMs;
+    if (elapsed >= windowMs())
+        return ADV_OFF;
+    if (wakeReason == WAKE_TIMER || elapsed < (uint32_t)activePolicy.fastAdvDurationS * 1000UL)
+        return ADV_FAST; // Timer bursts are short, always advertise fast
+    return ADV_SLOW;
+}
+
+uint16_t SleepScheduler::advIntervalMs(AdvPhase phase) const
+{
+    return (phase == ADV_FAST) ? activePolicy.fastAdvIntervalMs : activePolicy.slowAdvIntervalMs;
+}
+
+bool SleepScheduler::sleepDue(uint32_t nowMs, bool connected) const
+{
+    return !connected && windowRemainingMs(nowMs) == 0;
+}
+
+// ===================================================================================
+// Host Power Simulation
+// ===================================================================================
+PowerProfile defaultPowerProfile()
+{
+    PowerProfile profile;
+    profile.sleepCurrentUa = 150;   // ESP32 deep sleep + LDO + divider on LilyGo T5
+    profile.awakeCurrentUa = 40000; // 240 MHz idle with Bluedroid running
+    profile.bootMs = 400;
+    profile.bootCurrentUa = 50000;
+    profile.advEventNah = 43;       // 3 x ~0.4 ms TX at ~130 mA
+    profile.refreshMs = 2500;       // Full refresh of the 2.13" panel
+    profile.refreshExtraUa = 5000;
+    return profile;
+}
+
+// nAh used by one wake: boot, optional refresh, then the scheduler's window
+static uint64_t simulateWakeNah(const PowerPolicy &policy, const PowerProfile &profile, WakeReason reason, uint32_t &awakeMs)
+{
+    const uint32_t STEP_MS = 10;
+    uint64_t uaMs = (uint64_t)profile.bootCurrentUa * profile.bootMs; // uA*ms
+    awakeMs = profile.bootMs;
+    if (reason != WAKE_TIMER)
+        uaMs += (uint64_t)profile.refreshExtraUa * profile.refreshMs; // Refresh overlaps the window
+
+    uint64_t advEventsX1000 = 0; // Advertising events * 1000, keeps fractional events
+    SleepScheduler scheduler;
+    scheduler.begin(policy, reason, 0);
+    uint32_t t = 0;
+    while (!scheduler.sleepDue(t, false))
+    {
+        AdvPhase phase = scheduler.advPhase(t, false);
+        if (phase != ADV_OFF)
+            advEventsX1000 += (uint64_t)STEP_MS * 1000 / scheduler.advIntervalMs(phase);
+        uaMs += (uint64_t)profile.awakeCurrentUa * STEP_MS;
+        t += STEP_MS;
+    }
+    awakeMs += t;
+    return uaMs / 3600 + advEventsX1000 * profile.advEventNah / 1000; // uA*ms / 3600 = nAh
+}
+
+uint32_t simulateDailyChargeUah(const PowerPolicy &policy, const PowerProfile &profile, uint16_t buttonWakesPerDay)
+{
+    const uint32_t DAY_MS = 86400000UL;
+    uint64_t totalNah = 0;
+    uint64_t totalAwakeMs = 0;
+    uint32_t wakeMs = 0;
+
+    uint64_t buttonNah = simulateWakeNah(policy, profile, WAKE_BUTTON, wakeMs);
+    totalNah += buttonNah * buttonWakesPerDay;
+    totalAwakeMs += (uint64_t)wakeMs * buttonWakesPerDay;
+
+    if (policy.timerWakePeriodS > 0)
+    {
+        uint32_t timerWakes = 86400UL / policy.timerWakePeriodS;
+        uint64_t timerNah = simulateWakeNah(policy, profile, WAKE_TIMER, wakeMs);
+        totalNah += timerNah * timerWakes;
+        totalAwakeMs += (uint64_t)wakeMs * timerWakes;
+    }
+
+    uint64_t sleepMs = (totalAwakeMs < DAY_MS) ? DAY_MS - totalAwakeMs : 0;
+    totalNah += (uint64_t)profile.sleepCurrentUa * sleepMs / 3600;
+    return (uint32_t)(totalNah / 1000);
+}
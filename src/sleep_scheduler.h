@@ -0,0 +1,109 @@
+/**
+ * @file sleep_scheduler.h
+ * @brief Wake window, advertising phase and deep-sleep timing.
+ *        A PowerPolicy says how long to stay awake, how long to advertise
+ *        fast before slowing down, and whether to wake periodically on a timer
+ *        for a short advertising burst. SleepScheduler turns the policy plus
+ *        the wake reason into "advertise fast / slow" and "sleep now" answers.
+ *        Plain C++ (no Arduino calls) so the same code drives the host
+ *        power simulation (tools/power_budget.cpp).
+ */
+#pragma once
+
+#include <stdint.h>
+
+enum WakeReason
+{
+    WAKE_POWER_ON,
+    WAKE_BUTTON,
+    WAKE_TIMER
+};
+
+enum AdvPhase
+{
+    ADV_OFF,
+    ADV_FAST,
+    ADV_SLOW
+};
+
+// Persisted as a blob in NVS; bump POWER_POLICY_VERSION when the layout changes
+struct PowerPolicy
+{
+    uint8_t version;
+    uint16_t awakeTimeoutS;      // Wake window after power-on / button / disconnect
+    uint16_t fastAdvDurationS;   // Fast advertising at the start of the window
+    uint16_t fastAdvIntervalMs;  // Advertising interval while fast
+    uint16_t slowAdvIntervalMs;  // Advertising interval afterwards
+    uint32_t timerWakePeriodS;   // 0 = no timer wake, button only
+    uint16_t timerWakeAdvMs;     // Advertising burst after a timer wake
+};
+
+const uint8_t POWER_POLICY_VERSION = 1;
+
+// Built-in policies
+enum PowerPreset
+{
+    PRESET_DEFAULT,   // 60 s window, 10 s fast advertising, button wake only
+    PRESET_LOW_POWER, // 20 s window, slow advertising, button wake only
+    PRESET_BEACON,    // Default window plus a 3 s advertising burst every 5 min
+    PRESET_COUNT
+};
+
+PowerPolicy powerPolicyPreset(PowerPreset preset);
+const char *powerPresetName(PowerPreset preset);
+
+// Range-checks a policy (e.g. one loaded from NVS or sent over BLE)
+bool powerPolicyValid(const PowerPolicy &policy);
+
+// Parses "key=value,key=value" into `policy` (keys: awake, fast, fastint,
+// slowint, wake, burst, preset). Only keys present are changed. Returns false
+// (and leaves `policy` untouched) on an unknown key, a value that is not a
+// plain decimal in the field's range, or an invalid result.
+bool parsePowerPolicy(const char *text, PowerPolicy &policy);
+
+class SleepScheduler
+{
+public:
+    SleepScheduler();
+
+    void begin(const PowerPolicy &policy, WakeReason reason, uint32_t nowMs);
+    void setPolicy(const PowerPolicy &policy, uint32_t nowMs); // Takes effect from now
+    const PowerPolicy &policy() const { return activePolicy; }
+
+    // Restart the wake window (client disconnected, button pressed, ...)
+    void restartWindow(uint32_t nowMs);
+
+    AdvPhase advPhase(uint32_t nowMs, bool connected) const;
+    uint16_t advIntervalMs(AdvPhase phase) const;
+    bool sleepDue(uint32_t nowMs, bool connected) const;
+    uint32_t windowRemainingMs(uint32_t nowMs) const;
+
+    // Timer wake to program before deep sleep (0 = none)
+    uint64_t timerWakeUs() const { return (uint64_t)activePolicy.timerWakePeriodS * 1000000ULL; }
+
+private:
+    uint32_t windowMs() const;
+
+    PowerPolicy activePolicy;
+    WakeReason wakeReason;
+    uint32_t windowStartMs;
+};
+
+// --- Host power simulation (tools/power_budget.cpp; not run by the firmware) ---
+// Rough board figures; adjust to measurements of the actual board
+struct PowerProfile
+{
+    uint32_t sleepCurrentUa;     // Deep sleep, whole board
+    uint32_t awakeCurrentUa;     // CPU + BLE stack idle, radio between events
+    uint32_t bootMs;             // Boot + BLE init until advertising
+    uint32_t bootCurrentUa;
+    uint32_t advEventNah;        // Charge of one advertising event (3 channels), nAh
+    uint32_t refreshMs;          // Display refresh on power-on / button wake
+    uint32_t refreshExtraUa;     // Panel current on top of awake current
+};
+
+PowerProfile defaultPowerProfile();
+
+// Simulates one day with `buttonWakesPerDay` button wakes (no client
+// connecting) by stepping the scheduler, and returns the charge used in uAh.
+uint32_t simulateDailyChargeUah(const PowerPolicy &policy, const PowerProfile &profile, uint16_t buttonWakesPerDay);
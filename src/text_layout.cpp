@@ -0,0 +1,488 @@
+/**
+ * @file text_layout.cpp
+ * @brief Glyph-table text metrics and info screen layout (see text_layout.h).
+ */
+#include "text_layout.h"
+
+#include <string.h>
+
+static uint32_t metricCalls = 0;
+
+void measureText(const GFXfont *font, const char *text, uint16_t length,
+                 int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h)
+{
+    metricCalls++;
+    int16_t minX = 0x7FFF, minY = 0x7FFF, maxX = -1, maxY = -1;
+    int16_t cursorX = 0;
+
+    if (font != nullptr && text != nullptr)
+    {
+        for (uint16_t i = 0; i < length; i++)
+        {
+            uint8_t c = (uint8_t)text[i];
+            if (c < font->first || c > font->last)
+                continue; // Not in the font, print() skips it too
+            const GFXglyph *glyph = &font->glyph[c - font->first];
+            if (glyph->width > 0 && glyph->height > 0)
+            {
+                int16_t gx1 = cursorX + glyph->xOffset;
+                int16_t gy1 = glyph->yOffset;
+                int16_t gx2 = gx1 + glyph->width - 1;
+                int16_t gy2 = gy1 + glyph->height - 1;
+                if (gx1 < minX)
+                    minX = gx1;
+                if (gy1 < minY)
+                    minY = gy1;
+                if (gx2 > maxX)
+                    maxX = gx2;
+                if (gy2 > maxY)
+                    maxY = gy2;
+            }
+            cursorX += glyph->xAdvance;
+        }
+    }
+
+    if (maxX >= minX && maxY >= minY)
+    {
+        *x1 = minX;
+        *y1 = minY;
+        *w = maxX - minX + 1;
+        *h = maxY - minY + 1;
+    }
+    else
+    {
+        *x1 = 0;
+        *y1 = 0;
+        *w = 0;
+        *h = 0;
+    }
+}
+
+uint32_t textMetricCalls()
+{
+    return metricCalls;
+}
+
+uint32_t contentHash(const char *text, uint16_t length)
+{
+    uint32_t hash = 2166136261u; // FNV-1a
+    for (uint16_t i = 0; i < length; i++)
+    {
+        hash ^= (uint8_t)text[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static uint16_t clampedLength(const char *text, uint16_t maxChars)
+{
+    size_t length = (text != nullptr) ? strlen(text) : 0;
+    if (maxChars > INFO_LAYOUT_MAX_CHARS)
+        maxChars = INFO_LAYOUT_MAX_CHARS;
+    return (length > maxChars) ? maxChars : (uint16_t)length;
+}
+
+const GFXfont *infoFont(const InfoFontSet &fonts, uint8_t fontIndex)
+{
+    if (fontIndex >= INFO_FONT_SIZES)
+        return fonts.emphasis[fontIndex - INFO_FONT_SIZES];
+    return fonts.regular[fontIndex];
+}
+
+// ===================================================================================
+// Width Tables
+// ===================================================================================
+static const GFXglyph *glyphFor(const GFXfont *font, char ch)
+{
+    uint8_t c = (uint8_t)ch;
+    if (c < font->first || c > font->last)
+        return nullptr; // Not in the font, print() skips it too
+    return &font->glyph[c - font->first];
+}
+
+// prefix[i] = advance of the first i characters, so any span is two lookups
+static void buildAdvancePrefix(const GFXfont *font, const char *text, uint16_t length, uint16_t *prefix)
+{
+    prefix[0] = 0;
+    for (uint16_t i = 0; i < length; i++)
+    {
+        const GFXglyph *glyph = glyphFor(font, text[i]);
+        prefix[i + 1] = prefix[i] + (glyph ? glyph->xAdvance : 0);
+    }
+}
+
+// Ink width of text[a..b) (b > a) from the prefix table; inkLeft = first
+// glyph's offset from the cursor, needed to center the ink rather than the cursor
+static int16_t spanWidth(const GFXfont *font, const char *text, const uint16_t *prefix,
+                         uint16_t a, uint16_t b, int16_t *inkLeft)
+{
+    const GFXglyph *first = glyphFor(font, text[a]);
+    const GFXglyph *last = glyphFor(font, text[b - 1]);
+    int16_t left = (first && first->width > 0) ? first->xOffset : 0;
+    int16_t lastRight = 0;
+    if (last)
+        lastRight = (last->width > 0) ? last->xOffset + last->width : last->xAdvance;
+    if (inkLeft)
+        *inkLeft = left;
+    return (int16_t)(prefix[b - 1] - prefix[a]) + lastRight - left;
+}
+
+// Ascent and line height of a font, measured once on "Aj" like the old code did
+struct FontMetrics
+{
+    const GFXfont *font;
+    int16_t ascent;
+    uint16_t height;
+};
+
+// Built-in regular and bold sets plus one set of Unicode fonts
+static const uint8_t FONT_METRICS_SLOTS = 3 * INFO_FONT_SIZES;
+static FontMetrics metricsCache[FONT_METRICS_SLOTS];
+static uint8_t metricsCached = 0;
+static uint8_t metricsNextSlot = 0; // Round robin once all slots are used
+
+void resetFontMetrics()
+{
+    metricsCached = 0;
+    metricsNextSlot = 0;
+}
+
+static FontMetrics fontMetrics(const GFXfont *font)
+{
+    for (uint8_t i = 0; i < metricsCached; i++)
+        if (metricsCache[i].font == font)
+            return metricsCache[i];
+
+    FontMetrics metrics;
+    int16_t x1, y1;
+    uint16_t w, h;
+    measureText(font, "Aj", 2, &x1, &y1, &w, &h);
+    metrics.font = font;
+    metrics.ascent = -y1;
+    metrics.height = h;
+    if (h == 0)
+    {
+        // No 'A' or 'j' in the font: fall back on the line spacing
+        metrics.ascent = font->yAdvance * 3 / 4;
+        metrics.height = font->yAdvance;
+    }
+
+    uint8_t slot = metricsNextSlot;
+    metricsNextSlot = (metricsNextSlot + 1) % FONT_METRICS_SLOTS;
+    if (metricsCached < FONT_METRICS_SLOTS)
+        metricsCached++;
+    metricsCache[slot] = metrics;
+    return metrics;
+}
+
+// ===================================================================================
+// Layout
+// ===================================================================================
+struct Paragraph
+{
+    uint16_t start;
+    uint16_t length;
+    int16_t oneLineWidth[2 * INFO_FONT_SIZES]; // Cached per font index, -1 = not computed yet
+};
+
+struct LayoutPass
+{
+    uint8_t lineCount;
+    bool overflow; // More lines than INFO_LAYOUT_MAX_LINES
+    int16_t height;
+    InfoLine lines[INFO_LAYOUT_MAX_LINES];
+    int16_t width[INFO_LAYOUT_MAX_LINES];
+    int16_t inkLeft[INFO_LAYOUT_MAX_LINES];
+    uint8_t paragraph[INFO_LAYOUT_MAX_LINES];
+};
+
+static int16_t oneLineWidth(Paragraph &para, const char *text, const InfoFontSet &fonts, uint8_t fontIndex)
+{
+    if (para.oneLineWidth[fontIndex] < 0)
+    {
+        uint16_t prefix[INFO_LAYOUT_MAX_CHARS + 1];
+        const GFXfont *font = infoFont(fonts, fontIndex);
+        buildAdvancePrefix(font, text + para.start, para.length, prefix);
+        para.oneLineWidth[fontIndex] = spanWidth(font, text + para.start, prefix, 0, para.length, nullptr);
+    }
+    return para.oneLineWidth[fontIndex];
+}
+
+// Largest size <= maxSize with the paragraph on one line, -1 if none. Widths
+// grow with the size, so this is a binary search over the cached widths.
+static int8_t largestFittingSize(Paragraph &para, const char *text, const InfoFontSet &fonts,
+                                 uint8_t family, int8_t maxSize, int16_t availW)
+{
+    int8_t lo = 0, hi = maxSize, best = -1;
+    while (lo <= hi)
+    {
+        int8_t mid = (lo + hi) / 2;
+        if (oneLineWidth(para, text, fonts, family + mid) <= availW)
+        {
+            best = mid;
+            lo = mid + 1;
+        }
+        else
+            hi = mid - 1;
+    }
+    return best;
+}
+
+static bool isBreakAfter(char c)
+{
+    return c == '@' || c == '.' || c == '-' || c == '/' || c == '_';
+}
+
+static void addLine(LayoutPass &pass, uint8_t paragraph, uint16_t start, uint16_t length,
+                    uint8_t fontIndex, int16_t width, int16_t inkLeft)
+{
+    if (pass.lineCount >= INFO_LAYOUT_MAX_LINES)
+    {
+        pass.overflow = true;
+        return;
+    }
+    uint8_t i = pass.lineCount++;
+    pass.lines[i].start = start;
+    pass.lines[i].length = length;
+    pass.lines[i].fontIndex = fontIndex;
+    pass.width[i] = width;
+    pass.inkLeft[i] = inkLeft;
+    pass.paragraph[i] = paragraph;
+}
+
+// Greedy word wrap: for each line, binary search the longest span that fits,
+// then back up to the last space (dropped) or break character (kept, so long
+// e-mail addresses split after '@' or '.'). A span with neither is cut hard.
+static void wrapParagraph(LayoutPass &pass, uint8_t index, const Paragraph &para, const char *text,
+                          const GFXfont *font, uint8_t fontIndex, int16_t availW)
+{
+    const char *p = text + para.start;
+    uint16_t prefix[INFO_LAYOUT_MAX_CHARS + 1];
+    buildAdvancePrefix(font, p, para.length, prefix);
+
+    uint16_t pos = 0;
+    while (pos < para.length)
+    {
+        while (pos < para.length && p[pos] == ' ')
+            pos++;
+        if (pos >= para.length)
+            break;
+
+        uint16_t lo = pos + 1, hi = para.length, fit = pos + 1; // At least one character per line
+        while (lo <= hi)
+        {
+            uint16_t mid = (lo + hi) / 2;
+            if (spanWidth(font, p, prefix, pos, mid, nullptr) <= availW)
+            {
+                fit = mid;
+                lo = mid + 1;
+            }
+            else
+                hi = mid - 1;
+        }
+
+        uint16_t end = fit, next = fit;
+        if (fit < para.length)
+        {
+            for (uint16_t i = fit; i > pos; i--)
+            {
+                if (p[i] == ' ')
+                {
+                    end = i;
+                    next = i + 1;
+                    break;
+                }
+                if (i < fit && isBreakAfter(p[i]))
+                {
+                    end = next = i + 1;
+                    break;
+                }
+            }
+        }
+        while (end > pos && p[end - 1] == ' ')
+            end--;
+
+        int16_t inkLeft;
+        int16_t width = spanWidth(font, p, prefix, pos, end, &inkLeft);
+        addLine(pass, index, para.start + pos, end - pos, fontIndex, width, inkLeft);
+        pos = next;
+    }
+}
+
+// One layout attempt with all sizes capped at sizeCap (name) / sizeCap - 1 (rest)
+static void layoutWithCap(Paragraph *paras, uint8_t paraCount, const char *text, const InfoFontSet &fonts,
+                          int8_t sizeCap, int16_t availW, LayoutPass &pass)
+{
+    pass.lineCount = 0;
+    pass.overflow = false;
+    pass.height = 0;
+
+    for (uint8_t i = 0; i < paraCount; i++)
+    {
+        bool emphasis = (i == 0);
+        uint8_t family = emphasis ? INFO_FONT_SIZES : 0;
+        int8_t maxSize = (emphasis || paraCount == 1 || sizeCap == 0) ? sizeCap : sizeCap - 1;
+
+        int8_t size = largestFittingSize(paras[i], text, fonts, family, maxSize, availW);
+        if (size >= 0)
+        {
+            uint16_t prefix[INFO_LAYOUT_MAX_CHARS + 1];
+            const GFXfont *font = infoFont(fonts, family + size);
+            buildAdvancePrefix(font, text + paras[i].start, paras[i].length, prefix);
+            int16_t inkLeft;
+            int16_t width = spanWidth(font, text + paras[i].start, prefix, 0, paras[i].length, &inkLeft);
+            addLine(pass, i, paras[i].start, paras[i].length, family + size, width, inkLeft);
+        }
+        else
+        {
+            // Too long even for the smallest size: wrap at 12 pt (or the cap if smaller)
+            int8_t wrapSize = (maxSize < 1) ? maxSize : 1;
+            wrapParagraph(pass, i, paras[i], text, infoFont(fonts, family + wrapSize), family + wrapSize, availW);
+        }
+    }
+
+    for (uint8_t i = 0; i < pass.lineCount; i++)
+    {
+        if (i > 0)
+            pass.height += (pass.paragraph[i] == pass.paragraph[i - 1]) ? INFO_WRAP_SPACING : INFO_PARAGRAPH_SPACING;
+        pass.height += fontMetrics(infoFont(fonts, pass.lines[i].fontIndex)).height;
+    }
+}
+
+void computeInfoLayout(const char *text, uint16_t maxChars, const InfoFontSet &fonts,
+                       int16_t areaW, int16_t areaH, InfoLayout &layout)
+{
+    uint16_t length = clampedLength(text, maxChars);
+    memset(&layout, 0, sizeof(layout));
+    layout.version = INFO_LAYOUT_VERSION;
+    layout.areaW = areaW;
+    layout.areaH = areaH;
+    layout.contentLength = length;
+    layout.contentHash = contentHash(text, length);
+
+    // Split on '\n', skipping empty fields
+    Paragraph paras[INFO_LAYOUT_MAX_LINES];
+    uint8_t paraCount = 0;
+    uint16_t pos = 0;
+    while (pos < length)
+    {
+        uint16_t end = pos;
+        while (end < length && text[end] != '\n')
+            end++;
+        if (end > pos)
+        {
+            if (paraCount == INFO_LAYOUT_MAX_LINES)
+            {
+                layout.truncated = true; // More fields than lines: the rest is never shown
+                break;
+            }
+            Paragraph &para = paras[paraCount++];
+            para.start = pos;
+            para.length = end - pos;
+            for (uint8_t f = 0; f < 2 * INFO_FONT_SIZES; f++)
+                para.oneLineWidth[f] = -1;
+        }
+        pos = end + 1;
+    }
+    if (paraCount == 0)
+        return;
+
+    // Largest cap whose block fits; widths are cached across attempts
+    int16_t availW = areaW - 2 * INFO_MARGIN_X;
+    LayoutPass pass;
+    for (int8_t cap = INFO_FONT_SIZES - 1; cap >= 0; cap--)
+    {
+        layoutWithCap(paras, paraCount, text, fonts, cap, availW, pass);
+        if (!pass.overflow && pass.height <= areaH)
+            break;
+    }
+
+    // Still too tall at the smallest size: drop trailing lines
+    while (pass.lineCount > 1 && (pass.overflow || pass.height > areaH))
+    {
+        pass.lineCount--;
+        pass.overflow = false;
+        pass.height -= fontMetrics(infoFont(fonts, pass.lines[pass.lineCount].fontIndex)).height;
+        pass.height -= (pass.paragraph[pass.lineCount] == pass.paragraph[pass.lineCount - 1]) ? INFO_WRAP_SPACING
+                                                                                               : INFO_PARAGRAPH_SPACING;
+        layout.truncated = true;
+    }
+
+    // Center the block vertically and each line's ink horizontally
+    int top = (areaH - pass.height) / 2;
+    if (top < 0)
+        top = 0;
+    layout.lineCount = pass.lineCount;
+    for (uint8_t i = 0; i < pass.lineCount; i++)
+    {
+        InfoLine &line = layout.lines[i];
+        line = pass.lines[i];
+        FontMetrics metrics = fontMetrics(infoFont(fonts, line.fontIndex));
+        if (i > 0)
+            top += (pass.paragraph[i] == pass.paragraph[i - 1]) ? INFO_WRAP_SPACING : INFO_PARAGRAPH_SPACING;
+        line.x = (int16_t)((areaW - pass.width[i]) / 2 - pass.inkLeft[i]);
+        line.baselineY = (int16_t)(top + metrics.ascent);
+        top += metrics.height;
+    }
+}
+
+bool infoLayoutMatches(const InfoLayout &layout, const char *text, uint16_t maxChars, int16_t areaW, int16_t areaH)
+{
+    uint16_t length = clampedLength(text, maxChars);
+    return layout.version == INFO_LAYOUT_VERSION &&
+           layout.areaW == areaW && layout.areaH == areaH &&
+           layout.contentLength == length &&
+           layout.contentHash == contentHash(text, length);
+}
+
+static bool sameLine(const InfoLine &a, const char *aText, const InfoLine &b, const char *bText)
+{
+    return a.fontIndex == b.fontIndex && a.x == b.x && a.baselineY == b.baselineY && a.length == b.length &&
+           memcmp(aText + a.start, bText + b.start, a.length) == 0;
+}
+
+static void addLineBounds(const InfoLine &line, const char *text, const InfoFontSet &fonts, int16_t &x1, int16_t &y1,
+                          int16_t &x2, int16_t &y2)
+{
+    int16_t bx, by;
+    uint16_t bw, bh;
+    measureText(infoFont(fonts, line.fontIndex), text + line.start, line.length, &bx, &by, &bw, &bh);
+    if (bw == 0 || bh == 0)
+        return;
+    bx += line.x;
+    by += line.baselineY;
+    if (bx < x1)
+        x1 = bx;
+    if (by < y1)
+        y1 = by;
+    if (bx + (int16_t)bw > x2)
+        x2 = bx + bw;
+    if (by + (int16_t)bh > y2)
+        y2 = by + bh;
+}
+
+uint8_t infoLayoutChangedArea(const InfoLayout &before, const char *beforeText, const InfoLayout &after,
+                              const char *afterText, const InfoFontSet &fonts, int16_t &x, int16_t &y, int16_t &w,
+                              int16_t &h)
+{
+    uint8_t changed = 0;
+    int16_t x1 = 0x7FFF, y1 = 0x7FFF, x2 = -0x7FFF, y2 = -0x7FFF;
+    uint8_t count = before.lineCount > after.lineCount ? before.lineCount : after.lineCount;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        bool inBefore = i < before.lineCount, inAfter = i < after.lineCount;
+        if (inBefore && inAfter && sameLine(before.lines[i], beforeText, after.lines[i], afterText))
+            continue; // Drawn the same: stays out of the area
+        changed++;
+        if (inBefore)
+            addLineBounds(before.lines[i], beforeText, fonts, x1, y1, x2, y2);
+        if (inAfter)
+            addLineBounds(after.lines[i], afterText, fonts, x1, y1, x2, y2);
+    }
+    bool ink = x2 > x1 && y2 > y1;
+    x = ink ? x1 : 0;
+    y = ink ? y1 : 0;
+    w = ink ? x2 - x1 : 0;
+    h = ink ? y2 - y1 : 0;
+    return changed;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file text_layout.h
+ * @brief Info screen layout, computed once per content change.
+ *        Each '\n' separated field gets the largest font of the set that fits
+ *        it on one line; fields too long even for the smallest font are word
+ *        wrapped. If the block is taller than the area, all sizes step down
+ *        until it fits. The first field (the name) uses the emphasis family and
+ *        stays one size above the rest.
+ *        Widths come from prefix sums of the glyph advances, and fit / wrap
+ *        points are found by binary search over them, so nothing is trial
+ *        rendered. Metrics are read from the GFXfont glyph tables (same
+ *        result as Adafruit_GFX::getTextBounds() without wrapping), so no
+ *        display object is needed and the record can be stored in NVS.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <gfxfont.h>
+
+const uint8_t INFO_LAYOUT_VERSION = 3;
+const uint8_t INFO_LAYOUT_MAX_LINES = 10;   // Visual lines (after wrapping)
+const uint16_t INFO_LAYOUT_MAX_CHARS = 256; // Longer content is clamped
+const uint8_t INFO_FONT_SIZES = 4;          // Font sizes per family, smallest first
+const uint8_t INFO_PARAGRAPH_SPACING = 5;   // Pixels between fields
+const uint8_t INFO_WRAP_SPACING = 3;        // Pixels between wrapped lines of one field
+const uint8_t INFO_MARGIN_X = 4;            // Left/right margin kept free
+
+// Font families used by the layout, each smallest size first (e.g. 9/12/18/24 pt)
+struct InfoFontSet
+{
+    const GFXfont *regular[INFO_FONT_SIZES];
+    const GFXfont *emphasis[INFO_FONT_SIZES]; // Name line
+};
+
+struct InfoLine
+{
+    uint16_t start;    // Offset of the line in the content string
+    uint16_t length;   // Characters in the line (no '\n', no wrap spaces)
+    uint8_t fontIndex; // Size index, + INFO_FONT_SIZES for the emphasis family
+    int16_t x;         // Cursor X
+    int16_t baselineY; // Cursor Y (baseline)
+};
+
+// Plain data so it can be stored next to the content as an NVS blob
+struct InfoLayout
+{
+    uint8_t version;
+    uint8_t lineCount; // 0 = nothing to draw (empty content)
+    int16_t areaW;
+    int16_t areaH;
+    uint16_t contentLength;
+    uint32_t contentHash;
+    bool truncated; // Did not fit even at the smallest size, or more fields than lines; trailing lines dropped
+    InfoLine lines[INFO_LAYOUT_MAX_LINES];
+};
+
+// Font for an InfoLine::fontIndex
+const GFXfont *infoFont(const InfoFontSet &fonts, uint8_t fontIndex);
+
+// Bounds of `length` characters drawn at cursor (0,0), like getTextBounds()
+void measureText(const GFXfont *font, const char *text, uint16_t length,
+                 int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h);
+
+// Number of measureText() calls so far (for the per-refresh statistics)
+uint32_t textMetricCalls();
+
+// Line metrics are measured once per font (on "Aj") and cached by GFXfont
+// pointer. Fonts whose glyphs change in place (FlashFont::load()) need this
+// called afterwards.
+void resetFontMetrics();
+
+uint32_t contentHash(const char *text, uint16_t length);
+
+// Lays out `text` ('\n' separated fields, empty ones skipped, at most maxChars
+// used), centered in areaW x areaH.
+void computeInfoLayout(const char *text, uint16_t maxChars, const InfoFontSet &fonts,
+                       int16_t areaW, int16_t areaH, InfoLayout &layout);
+
+// True if `layout` was computed for exactly this content and area
+bool infoLayoutMatches(const InfoLayout &layout, const char *text, uint16_t maxChars, int16_t areaW, int16_t areaH);
+
+// Lines that differ between two layouts of the same area and fonts (font,
+// position or characters), and the area their ink covers before and after
+// (w = 0 if none has ink). Unchanged lines stay out of it, so a patch that
+// only touches one field redraws one field.
+uint8_t infoLayoutChangedArea(const InfoLayout &before, const char *beforeText, const InfoLayout &after,
+                              const char *afterText, const InfoFontSet &fonts, int16_t &x, int16_t &y, int16_t &w,
+                              int16_t &h);
@@ -0,0 +1,113 @@
+/**
+ * @file battery_check.cpp
+ * @brief Host check of the battery math (battery_model.cpp): LiPo curve end
+ *        points and interpolation between table points, the interquartile
+ *        mean with TX dips and spikes (and more than 128 samples), the RTC
+ *        filter across deep sleep with re-seeding after a charger jump, and
+ *        the notification hysteresis. Build and run:
+ *
+ *          g++ -std=c++11 -Isrc tools/battery_check.cpp src/battery_model.cpp -o battery_check && ./battery_check
+ */
+#include <stdio.h>
+
+#include "battery_model.h"
+
+static int failures = 0;
+
+static void check(const char *name, bool ok)
+{
+    printf("%-58s %s\n", name, ok ? "ok" : "FAIL");
+    if (!ok)
+        failures++;
+}
+
+static void curveChecks()
+{
+    check("curve: 4200 mV and above is 100 %",
+          lipoPercentFromMillivolts(4200) == 100 && lipoPercentFromMillivolts(4350) == 100);
+    check("curve: 3270 mV and below is 0 %", lipoPercentFromMillivolts(3270) == 0 && lipoPercentFromMillivolts(0) == 0);
+    check("curve: table points exact", lipoPercentFromMillivolts(3840) == 50 && lipoPercentFromMillivolts(3610) == 5 &&
+                                           lipoPercentFromMillivolts(4150) == 95);
+    // 3690 mV = 10 %, 3610 mV = 5 %: 3650 is halfway, 3655 rounds 7.8 up to 8
+    check("curve: interpolated between points",
+          lipoPercentFromMillivolts(3650) == 8 && lipoPercentFromMillivolts(3655) == 8 &&
+              lipoPercentFromMillivolts(3620) == 6);
+    // 3270 mV = 0 %, 3610 mV = 5 %: 68 mV per percent
+    check("curve: steep low end", lipoPercentFromMillivolts(3304) == 1 && lipoPercentFromMillivolts(3440) == 3);
+    bool monotonic = true;
+    for (uint16_t mv = 3000; mv < 4300; mv++)
+        monotonic = monotonic && lipoPercentFromMillivolts(mv + 1) >= lipoPercentFromMillivolts(mv);
+    check("curve: never decreases with voltage", monotonic);
+}
+
+static void meanChecks()
+{
+    uint16_t samples[16];
+    for (uint16_t &sample : samples)
+        sample = 3900;
+    samples[2] = 3500; // TX dips
+    samples[7] = 3480;
+    samples[11] = 3520;
+    samples[14] = 4300; // Spike
+    check("mean: dips and spike ignored", robustMeanMillivolts(samples, 16) == 3900);
+    check("mean: samples sorted in place", samples[0] == 3480 && samples[15] == 4300);
+
+    uint16_t ramp[8] = {3807, 3801, 3806, 3802, 3808, 3803, 3805, 3804};
+    check("mean: middle half averaged, rounded", robustMeanMillivolts(ramp, 8) == 3805); // (3803..3806) = 3804.5
+
+    uint16_t three[3] = {3000, 4000, 3800};
+    check("mean: tiny counts use every sample", robustMeanMillivolts(three, 3) == 3600);
+    check("mean: no samples is 0", robustMeanMillivolts(nullptr, 8) == 0 && robustMeanMillivolts(three, 0) == 0);
+
+    uint16_t many[200];
+    for (int i = 0; i < 200; i++)
+        many[i] = 4000 - i; // Reverse order: every insertion moves to the front
+    bool sorted = robustMeanMillivolts(many, 200) == 3901; // Middle half 3851..3950, mean 3900.5
+    for (int i = 1; i < 200; i++)
+        sorted = sorted && many[i - 1] <= many[i];
+    check("mean: 200 samples sorted and averaged", sorted);
+}
+
+static void filterChecks()
+{
+    BatteryFilterState rtc; // As in RTC_DATA_ATTR memory: garbage after a cold boot
+    rtc.magic = 0x12345678;
+    rtc.millivolts = -1.0f;
+    {
+        BatteryFilter filter(rtc);
+        check("filter: no value before the first sample", !filter.hasValue() && filter.value() == 0);
+        check("filter: first sample seeds it", filter.update(3800) == 3800);
+        check("filter: small steps are smoothed", filter.update(3850) == 3810);
+    }
+    {
+        BatteryFilter filter(rtc); // After deep sleep: same state, new object
+        check("filter: value kept across deep sleep", filter.hasValue() && filter.value() == 3810);
+        check("filter: charger plugged in re-seeds", filter.update(4120) == 4120);
+        check("filter: charger removed re-seeds", filter.update(3900) == 3900);
+        check("filter: step at the threshold is smoothed", filter.update(4050) == 3930);
+        filter.reset();
+        check("filter: reset drops the value", !filter.hasValue() && filter.update(3700) == 3700);
+    }
+}
+
+static void reporterChecks()
+{
+    BatteryReporter reporter(3);
+    bool first = reporter.offer(80);
+    bool small = reporter.offer(82) || reporter.offer(78);
+    bool moved = reporter.offer(77);
+    reporter.requestImmediate();
+    bool immediate = reporter.offer(77);
+    check("reporter: first, hysteresis, immediate",
+          first && !small && moved && immediate && reporter.sent() == 3 && reporter.suppressed() == 2);
+}
+
+int main()
+{
+    curveChecks();
+    meanChecks();
+    filterChecks();
+    reporterChecks();
+    printf("\n%d failure(s)\n", failures);
+    return failures == 0 ? 0 : 1;
+}
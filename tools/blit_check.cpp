@@ -0,0 +1,170 @@
+/**
+ * @file blit_check.cpp
+ * @brief Host check: the packed glyph blitter against a per-pixel reference
+ *        that follows Adafruit_GFX::drawChar() and GxEPD2_BW::drawPixel().
+ *        Text is placed the way drawCenteredText() does it, plus positions
+ *        that clip at every edge, for all four rotations, full frames and
+ *        page bands. Any differing byte fails the run. Build and run:
+ *
+ *          g++ -std=c++11 -Itools/host -Isrc -I".pio/libdeps/t5_213/Adafruit GFX Library" \
+ *              tools/blit_check.cpp src/glyph_blit.cpp src/text_layout.cpp -o blit_check && ./blit_check
+ */
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include <Adafruit_GFX.h>
+#include <Fonts/FreeSans9pt7b.h>
+#include <Fonts/FreeSans12pt7b.h>
+#include <Fonts/FreeSans18pt7b.h>
+#include <Fonts/FreeSans24pt7b.h>
+#include <Fonts/FreeSansBold9pt7b.h>
+#include <Fonts/FreeSansBold12pt7b.h>
+#include <Fonts/FreeSansBold18pt7b.h>
+#include <Fonts/FreeSansBold24pt7b.h>
+
+#include "glyph_blit.h"
+#include "text_layout.h"
+
+// GDEY0213B74: 128 (122 visible) x 250
+static const uint16_t NATIVE_STRIDE = 128 / 8;
+static const int16_t NATIVE_W = 122, NATIVE_H = 250;
+static const size_t FRAME_BYTES = NATIVE_STRIDE * NATIVE_H;
+
+struct Reference
+{
+    uint8_t *buffer;
+    uint8_t rotation;
+    int16_t bandY, bandH;
+    uint32_t pixelCalls;
+};
+
+static void referencePixel(Reference &ref, int16_t x, int16_t y)
+{
+    ref.pixelCalls++;
+    int16_t w = (ref.rotation & 1) ? NATIVE_H : NATIVE_W;
+    int16_t h = (ref.rotation & 1) ? NATIVE_W : NATIVE_H;
+    if (x < 0 || x >= w || y < 0 || y >= h)
+        return;
+    int16_t t;
+    switch (ref.rotation)
+    {
+    case 1:
+        t = x, x = y, y = t;
+        x = NATIVE_W - x - 1;
+        break;
+    case 2:
+        x = NATIVE_W - x - 1;
+        y = NATIVE_H - y - 1;
+        break;
+    case 3:
+        t = x, x = y, y = t;
+        y = NATIVE_H - y - 1;
+        break;
+    }
+    y -= ref.bandY;
+    if (y < 0 || y >= ref.bandH)
+        return;
+    ref.buffer[x / 8 + y * NATIVE_STRIDE] &= (0xFF ^ (1 << (7 - x % 8)));
+}
+
+static void referenceText(Reference &ref, const GFXfont *font, int16_t x, int16_t y, const char *text)
+{
+    for (; *text; text++)
+    {
+        uint8_t c = (uint8_t)*text;
+        if (c < font->first || c > font->last)
+            continue;
+        const GFXglyph *glyph = &font->glyph[c - font->first];
+        const uint8_t *bitmap = font->bitmap;
+        uint16_t bo = glyph->bitmapOffset;
+        uint8_t bits = 0, bit = 0;
+        for (uint8_t yy = 0; yy < glyph->height; yy++)
+        {
+            for (uint8_t xx = 0; xx < glyph->width; xx++)
+            {
+                if (!(bit++ & 7))
+                    bits = bitmap[bo++];
+                if (bits & 0x80)
+                    referencePixel(ref, x + glyph->xOffset + xx, y + glyph->yOffset + yy);
+                bits <<= 1;
+            }
+        }
+        x += glyph->xAdvance;
+    }
+}
+
+int main()
+{
+    const GFXfont *fonts[] = {&FreeSans9pt7b, &FreeSans12pt7b, &FreeSans18pt7b, &FreeSans24pt7b,
+                              &FreeSansBold9pt7b, &FreeSansBold12pt7b, &FreeSansBold18pt7b, &FreeSansBold24pt7b};
+    const char *texts[] = {"Jane Doe", "jane.doe@example.com", "+1 555 0100", "No QR Data Available",
+                           "!\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~"};
+    const int16_t BANDS[] = {NATIVE_H, 64, 50}; // Full frame, then paged buffers of these heights
+
+    static uint8_t expected[FRAME_BYTES], actual[FRAME_BYTES];
+    unsigned cases = 0, failures = 0;
+    uint64_t referenceCalls = 0;
+    double referenceUs = 0, blitUs = 0;
+
+    for (uint8_t rotation = 0; rotation < 4; rotation++)
+        for (unsigned f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++)
+            for (const char *text : texts)
+                for (int16_t bandH : BANDS)
+                {
+                    const GFXfont *font = fonts[f];
+                    int16_t width = (rotation & 1) ? NATIVE_H : NATIVE_W;
+                    int16_t height = (rotation & 1) ? NATIVE_W : NATIVE_H;
+
+                    // drawCenteredText() placement, then positions clipping each edge
+                    int16_t x1, y1;
+                    uint16_t w, h;
+                    measureText(font, text, (uint16_t)strlen(text), &x1, &y1, &w, &h);
+                    int16_t centerX = (width - (int16_t)w) / 2;
+                    int16_t centerY = height / 2;
+                    if (centerY < -y1)
+                        centerY = -y1;
+                    if (centerY > height - ((int16_t)h + y1))
+                        centerY = height - ((int16_t)h + y1);
+                    const int16_t positions[][2] = {{centerX, centerY}, {-7, centerY}, {(int16_t)(width - 20), centerY},
+                                                    {centerX, 3}, {centerX, (int16_t)(height + 5)}, {-3, -2}};
+
+                    for (const auto &pos : positions)
+                        for (int16_t bandY = 0; bandY < NATIVE_H; bandY += bandH)
+                        {
+                            int16_t rows = (bandY + bandH <= NATIVE_H) ? bandH : NATIVE_H - bandY;
+                            memset(expected, 0xFF, FRAME_BYTES);
+                            Reference ref = {expected, rotation, bandY, rows, 0};
+                            auto t0 = std::chrono::steady_clock::now();
+                            referenceText(ref, font, pos[0], pos[1], text);
+                            auto t1 = std::chrono::steady_clock::now();
+
+                            PackedFrame frame = packedFrame(actual, NATIVE_STRIDE, NATIVE_W, NATIVE_H, rotation);
+                            frame.bandY = bandY;
+                            frame.bandH = rows;
+                            frameFill(frame, false);
+                            blitText(frame, font, pos[0], pos[1], text, (uint16_t)strlen(text));
+                            auto t2 = std::chrono::steady_clock::now();
+
+                            referenceCalls += ref.pixelCalls;
+                            referenceUs += std::chrono::duration<double, std::micro>(t1 - t0).count();
+                            blitUs += std::chrono::duration<double, std::micro>(t2 - t1).count();
+                            cases++;
+                            if (memcmp(expected, actual, (size_t)NATIVE_STRIDE * rows) != 0)
+                            {
+                                failures++;
+                                if (failures <= 10)
+                                    printf("MISMATCH rotation %u font %u text '%.12s' at (%d,%d) band %d+%d\n",
+                                           rotation, f, text,
+                                           pos[0], pos[1], bandY, rows);
+                            }
+                        }
+                }
+
+    printf("%u cases, %u mismatches\n", cases, failures);
+    printf("glyphs: %lu span path, %lu per-pixel fallback\n",
+           (unsigned long)blitFastGlyphs(), (unsigned long)blitFallbackGlyphs());
+    printf("reference: %llu pixel calls, %.0f us total; blitter: %.0f us total\n",
+           (unsigned long long)referenceCalls, referenceUs, blitUs);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,268 @@
+/**
+ * @file button_check.cpp
+ * @brief Host check of the button state machines (button_input.cpp) with
+ *        synthetic timestamps: contact bounce is filtered, a click is told
+ *        apart from a double-click, a long-press fires at its threshold, and
+ *        while the display is busy the latest intent wins and is held until
+ *        setBusy(false). Sleep on long-press: the button only counts as
+ *        released after a debounced release (what enterDeepSleep() waits for),
+ *        and a press held across the wake-up gives no gesture. The
+ *        "config:button:" mapping parser. The ISR -> loop() EdgeQueue is
+ *        checked too: order across wrap-around, drops counted when full, and
+ *        edges queued during a refresh recognized by their own timestamps when
+ *        pumped later (as pumpButtonEdges() does). Build and run:
+ *
+ *          g++ -std=c++11 -Isrc tools/button_check.cpp src/button_input.cpp -o button_check && ./button_check
+ */
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "button_input.h"
+#include "edge_queue.h"
+
+static int failures = 0;
+
+static void check(const char *name, bool ok)
+{
+    printf("%-58s %s\n", name, ok ? "ok" : "FAIL");
+    if (!ok)
+        failures++;
+}
+
+struct Gesture
+{
+    ButtonGesture gesture;
+    uint32_t atMs;
+    bool operator==(const Gesture &other) const { return gesture == other.gesture && atMs == other.atMs; }
+};
+typedef std::vector<Gesture> Gestures;
+
+// Recognizer with the firmware's timings (BUTTON_DEBOUNCE_MS etc. in main.cpp)
+struct Button
+{
+    GestureRecognizer recognizer{30, 300, 1000};
+    Gestures seen;
+
+    void edge(bool pressed, uint32_t timeMs)
+    {
+        ButtonGesture gesture;
+        uint32_t atMs;
+        if (recognizer.onEdge(pressed, timeMs, gesture, atMs))
+            seen.push_back({gesture, atMs});
+    }
+    void poll(uint32_t nowMs, bool pressedNow)
+    {
+        ButtonGesture gesture;
+        uint32_t atMs;
+        if (recognizer.poll(nowMs, pressedNow, gesture, atMs))
+            seen.push_back({gesture, atMs});
+    }
+};
+
+static void gestureChecks()
+{
+    {
+        Button button;
+        button.edge(true, 1000);
+        button.edge(false, 1005); // Bounces of the press
+        button.edge(true, 1012);
+        button.edge(false, 1100);
+        button.edge(true, 1110); // Bounces of the release
+        button.edge(false, 1118);
+        button.poll(1399, false);
+        check("bounce: nothing before the double-click window ends", button.seen.empty());
+        button.poll(1401, false);
+        check("bounce: one click, at release + 300 ms", button.seen == Gestures{{GESTURE_CLICK, 1400}});
+    }
+    {
+        Button button;
+        button.edge(true, 1000);
+        button.edge(false, 1080);
+        button.edge(true, 1200);
+        button.edge(false, 1280);
+        button.poll(3000, false);
+        check("double-click: reported on the second release, no click",
+              button.seen == Gestures{{GESTURE_DOUBLE_CLICK, 1280}});
+    }
+    {
+        Button button;
+        button.edge(true, 1000);
+        button.edge(false, 1080);
+        button.edge(true, 1400); // After the window: a second click
+        button.edge(false, 1480);
+        button.poll(2000, false);
+        check("two slow clicks: two clicks", button.seen == Gestures{{GESTURE_CLICK, 1380}, {GESTURE_CLICK, 1780}});
+    }
+    {
+        Button button;
+        button.edge(true, 1000);
+        check("long-press: deadline is the threshold", button.recognizer.msUntilDeadline(1000) == 1000);
+        button.poll(1999, true);
+        check("long-press: nothing 1 ms before the threshold", button.seen.empty());
+        button.poll(2000, true);
+        check("long-press: fires at the threshold", button.seen == Gestures{{GESTURE_LONG_PRESS, 2000}});
+        button.edge(false, 2600);
+        button.poll(4000, false);
+        check("long-press: release adds nothing", button.seen.size() == 1 && button.recognizer.isIdle());
+    }
+    {
+        Button button;
+        button.edge(true, 1000);
+        button.poll(1020, false); // Release swallowed by the debounce filter
+        button.poll(1050, false); // Re-synced from the pin level
+        button.poll(1400, false);
+        check("swallowed release: re-synced from the pin, one click",
+              button.seen == Gestures{{GESTURE_CLICK, 1350}});
+    }
+}
+
+static void sleepChecks()
+{
+    {
+        Button button;
+        button.edge(true, 1000);
+        button.poll(2000, true);
+        check("sleep: long-press fires with the button down",
+              button.seen == Gestures{{GESTURE_LONG_PRESS, 2000}} && !button.recognizer.isReleased(2000));
+        check("sleep: still held, not released", !button.recognizer.isReleased(5000));
+        button.edge(false, 5200);
+        button.edge(true, 5205); // Bounces of the release
+        button.edge(false, 5212);
+        check("sleep: not released within the debounce time", !button.recognizer.isReleased(5220));
+        button.poll(5230, false);
+        check("sleep: released after the debounce time", button.recognizer.isReleased(5230));
+        button.poll(6000, false);
+        check("sleep: release adds no gesture", button.seen.size() == 1);
+    }
+    {
+        // After the wake-up: the button that woke the chip is still down
+        Button button;
+        button.recognizer.begin(true, 50);
+        button.poll(100, true);
+        button.poll(1500, true); // Longer than a long-press: still the wake-up press
+        check("wake: held press gives no long-press", button.seen.empty() && !button.recognizer.isReleased(1500));
+        button.edge(false, 1600);
+        button.poll(2500, false);
+        check("wake: its release gives no click", button.seen.empty() && button.recognizer.isReleased(2500));
+        button.edge(true, 3000);
+        button.edge(false, 3080);
+        button.poll(3500, false);
+        check("wake: the next press is a click", button.seen == Gestures{{GESTURE_CLICK, 3380}});
+    }
+    {
+        Button button;
+        button.recognizer.begin(false, 50);
+        check("boot: button up is released", button.recognizer.isReleased(100));
+    }
+}
+
+static void mappingChecks()
+{
+    ButtonInput input;
+    ButtonMapping mapping = input.mapping();
+    check("mapping: defaults", mapping.action[GESTURE_CLICK] == ACTION_NEXT_MODE &&
+                                   mapping.action[GESTURE_DOUBLE_CLICK] == ACTION_SHOW_SPLIT &&
+                                   mapping.action[GESTURE_LONG_PRESS] == ACTION_SLEEP);
+    check("mapping: listed gestures change, others kept",
+          parseButtonMapping("long=blank,click=qr", mapping) && mapping.action[GESTURE_CLICK] == ACTION_SHOW_QR &&
+              mapping.action[GESTURE_DOUBLE_CLICK] == ACTION_SHOW_SPLIT &&
+              mapping.action[GESTURE_LONG_PRESS] == ACTION_SHOW_BLANK);
+    ButtonMapping before = mapping;
+    bool rejected = !parseButtonMapping("click=next,triple=sleep", mapping) &&
+                    !parseButtonMapping("click=explode", mapping) && !parseButtonMapping("click", mapping) &&
+                    !parseButtonMapping("", mapping) && !parseButtonMapping("=next", mapping);
+    check("mapping: unknown names rejected, nothing changed",
+          rejected && memcmp(&before, &mapping, sizeof(mapping)) == 0);
+    input.setMapping(mapping);
+    input.onGesture(GESTURE_LONG_PRESS, 100);
+    check("mapping: applied to the intents", input.takeIntent() == ACTION_SHOW_BLANK);
+    ButtonMapping stored = mapping;
+    stored.action[GESTURE_CLICK] = ACTION_COUNT; // Corrupt NVS blob
+    input.setMapping(stored);
+    check("mapping: invalid stored mapping ignored", input.actionFor(GESTURE_CLICK) == ACTION_SHOW_QR);
+}
+
+static void intentChecks()
+{
+    ButtonInput input;
+    input.setBusy(true);
+    input.onGesture(GESTURE_CLICK, 100);
+    check("busy: intent held", input.hasIntent() && input.takeIntent() == ACTION_NONE);
+    input.onGesture(GESTURE_DOUBLE_CLICK, 400);
+    check("busy: newer gesture replaces the held one", input.superseded() == 1 && input.queuedWhileBusy() == 2);
+    check("busy: age of the latest intent", input.intentAgeMs(1000) == 600);
+    check("busy: still held", input.takeIntent() == ACTION_NONE);
+    input.setBusy(false);
+    check("setBusy(false): latest intent released", input.takeIntent() == ACTION_SHOW_SPLIT);
+    check("setBusy(false): released once", !input.hasIntent() && input.takeIntent() == ACTION_NONE);
+
+    input.setAction(GESTURE_LONG_PRESS, ACTION_NONE);
+    input.onGesture(GESTURE_LONG_PRESS, 2000);
+    check("unmapped gesture: no intent", !input.hasIntent());
+    input.onGesture(GESTURE_CLICK, 2100);
+    check("idle: intent handed out at once", input.takeIntent() == ACTION_NEXT_MODE);
+}
+
+static void queueChecks()
+{
+    {
+        EdgeQueue<ButtonEdge, 4> queue; // Holds 3
+        bool inOrder = true;
+        uint32_t next = 0, popped = 0;
+        for (int round = 0; round < 10; round++)
+        {
+            for (int i = 0; i < 1 + round % 3; i++, next++)
+                inOrder = queue.push({next, (next & 1) != 0}) && inOrder;
+            ButtonEdge edge;
+            for (; queue.pop(edge); popped++)
+                inOrder = edge.timeMs == popped && edge.pressed == ((popped & 1) != 0) && inOrder;
+        }
+        check("queue: order kept across wrap-around", inOrder && popped == next && queue.empty());
+    }
+    {
+        EdgeQueue<ButtonEdge, 4> queue;
+        bool pushed = queue.push({1, true}) && queue.push({2, false}) && queue.push({3, true});
+        bool full = !queue.push({4, false}) && !queue.push({5, true});
+        check("queue: full queue refuses and counts drops", pushed && full && queue.droppedCount() == 2);
+        ButtonEdge edge;
+        bool kept = queue.pop(edge) && edge.timeMs == 1 && queue.pop(edge) && edge.timeMs == 2 && queue.pop(edge) &&
+                    edge.timeMs == 3 && !queue.pop(edge);
+        check("queue: the oldest edges are kept", kept);
+        check("queue: room again after popping", queue.push({6, false}) && queue.droppedCount() == 2);
+    }
+    {
+        // Edges the ISR queues while a refresh blocks loop(), pumped at 5000 ms
+        EdgeQueue<ButtonEdge, 32> queue;
+        Button button;
+        ButtonInput input;
+        input.setBusy(true);
+        const ButtonEdge edges[] = {{1000, true}, {1080, false}, {1200, true}, {1280, false}, // Double-click
+                                    {2000, true}, {2090, false},                              // Click
+                                    {3000, true}, {4500, false}};                             // Long-press
+        for (const ButtonEdge &edge : edges)
+            queue.push(edge);
+        ButtonEdge edge;
+        while (queue.pop(edge))
+            button.edge(edge.pressed, edge.timeMs);
+        button.poll(5000, false);
+        check("busy queue: gestures timed by the edges, not by the pump",
+              button.seen == Gestures{{GESTURE_DOUBLE_CLICK, 1280}, {GESTURE_CLICK, 2390}, {GESTURE_LONG_PRESS, 4000}});
+        for (const Gesture &gesture : button.seen)
+            input.onGesture(gesture.gesture, gesture.atMs);
+        check("busy queue: nothing handed out during the refresh", input.takeIntent() == ACTION_NONE);
+        input.setBusy(false);
+        check("busy queue: the last gesture is the intent", input.takeIntent() == ACTION_SLEEP);
+    }
+}
+
+int main()
+{
+    gestureChecks();
+    intentChecks();
+    sleepChecks();
+    mappingChecks();
+    queueChecks();
+    printf("\n%d failure(s)\n", failures);
+    return failures == 0 ? 0 : 1;
+}
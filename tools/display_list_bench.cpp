@@ -0,0 +1,259 @@
+/**
+ * @file display_list_bench.cpp
+ * @brief Host benchmark: drawing a screen once per page band, immediate mode
+ *        (all drawing logic re-run for every band, as the GxEPD2 page loop
+ *        does) against a display list recorded once and replayed per band
+ *        with band culling. Reports ops executed and time per band, and
+ *        checks both give the same frame, with rectangles and bitmaps also
+ *        compared against per-pixel drawing. Build and run:
+ *
+ *          g++ -std=c++11 -Itools/host -Isrc -I".pio/libdeps/t5_213/Adafruit GFX Library" \
+ *              tools/display_list_bench.cpp src/display_list.cpp src/glyph_blit.cpp src/text_layout.cpp \
+ *              -o display_list_bench && ./display_list_bench
+ */
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include <Adafruit_GFX.h>
+#include <Fonts/FreeSans9pt7b.h>
+#include <Fonts/FreeSans12pt7b.h>
+#include <Fonts/FreeSans18pt7b.h>
+#include <Fonts/FreeSans24pt7b.h>
+#include <Fonts/FreeSansBold9pt7b.h>
+#include <Fonts/FreeSansBold12pt7b.h>
+#include <Fonts/FreeSansBold18pt7b.h>
+#include <Fonts/FreeSansBold24pt7b.h>
+
+#include "display_list.h"
+#include "glyph_blit.h"
+#include "text_layout.h"
+
+static const InfoFontSet FONTS = {
+    {&FreeSans9pt7b, &FreeSans12pt7b, &FreeSans18pt7b, &FreeSans24pt7b},
+    {&FreeSansBold9pt7b, &FreeSansBold12pt7b, &FreeSansBold18pt7b, &FreeSansBold24pt7b}};
+static const uint16_t MAX_CHARS = 250; // MAX_INFO_INPUT_STRING_LENGTH
+
+// GDEY0213B74: 128 (122 visible) x 250, rotation 1 as on the badge
+static const uint16_t NATIVE_STRIDE = 128 / 8;
+static const int16_t NATIVE_W = 122, NATIVE_H = 250;
+static const uint8_t ROTATION = 1;
+static const size_t FRAME_BYTES = NATIVE_STRIDE * NATIVE_H;
+static const int16_t AREA_W = NATIVE_H, AREA_H = NATIVE_W;
+
+// Version 7 QR: 45 x 45 modules at scale 2, pattern stands in for real data
+static const uint16_t QR_SIZE = 45;
+static const uint8_t QR_SCALE = 2;
+static uint8_t qrBits[(QR_SIZE * QR_SIZE + 7) / 8];
+
+enum Screen
+{
+    SCREEN_INFO,
+    SCREEN_QR
+};
+
+struct Result
+{
+    uint32_t ops;
+    double us;
+};
+
+static PackedFrame bandFrame(uint8_t *buffer, int16_t bandY, int16_t bandH)
+{
+    PackedFrame frame = packedFrame(buffer, NATIVE_STRIDE, NATIVE_W, NATIVE_H, ROTATION);
+    frame.bandY = bandY;
+    frame.bandH = (bandY + bandH <= NATIVE_H) ? bandH : NATIVE_H - bandY;
+    return frame;
+}
+
+static void drawQr(PackedFrame &frame)
+{
+    blitBitmap(frame, (AREA_W - QR_SIZE * QR_SCALE) / 2, (AREA_H - QR_SIZE * QR_SCALE) / 2, qrBits,
+               QR_SIZE, QR_SIZE, QR_SCALE);
+}
+
+// Every band runs the whole screen: layout (the pre-cache page loop) and every op
+static Result immediate(Screen screen, const char *text, int16_t bandH, uint8_t *out)
+{
+    static uint8_t band[FRAME_BYTES];
+    Result result = {0, 0};
+    for (int16_t bandY = 0; bandY < NATIVE_H; bandY += bandH)
+    {
+        auto t0 = std::chrono::steady_clock::now();
+        PackedFrame frame = bandFrame(band, bandY, bandH);
+        frameFill(frame, false);
+        if (screen == SCREEN_INFO)
+        {
+            InfoLayout layout;
+            computeInfoLayout(text, MAX_CHARS, FONTS, AREA_W, AREA_H, layout);
+            for (uint8_t i = 0; i < layout.lineCount; i++)
+            {
+                const InfoLine &line = layout.lines[i];
+                blitText(frame, infoFont(FONTS, line.fontIndex), line.x, line.baselineY,
+                         text + line.start, line.length);
+                result.ops++;
+            }
+        }
+        else
+        {
+            drawQr(frame);
+            result.ops++;
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        result.us += std::chrono::duration<double, std::micro>(t1 - t0).count();
+        memcpy(out + bandY * NATIVE_STRIDE, band, (size_t)frame.bandH * NATIVE_STRIDE);
+    }
+    return result;
+}
+
+// Recorded once (layout lookup included), replayed per band
+static Result replayed(Screen screen, const char *text, int16_t bandH, uint8_t *out, double &recordUs,
+                       uint8_t &listSize)
+{
+    static uint8_t band[FRAME_BYTES];
+    static DisplayList list;
+    auto t0 = std::chrono::steady_clock::now();
+    list.clear();
+    if (screen == SCREEN_INFO)
+    {
+        InfoLayout layout;
+        computeInfoLayout(text, MAX_CHARS, FONTS, AREA_W, AREA_H, layout);
+        for (uint8_t i = 0; i < layout.lineCount; i++)
+        {
+            const InfoLine &line = layout.lines[i];
+            list.addGlyphs(infoFont(FONTS, line.fontIndex), line.x, line.baselineY, text + line.start, line.length);
+        }
+    }
+    else
+        list.addBitmap((AREA_W - QR_SIZE * QR_SCALE) / 2, (AREA_H - QR_SIZE * QR_SCALE) / 2, qrBits,
+                       QR_SIZE, QR_SIZE, QR_SCALE);
+    recordUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+    listSize = list.size();
+
+    Result result = {0, 0};
+    for (int16_t bandY = 0; bandY < NATIVE_H; bandY += bandH)
+    {
+        auto t1 = std::chrono::steady_clock::now();
+        PackedFrame frame = bandFrame(band, bandY, bandH);
+        frameFill(frame, false);
+        result.ops += list.replay(frame);
+        auto t2 = std::chrono::steady_clock::now();
+        result.us += std::chrono::duration<double, std::micro>(t2 - t1).count();
+        memcpy(out + bandY * NATIVE_STRIDE, band, (size_t)frame.bandH * NATIVE_STRIDE);
+    }
+    return result;
+}
+
+// frameFillRect() / blitBitmap() against framePixel() per pixel, all rotations and bands
+static unsigned checkPrimitives(unsigned &cases)
+{
+    static uint8_t expected[FRAME_BYTES], actual[FRAME_BYTES];
+    const int16_t rects[][4] = {{0, 0, 250, 250}, {3, 5, 17, 9}, {-4, -6, 20, 30}, {100, 40, 200, 200},
+                                {9, 0, 1, 122}, {0, 61, 250, 1}, {30, 30, 0, 5}};
+    const int16_t BANDS[] = {NATIVE_H, 64, 50};
+    unsigned failures = 0;
+    for (uint8_t rotation = 0; rotation < 4; rotation++)
+        for (int16_t bandH : BANDS)
+            for (int16_t bandY = 0; bandY < NATIVE_H; bandY += bandH)
+            {
+                int16_t rows = (bandY + bandH <= NATIVE_H) ? bandH : NATIVE_H - bandY;
+                for (unsigned r = 0; r <= sizeof(rects) / sizeof(rects[0]); r++)
+                {
+                    PackedFrame ref = packedFrame(expected, NATIVE_STRIDE, NATIVE_W, NATIVE_H, rotation);
+                    PackedFrame got = packedFrame(actual, NATIVE_STRIDE, NATIVE_W, NATIVE_H, rotation);
+                    ref.bandY = got.bandY = bandY;
+                    ref.bandH = got.bandH = rows;
+                    frameFill(ref, false);
+                    frameFill(got, false);
+                    if (r < sizeof(rects) / sizeof(rects[0]))
+                    {
+                        const int16_t *rect = rects[r];
+                        for (int16_t y = rect[1]; y < rect[1] + rect[3]; y++)
+                            for (int16_t x = rect[0]; x < rect[0] + rect[2]; x++)
+                                framePixel(ref, x, y, true);
+                        frameFillRect(got, rect[0], rect[1], rect[2], rect[3], true);
+                    }
+                    else
+                    {
+                        // QR bitmap partly off the frame, then cleared again in white
+                        int16_t x0 = -7, y0 = 40;
+                        for (uint16_t y = 0; y < QR_SIZE; y++)
+                            for (uint16_t x = 0; x < QR_SIZE; x++)
+                            {
+                                uint32_t bit = (uint32_t)y * QR_SIZE + x;
+                                if (qrBits[bit >> 3] & (0x80 >> (bit & 7)))
+                                    for (uint8_t k = 0; k < 3 * 3; k++)
+                                        framePixel(ref, x0 + x * 3 + k % 3, y0 + y * 3 + k / 3, true);
+                            }
+                        blitBitmap(got, x0, y0, qrBits, QR_SIZE, QR_SIZE, 3);
+                        frameFillRect(ref, 50, 50, 20, 20, false);
+                        frameFillRect(got, 50, 50, 20, 20, false);
+                    }
+                    cases++;
+                    if (memcmp(expected, actual, (size_t)NATIVE_STRIDE * rows) != 0)
+                    {
+                        failures++;
+                        if (failures <= 10)
+                            printf("MISMATCH rotation %u shape %u band %d+%d\n", rotation, r, bandY, rows);
+                    }
+                }
+            }
+    return failures;
+}
+
+int main()
+{
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < sizeof(qrBits); i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        qrBits[i] = (uint8_t)(seed >> 16);
+    }
+
+    unsigned cases = 0;
+    unsigned failures = checkPrimitives(cases);
+    printf("primitives: %u cases, %u mismatches\n\n", cases, failures);
+
+    struct Sample
+    {
+        const char *name;
+        Screen screen;
+        const char *text;
+    } samples[] = {
+        {"info", SCREEN_INFO, "Jane Doe\nFirmware Engineer\njane.doe@example.com\n+1 555 0100"},
+        {"info long", SCREEN_INFO,
+         "Maximilian Alexander Featherstonehaugh\nPrincipal Embedded Systems Architect\n"
+         "maximilian.featherstonehaugh@subsidiary.example-corporation.com"},
+        {"qr", SCREEN_QR, ""},
+    };
+    const int16_t BAND_ROWS[] = {250, 125, 64, 32}; // Full frame, then paged buffers
+    static uint8_t immediateFrame[FRAME_BYTES], listFrame[FRAME_BYTES];
+    const int RUNS = 50;
+
+    printf("%-10s %5s %6s | %-22s | %-32s\n", "screen", "rows", "bands", "immediate ops  us/band",
+           "display list  ops  rec us  us/band");
+    for (const Sample &sample : samples)
+        for (int16_t rows : BAND_ROWS)
+        {
+            unsigned bands = (NATIVE_H + rows - 1) / rows;
+            Result a = {0, 0}, b = {0, 0};
+            double recordUs = 0;
+            uint8_t listSize = 0;
+            for (int run = 0; run < RUNS; run++)
+            {
+                double rec;
+                Result ra = immediate(sample.screen, sample.text, rows, immediateFrame);
+                Result rb = replayed(sample.screen, sample.text, rows, listFrame, rec, listSize);
+                a.ops = ra.ops, b.ops = rb.ops;
+                a.us += ra.us, b.us += rb.us;
+                recordUs += rec;
+            }
+            bool same = memcmp(immediateFrame, listFrame, FRAME_BYTES) == 0;
+            if (!same)
+                failures++;
+            printf("%-10s %5d %6u | %13u %8.1f | %2u recorded %4u %7.1f %8.1f%s\n", sample.name, rows, bands,
+                   a.ops, a.us / RUNS / bands, listSize, b.ops, recordUs / RUNS, b.us / RUNS / bands,
+                   same ? "" : "  FRAME MISMATCH");
+        }
+    return failures == 0 ? 0 : 1;
+}
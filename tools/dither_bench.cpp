@@ -0,0 +1,188 @@
+/**
+ * @file dither_bench.cpp
+ * @brief Host benchmark: gray uploads through ImageStream and GrayDither as
+ *        the badge runs them (chunks of IMAGE_CHUNK_MAX bytes, one band of
+ *        the display's page height), for source sizes below, at and above
+ *        the native 122x250 and both dither methods. Reports output rows per
+ *        second, the state the pipeline keeps (no heap: GrayDither,
+ *        ImageStream and the band are everything) against holding the gray
+ *        frame, and how well the tone survives: white pixel share against the
+ *        source's mean gray, over the whole frame and over 8x8 blocks. The
+ *        source is a horizontal ramp with a soft disc, so both smooth
+ *        gradients and edges are in it. With a directory argument, each
+ *        result is written there as a PBM in the badge's orientation.
+ *        Build and run:
+ *
+ *          g++ -std=c++11 -O2 -Isrc tools/dither_bench.cpp src/image_stream.cpp src/image_dither.cpp src/lz_stream.cpp \
+ *              -o dither_bench && ./dither_bench [pbm_dir]
+ */
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include "image_stream.h"
+
+static const uint16_t NATIVE_W = 122; // Visible pixels of a native row
+static const uint16_t NATIVE_H = 250;
+static const uint16_t NATIVE_STRIDE = 16;
+static const size_t FRAME_BYTES = NATIVE_STRIDE * NATIVE_H;
+static const uint16_t BAND_ROWS = 250; // DISPLAY_FULL_FRAME; the pipeline works the same with smaller bands
+static const int RUNS = 50;
+
+struct FrameSink : ImageSink
+{
+    uint8_t frame[FRAME_BYTES];
+    bool writeRows(uint16_t y, const uint8_t *rows, uint16_t count) override
+    {
+        memcpy(frame + (size_t)y * NATIVE_STRIDE, rows, (size_t)count * NATIVE_STRIDE);
+        return true;
+    }
+};
+
+// Source pixel in native orientation: ramp along the row, disc in the middle
+static uint8_t sourcePixel(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+    double u = (x + 0.5) / width, v = (y + 0.5) / height;
+    double value = u * 255.0;
+    double dx = (u - 0.5) * width / height, dy = v - 0.5;
+    double r = sqrt(dx * dx + dy * dy);
+    if (r < 0.2)
+        value = 255.0 - value * (1.0 - r / 0.2); // Inverted ramp, fading out at the rim
+    return (uint8_t)(value < 0 ? 0 : value > 255 ? 255 : value);
+}
+
+static bool white(const uint8_t *frame, uint16_t x, uint16_t y)
+{
+    return frame[y * NATIVE_STRIDE + x / 8] & (0x80 >> (x % 8));
+}
+
+static void writePbm(const char *dir, const char *name, const uint8_t *frame)
+{
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s.pbm", dir, name);
+    FILE *f = fopen(path, "wb");
+    if (f == nullptr)
+        return;
+    // Badge orientation (rotation 1): logical (x, y) is native (NATIVE_W - 1 - y, x)
+    fprintf(f, "P4\n%d %d\n", NATIVE_H, NATIVE_W);
+    for (uint16_t y = 0; y < NATIVE_W; y++)
+    {
+        uint8_t row[(NATIVE_H + 7) / 8] = {0};
+        for (uint16_t x = 0; x < NATIVE_H; x++)
+            if (!white(frame, NATIVE_W - 1 - y, x))
+                row[x / 8] |= 0x80 >> (x % 8);
+        fwrite(row, 1, sizeof(row), f);
+    }
+    fclose(f);
+}
+
+int main(int argc, char **argv)
+{
+    const char *pbmDir = argc > 1 ? argv[1] : nullptr;
+    const uint16_t sizes[][2] = {{61, 125}, {122, 250}, {244, 500}, {480, 640}};
+    const DitherMethod methods[] = {DITHER_FLOYD_STEINBERG, DITHER_ORDERED};
+    const char *methodNames[] = {"floyd-steinberg", "ordered"};
+    static uint8_t band[NATIVE_STRIDE * BAND_ROWS];
+    static uint8_t chunk[IMAGE_CHUNK_MAX];
+    static uint8_t source[480 * 640];
+    static FrameSink sink;
+    ImageStream stream;
+    GrayDither dither;
+    int failures = 0;
+
+    size_t state = sizeof(GrayDither) + sizeof(ImageStream) + sizeof(band);
+    printf("Pipeline state: GrayDither %u + ImageStream %u + band %u (%u rows) = %u bytes; gray frame would be %u\n\n",
+           (unsigned)sizeof(GrayDither), (unsigned)sizeof(ImageStream), (unsigned)sizeof(band), BAND_ROWS,
+           (unsigned)state, (unsigned)(NATIVE_W * NATIVE_H));
+    printf("%-9s %-16s %10s %12s %10s %10s %10s\n", "source", "method", "us/frame", "rows/s", "mean gray",
+           "white", "block err");
+
+    for (const uint16_t *size : sizes)
+    {
+        uint16_t width = size[0], height = size[1];
+        uint32_t bytes = (uint32_t)width * height;
+        for (uint32_t i = 0; i < bytes; i++)
+            source[i] = sourcePixel(i % width, i / width, width, height);
+        uint32_t crc = imageCrc32(source, bytes);
+
+        // Mean gray of the source as the badge samples it (per output pixel)
+        static double sampled[NATIVE_H][NATIVE_W];
+        double meanGray = 0;
+        for (uint16_t y = 0; y < NATIVE_H; y++)
+            for (uint16_t x = 0; x < NATIVE_W; x++)
+            {
+                uint16_t sx = (uint16_t)(((2 * x + 1) * (uint32_t)width) / (2 * NATIVE_W));
+                uint16_t sy = (uint16_t)(((2 * y + 1) * (uint32_t)height) / (2 * NATIVE_H));
+                sampled[y][x] = source[(uint32_t)sy * width + sx] / 255.0;
+                meanGray += sampled[y][x];
+            }
+        meanGray /= NATIVE_W * NATIVE_H;
+
+        for (unsigned m = 0; m < 2; m++)
+        {
+            bool ok = true;
+            auto start = std::chrono::steady_clock::now();
+            for (int run = 0; run < RUNS && ok; run++)
+            {
+                dither.begin(methods[m], width, height, NATIVE_W, NATIVE_H);
+                stream.begin(IMAGE_RAW, NATIVE_STRIDE, NATIVE_H, band, BAND_ROWS, &sink, &dither);
+                for (uint32_t offset = 0; offset < bytes && ok; offset += IMAGE_CHUNK_MAX)
+                {
+                    uint16_t length = bytes - offset < IMAGE_CHUNK_MAX ? bytes - offset : IMAGE_CHUNK_MAX;
+                    memcpy(chunk, source + offset, length); // As the BLE callback copies it into the queue
+                    ok = stream.feed(offset, chunk, length);
+                }
+                ok = ok && stream.finish(crc);
+            }
+            double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / RUNS;
+            if (!ok)
+            {
+                printf("%3ux%-5u %-16s FAILED: %s\n", width, height, methodNames[m], stream.error());
+                failures++;
+                continue;
+            }
+
+            // Tone: white share overall, and the worst 8x8 block against its mean gray
+            uint32_t whites = 0;
+            double blockError = 0;
+            for (uint16_t by = 0; by + 8 <= NATIVE_H; by += 8)
+                for (uint16_t bx = 0; bx + 8 <= NATIVE_W; bx += 8)
+                {
+                    double gray = 0, share = 0;
+                    for (uint16_t y = by; y < by + 8; y++)
+                        for (uint16_t x = bx; x < bx + 8; x++)
+                        {
+                            gray += sampled[y][x];
+                            share += white(sink.frame, x, y);
+                        }
+                    double error = fabs(gray - share) / 64;
+                    if (error > blockError)
+                        blockError = error;
+                }
+            bool paddingWhite = true;
+            for (uint16_t y = 0; y < NATIVE_H; y++)
+                for (uint16_t x = 0; x < NATIVE_STRIDE * 8; x++)
+                {
+                    if (x >= NATIVE_W)
+                        paddingWhite = paddingWhite && white(sink.frame, x, y);
+                    else
+                        whites += white(sink.frame, x, y);
+                }
+            double whiteShare = (double)whites / (NATIVE_W * NATIVE_H);
+            bool toneOk = fabs(whiteShare - meanGray) < 0.02 && paddingWhite;
+            if (!toneOk)
+                failures++;
+            printf("%3ux%-5u %-16s %10.1f %12.0f %10.3f %10.3f %10.3f%s\n", width, height, methodNames[m], us,
+                   NATIVE_H * 1e6 / us, meanGray, whiteShare, blockError, toneOk ? "" : "  TONE OFF");
+            if (pbmDir != nullptr)
+            {
+                char name[64];
+                snprintf(name, sizeof(name), "dither_%ux%u_%s", width, height, methodNames[m]);
+                writePbm(pbmDir, name, sink.frame);
+            }
+        }
+    }
+    printf("\n%d failure(s)\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,185 @@
+/**
+ * @file flash_font_check.cpp
+ * @brief Host check of the Unicode font cache (flash_font.cpp) with the info
+ *        layout on top of it: a font file built in memory (12 px capitals and
+ *        ascenders, 3 px descenders), UTF-8 transcoded to slot codes, line
+ *        metrics that hold for texts without 'A' or 'j' and after the glyphs
+ *        are reloaded for new content, and one glyph pool shared by several
+ *        sizes (glyphs without room are dropped and counted). Build and run:
+ *
+ *          g++ -std=c++11 -Itools/host -Isrc tools/flash_font_check.cpp src/flash_font.cpp \
+ *              src/text_layout.cpp -o flash_font_check && ./flash_font_check
+ */
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "flash_font.h"
+#include "text_layout.h"
+
+static int failures = 0;
+
+static void check(const char *name, bool ok)
+{
+    printf("%-58s %s\n", name, ok ? "ok" : "FAIL");
+    if (!ok)
+        failures++;
+}
+
+// NTF1 file in memory: printable ASCII plus U+00E9, solid boxes
+struct MemoryFont : FontSource
+{
+    std::vector<uint8_t> bytes;
+    bool readAt(uint32_t offset, void *dst, uint16_t length) override
+    {
+        if (offset + length > bytes.size())
+            return false;
+        memcpy(dst, bytes.data() + offset, length);
+        return true;
+    }
+};
+
+static void putU32(std::vector<uint8_t> &out, uint32_t value)
+{
+    for (int i = 0; i < 4; i++)
+        out.push_back((value >> (8 * i)) & 0xFF);
+}
+
+// Capitals, ascenders and U+00E9 are `tall` pixels high, descenders go 3 below
+static MemoryFont buildFont(uint8_t width, uint8_t tall, uint8_t yAdvance)
+{
+    std::vector<uint32_t> codepoints;
+    for (uint32_t cp = 0x20; cp < 0x7F; cp++)
+        codepoints.push_back(cp);
+    codepoints.push_back(0xE9);
+    uint8_t small = tall * 3 / 4;
+
+    MemoryFont font;
+    std::vector<uint8_t> &out = font.bytes;
+    const char magic[] = "NTF1";
+    out.insert(out.end(), magic, magic + 4);
+    out.push_back(FLASH_FONT_VERSION);
+    out.push_back(yAdvance);
+    out.push_back(0);
+    out.push_back(0);
+    putU32(out, codepoints.size());
+    putU32(out, 20);
+    putU32(out, 20 + 16 * codepoints.size());
+
+    std::vector<uint8_t> bitmaps;
+    for (uint32_t cp : codepoints)
+    {
+        bool space = cp == ' ';
+        bool high = (cp >= 'A' && cp <= 'Z') || strchr("bdfhklt", (int)cp) || cp == 0xE9;
+        bool descends = strchr("gjpqy", (int)cp) != nullptr;
+        uint8_t w = space ? 0 : width;
+        uint8_t h = space ? 0 : (high ? tall : small) + (descends ? 3 : 0);
+        int8_t yOffset = space ? 0 : -(int8_t)(high ? tall : small);
+        putU32(out, cp);
+        putU32(out, bitmaps.size());
+        out.push_back(w);
+        out.push_back(h);
+        out.push_back(width + 1);
+        out.push_back(0);
+        out.push_back((uint8_t)yOffset);
+        out.push_back(0);
+        out.push_back(0);
+        out.push_back(0);
+        bitmaps.insert(bitmaps.end(), (w * h + 7) / 8, 0xFF);
+    }
+    out.insert(out.end(), bitmaps.begin(), bitmaps.end());
+    return font;
+}
+
+static InfoFontSet fontSet(const FlashFont &font)
+{
+    InfoFontSet set;
+    for (uint8_t i = 0; i < INFO_FONT_SIZES; i++)
+        set.regular[i] = set.emphasis[i] = font.font();
+    return set;
+}
+
+// Loads `utf8` into the font and lays it out like prepareInfoText() / ensureInfoLayout()
+static void layoutText(FlashFont &font, FlashGlyphPool &pool, const char *utf8, InfoLayout &layout)
+{
+    static char text[INFO_LAYOUT_MAX_CHARS + 1];
+    SlotMap map;
+    uint16_t length = transcodeUtf8(utf8, strlen(utf8), text, sizeof(text), map);
+    pool.used = 0;
+    font.load(text, length, map);
+    resetFontMetrics();
+    computeInfoLayout(text, INFO_LAYOUT_MAX_CHARS, fontSet(font), 250, 122, layout);
+}
+
+// Each line starts below the previous one's descent: ascent 12 + descent 3
+static bool linesApart(const InfoLayout &layout)
+{
+    for (uint8_t i = 1; i < layout.lineCount; i++)
+        if (layout.lines[i].baselineY - layout.lines[i - 1].baselineY < 12 + 3 + INFO_WRAP_SPACING)
+            return false;
+    return layout.lineCount > 1;
+}
+
+static void metricsChecks()
+{
+    static FlashGlyphPool pool;
+    MemoryFont file = buildFont(6, 12, 16);
+    FlashFont font;
+    check("font: header read", font.begin(&file, &pool) && font.glyphCount() == 96);
+
+    InfoLayout layout;
+    layoutText(font, pool, "Ren\xC3\xA9\nBoo", layout);
+    check("metrics: text without 'A' or 'j', lines apart", layout.lineCount == 2 && linesApart(layout));
+    check("metrics: probe glyphs cached with the text", font.cachedGlyphs() == 8 && font.missingGlyphs() == 0);
+
+    layoutText(font, pool, "Ann\nJay\nEve", layout);
+    int16_t gap = layout.lines[1].baselineY - layout.lines[0].baselineY;
+    layoutText(font, pool, "Ren\xC3\xA9\nBoo\nLee", layout);
+    check("metrics: same line pitch after a reload",
+          linesApart(layout) && layout.lines[1].baselineY - layout.lines[0].baselineY == gap);
+
+    static FlashGlyphPool otherPool;
+    MemoryFont tallFile = buildFont(6, 20, 26);
+    font.begin(&tallFile, &otherPool); // Same GFXfont pointer, other glyphs
+    layoutText(font, otherPool, "Ren\xC3\xA9\nBoo", layout);
+    check("metrics: new font in the same object measured again",
+          layout.lineCount == 2 && layout.lines[1].baselineY - layout.lines[0].baselineY >= 20 + 3);
+}
+
+static void poolChecks()
+{
+    static FlashGlyphPool pool;
+    MemoryFont smallFile = buildFont(6, 12, 16), largeFile = buildFont(40, 60, 70);
+    FlashFont small, large;
+    small.begin(&smallFile, &pool);
+    large.begin(&largeFile, &pool);
+    static char text[64];
+    SlotMap map;
+    uint16_t length = transcodeUtf8("Ren\xC3\xA9", 5, text, sizeof(text), map);
+    pool.used = 0;
+    small.load(text, length, map);
+    large.load(text, length, map);
+    check("pool: both sizes share it", small.poolUsed() + large.poolUsed() == pool.used &&
+                                           large.font()->bitmap == small.font()->bitmap);
+    check("pool: glyphs after the first font's", large.font()->glyph['R' - 0x20].bitmapOffset >= small.poolUsed());
+
+    FlashFont huge[4];
+    MemoryFont hugeFile = buildFont(120, 120, 130); // 1800 bytes a glyph
+    for (FlashFont &font : huge)
+    {
+        font.begin(&hugeFile, &pool);
+        font.load(text, length, map);
+    }
+    check("pool: full pool drops glyphs and counts them",
+          huge[3].droppedGlyphs() > 0 && huge[3].missingGlyphs() == 0 && pool.used <= FLASH_FONT_POOL_SIZE);
+    check("pool: dropped glyph is a blank one space wide",
+          huge[3].font()->glyph['R' - 0x20].width == 0 && huge[3].font()->glyph['R' - 0x20].xAdvance == 130 / 4);
+}
+
+int main()
+{
+    metricsChecks();
+    poolChecks();
+    printf("\n%d failure(s)\n", failures);
+    return failures == 0 ? 0 : 1;
+}
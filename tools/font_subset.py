@@ -0,0 +1,433 @@
+#!/usr/bin/env python3
+"""Font subset compiler.
+
+Converts a TTF/OTF (rendered with FreeType, like Adafruit's fontconvert) or
+a BDF bitmap font into glyph tables holding only the configured code ranges:
+
+  ntf  Unicode font file for LittleFS, read by src/flash_font.cpp. Glyphs
+       are RLE compressed when that is smaller (--rle).
+  gfx  Adafruit GFX header (GFXfont), a drop-in for <Fonts/...pt7b.h>.
+
+Prints the flash used against the same font with every glyph it has.
+
+  python3 tools/font_subset.py NotoSans-Regular.ttf --size 12 \\
+      --ranges 0x20-0x7E,0xA0-0x17F --format ntf --rle -o data/fonts/unicode12.ntf
+
+Only the standard library is needed; TTF input loads libfreetype through
+ctypes (present on any Linux desktop, "apt install libfreetype6" otherwise).
+Also used as a library by tools/font_subset_pre.py.
+"""
+
+import argparse
+import ctypes
+import ctypes.util
+import os
+import struct
+import sys
+
+DPI = 141  # Same as Adafruit fontconvert, so "12 pt" matches FreeSans12pt7b
+NTF_VERSION = 1
+NTF_HEADER_SIZE = 20
+NTF_ENTRY_SIZE = 16
+NTF_FLAG_RLE = 0x01
+GLYPH_RLE = 0x01
+MAX_RUN_BYTES = 512  # FLASH_FONT_MAX_RUN_BYTES
+GFX_GLYPH_SIZE = 7  # sizeof(GFXglyph) in flash
+GFX_FONT_SIZE = 16  # sizeof(GFXfont) on ESP32 (two pointers, two u16, u8, padding)
+
+
+class Glyph:
+    def __init__(self, codepoint, width, height, x_advance, x_offset, y_offset, rows):
+        self.codepoint = codepoint
+        self.width = width
+        self.height = height
+        self.x_advance = x_advance
+        self.x_offset = x_offset
+        self.y_offset = y_offset
+        self.rows = rows  # height lists of width 0/1 values
+
+    def bits(self):
+        return [bit for row in self.rows for bit in row]
+
+    def packed(self):
+        """Adafruit GFX packing: row-major, MSB first, no row padding."""
+        out = bytearray((self.width * self.height + 7) // 8)
+        for i, bit in enumerate(self.bits()):
+            if bit:
+                out[i >> 3] |= 0x80 >> (i & 7)
+        return bytes(out)
+
+    def runs(self):
+        """RLE over the bit stream: bit 7 = value, bits 0-6 = length - 1."""
+        out = bytearray()
+        bits = self.bits()
+        i = 0
+        while i < len(bits):
+            value = bits[i]
+            run = 1
+            while i + run < len(bits) and bits[i + run] == value and run < 128:
+                run += 1
+            out.append((value << 7) | (run - 1))
+            i += run
+        return bytes(out)
+
+
+# ---------------------------------------------------------------------------
+# Input: BDF
+# ---------------------------------------------------------------------------
+def load_bdf(path):
+    """Returns ({codepoint: Glyph}, yAdvance)."""
+    glyphs = {}
+    ascent = descent = 0
+    bbox_height = 0
+    with open(path, "r", encoding="latin-1") as f:
+        lines = iter(f.read().splitlines())
+    for line in lines:
+        parts = line.split()
+        if not parts:
+            continue
+        key = parts[0]
+        if key == "FONTBOUNDINGBOX":
+            bbox_height = int(parts[2])
+        elif key == "FONT_ASCENT":
+            ascent = int(parts[1])
+        elif key == "FONT_DESCENT":
+            descent = int(parts[1])
+        elif key == "STARTCHAR":
+            codepoint = -1
+            dwidth = 0
+            bbx = (0, 0, 0, 0)
+            rows = []
+            for line in lines:
+                parts = line.split()
+                if not parts:
+                    continue
+                if parts[0] == "ENCODING":
+                    codepoint = int(parts[1])
+                elif parts[0] == "DWIDTH":
+                    dwidth = int(parts[1])
+                elif parts[0] == "BBX":
+                    bbx = tuple(int(v) for v in parts[1:5])
+                elif parts[0] == "BITMAP":
+                    for _ in range(bbx[1]):
+                        value = next(lines).strip()
+                        bits = bin(int(value, 16))[2:].zfill(len(value) * 4)
+                        rows.append([int(b) for b in bits[: bbx[0]]])
+                elif parts[0] == "ENDCHAR":
+                    break
+            if codepoint >= 0:
+                w, h, xoff, yoff = bbx
+                # BDF offsets are from the baseline up to the box bottom; GFX wants the top
+                glyphs[codepoint] = Glyph(codepoint, w, h, dwidth, xoff, -(yoff + h), rows)
+    y_advance = (ascent + descent) or bbox_height
+    return glyphs, y_advance
+
+
+# ---------------------------------------------------------------------------
+# Input: TTF/OTF through libfreetype (ctypes, FreeType 2.x public structs)
+# ---------------------------------------------------------------------------
+FT_Pos = ctypes.c_long
+FT_Fixed = ctypes.c_long
+
+
+class FT_Generic(ctypes.Structure):
+    _fields_ = [("data", ctypes.c_void_p), ("finalizer", ctypes.c_void_p)]
+
+
+class FT_Vector(ctypes.Structure):
+    _fields_ = [("x", FT_Pos), ("y", FT_Pos)]
+
+
+class FT_BBox(ctypes.Structure):
+    _fields_ = [("xMin", FT_Pos), ("yMin", FT_Pos), ("xMax", FT_Pos), ("yMax", FT_Pos)]
+
+
+class FT_Bitmap(ctypes.Structure):
+    _fields_ = [
+        ("rows", ctypes.c_uint),
+        ("width", ctypes.c_uint),
+        ("pitch", ctypes.c_int),
+        ("buffer", ctypes.POINTER(ctypes.c_ubyte)),
+        ("num_grays", ctypes.c_ushort),
+        ("pixel_mode", ctypes.c_ubyte),
+        ("palette_mode", ctypes.c_ubyte),
+        ("palette", ctypes.c_void_p),
+    ]
+
+
+class FT_Glyph_Metrics(ctypes.Structure):
+    _fields_ = [(name, FT_Pos) for name in ("width", "height", "horiBearingX", "horiBearingY", "horiAdvance",
+                                              "vertBearingX", "vertBearingY", "vertAdvance")]
+
+
+class FT_GlyphSlotRec(ctypes.Structure):
+    _fields_ = [
+        ("library", ctypes.c_void_p),
+        ("face", ctypes.c_void_p),
+        ("next", ctypes.c_void_p),
+        ("glyph_index", ctypes.c_uint),
+        ("generic", FT_Generic),
+        ("metrics", FT_Glyph_Metrics),
+        ("linearHoriAdvance", FT_Fixed),
+        ("linearVertAdvance", FT_Fixed),
+        ("advance", FT_Vector),
+        ("format", ctypes.c_int),
+        ("bitmap", FT_Bitmap),
+        ("bitmap_left", ctypes.c_int),
+        ("bitmap_top", ctypes.c_int),
+    ]
+
+
+class FT_Size_Metrics(ctypes.Structure):
+    _fields_ = [
+        ("x_ppem", ctypes.c_ushort),
+        ("y_ppem", ctypes.c_ushort),
+        ("x_scale", FT_Fixed),
+        ("y_scale", FT_Fixed),
+        ("ascender", FT_Pos),
+        ("descender", FT_Pos),
+        ("height", FT_Pos),
+        ("max_advance", FT_Pos),
+    ]
+
+
+class FT_SizeRec(ctypes.Structure):
+    _fields_ = [("face", ctypes.c_void_p), ("generic", FT_Generic), ("metrics", FT_Size_Metrics)]
+
+
+class FT_FaceRec(ctypes.Structure):
+    _fields_ = [
+        ("num_faces", ctypes.c_long),
+        ("face_index", ctypes.c_long),
+        ("face_flags", ctypes.c_long),
+        ("style_flags", ctypes.c_long),
+        ("num_glyphs", ctypes.c_long),
+        ("family_name", ctypes.c_char_p),
+        ("style_name", ctypes.c_char_p),
+        ("num_fixed_sizes", ctypes.c_int),
+        ("available_sizes", ctypes.c_void_p),
+        ("num_charmaps", ctypes.c_int),
+        ("charmaps", ctypes.c_void_p),
+        ("generic", FT_Generic),
+        ("bbox", FT_BBox),
+        ("units_per_EM", ctypes.c_ushort),
+        ("ascender", ctypes.c_short),
+        ("descender", ctypes.c_short),
+        ("height", ctypes.c_short),
+        ("max_advance_width", ctypes.c_short),
+        ("max_advance_height", ctypes.c_short),
+        ("underline_position", ctypes.c_short),
+        ("underline_thickness", ctypes.c_short),
+        ("glyph", ctypes.POINTER(FT_GlyphSlotRec)),
+        ("size", ctypes.POINTER(FT_SizeRec)),
+        ("charmap", ctypes.c_void_p),
+    ]
+
+
+FT_LOAD_RENDER = 1 << 2
+FT_LOAD_TARGET_MONO = 2 << 16
+
+
+class TrueTypeFont:
+    def __init__(self, path, size):
+        name = ctypes.util.find_library("freetype") or "libfreetype.so.6"
+        try:
+            self.ft = ctypes.CDLL(name)
+        except OSError:
+            raise SystemExit("font_subset: libfreetype not found (apt install libfreetype6), needed for " + path)
+        self.ft.FT_Get_Char_Index.restype = ctypes.c_uint
+        self.ft.FT_Get_First_Char.restype = ctypes.c_ulong
+        self.ft.FT_Get_Next_Char.restype = ctypes.c_ulong
+        self.library = ctypes.c_void_p()
+        self.face = ctypes.POINTER(FT_FaceRec)()
+        if self.ft.FT_Init_FreeType(ctypes.byref(self.library)) != 0:
+            raise SystemExit("font_subset: FT_Init_FreeType failed")
+        if self.ft.FT_New_Face(self.library, path.encode(), 0, ctypes.byref(self.face)) != 0:
+            raise SystemExit("font_subset: cannot open " + path)
+        self.ft.FT_Set_Char_Size(self.face, 0, size << 6, DPI, DPI)
+
+    def y_advance(self):
+        return self.face.contents.size.contents.metrics.height >> 6
+
+    def codepoints(self):
+        index = ctypes.c_uint()
+        cp = self.ft.FT_Get_First_Char(self.face, ctypes.byref(index))
+        while index.value != 0:
+            yield cp
+            cp = self.ft.FT_Get_Next_Char(self.face, ctypes.c_ulong(cp), ctypes.byref(index))
+
+    def glyph(self, codepoint):
+        if self.ft.FT_Get_Char_Index(self.face, ctypes.c_ulong(codepoint)) == 0:
+            return None
+        if self.ft.FT_Load_Char(self.face, ctypes.c_ulong(codepoint), FT_LOAD_RENDER | FT_LOAD_TARGET_MONO) != 0:
+            return None
+        slot = self.face.contents.glyph.contents
+        bitmap = slot.bitmap
+        rows = []
+        for y in range(bitmap.rows):
+            row = []
+            for x in range(bitmap.width):
+                byte = bitmap.buffer[y * bitmap.pitch + (x >> 3)]
+                row.append(1 if byte & (0x80 >> (x & 7)) else 0)
+            rows.append(row)
+        # Offsets as in fontconvert: yOffset = 1 - bitmap_top
+        return Glyph(codepoint, bitmap.width, bitmap.rows, slot.advance.x >> 6,
+                     slot.bitmap_left, 1 - slot.bitmap_top, rows)
+
+
+# ---------------------------------------------------------------------------
+# Subsetting
+# ---------------------------------------------------------------------------
+def parse_ranges(text):
+    codepoints = set()
+    for part in text.replace(" ", "").split(","):
+        if not part:
+            continue
+        if "-" in part:
+            lo, hi = part.split("-", 1)
+            codepoints.update(range(int(lo, 0), int(hi, 0) + 1))
+        else:
+            codepoints.add(int(part, 0))
+    return sorted(codepoints)
+
+
+def load_font(path, size, codepoints=None):
+    """Returns ({codepoint: Glyph}, yAdvance); all glyphs if codepoints is None."""
+    if path.lower().endswith(".bdf"):
+        glyphs, y_advance = load_bdf(path)
+        if codepoints is not None:
+            glyphs = {cp: g for cp, g in glyphs.items() if cp in set(codepoints)}
+        return glyphs, y_advance
+    font = TrueTypeFont(path, size)
+    wanted = font.codepoints() if codepoints is None else codepoints
+    glyphs = {}
+    for cp in wanted:
+        g = font.glyph(cp)
+        if g is not None:
+            glyphs[cp] = g
+    return glyphs, font.y_advance()
+
+
+def check_limits(glyphs):
+    for g in glyphs.values():
+        if g.width > 255 or g.height > 255 or not -128 <= g.x_offset < 128 or not -128 <= g.y_offset < 128:
+            raise SystemExit("font_subset: glyph U+%04X too large for the table format" % g.codepoint)
+
+
+def ntf_bytes(glyphs, y_advance, rle):
+    ordered = [glyphs[cp] for cp in sorted(glyphs)]
+    index = bytearray()
+    bitmaps = bytearray()
+    any_rle = False
+    for g in ordered:
+        data = g.packed()
+        flags = 0
+        if rle:
+            runs = g.runs()
+            if len(runs) < len(data) and len(runs) <= MAX_RUN_BYTES:
+                data, flags = runs, GLYPH_RLE
+                any_rle = True
+        index += struct.pack("<IIBBBbbBH", g.codepoint, len(bitmaps), g.width, g.height, g.x_advance,
+                             g.x_offset, g.y_offset, flags, len(data) if flags else 0)
+        bitmaps += data
+    header = struct.pack("<4sBBHIII", b"NTF1", NTF_VERSION, min(y_advance, 255),
+                         NTF_FLAG_RLE if any_rle else 0, len(ordered),
+                         NTF_HEADER_SIZE, NTF_HEADER_SIZE + len(index))
+    return header + bytes(index) + bytes(bitmaps)
+
+
+def gfx_size(glyphs):
+    """Flash taken by the glyphs as an Adafruit GFXfont (bitmaps + glyph table)."""
+    if not glyphs:
+        return GFX_FONT_SIZE
+    first, last = min(glyphs), max(glyphs)
+    bitmaps = sum(len(g.packed()) for g in glyphs.values())
+    return bitmaps + (last - first + 1) * GFX_GLYPH_SIZE + GFX_FONT_SIZE
+
+
+def gfx_header(glyphs, y_advance, name):
+    first, last = min(glyphs), max(glyphs)
+    bitmaps = bytearray()
+    entries = []
+    for cp in range(first, last + 1):
+        g = glyphs.get(cp)
+        if g is None:
+            entries.append("  {0, 0, 0, 0, 0, 0}, // 0x%02X (not in subset)" % cp)
+            continue
+        entries.append("  {%d, %d, %d, %d, %d, %d}, // 0x%02X" % (len(bitmaps), g.width, g.height, g.x_advance,
+                                                                  g.x_offset, g.y_offset, cp))
+        bitmaps += g.packed()
+    hex_rows = []
+    for i in range(0, len(bitmaps), 12):
+        hex_rows.append("  " + ", ".join("0x%02X" % b for b in bitmaps[i:i + 12]))
+    return (
+        "// Generated by tools/font_subset.py, do not edit\n"
+        "#pragma once\n\n"
+        "const uint8_t %sBitmaps[] PROGMEM = {\n%s};\n\n"
+        "const GFXglyph %sGlyphs[] PROGMEM = {\n%s};\n\n"
+        "const GFXfont %s PROGMEM = {(uint8_t *)%sBitmaps, (GFXglyph *)%sGlyphs, 0x%02X, 0x%02X, %d};\n"
+        % (name, ",\n".join(hex_rows), name, "\n".join(entries), name, name, name, first, last, y_advance)
+    )
+
+
+def build(source, size, ranges, fmt, output, rle=False, name=None, report_full=True):
+    """Builds one subset; returns a report dict."""
+    codepoints = parse_ranges(ranges)
+    glyphs, y_advance = load_font(source, size, codepoints)
+    if not glyphs:
+        raise SystemExit("font_subset: %s has none of the glyphs in %s" % (source, ranges))
+    check_limits(glyphs)
+
+    if fmt == "ntf":
+        data = ntf_bytes(glyphs, y_advance, rle)
+        out_size = len(data)
+        content = data
+    elif fmt == "gfx":
+        name = name or os.path.splitext(os.path.basename(output))[0]
+        content = gfx_header(glyphs, y_advance, name).encode()
+        out_size = gfx_size(glyphs)
+    else:
+        raise SystemExit("font_subset: unknown format " + fmt)
+
+    os.makedirs(os.path.dirname(os.path.abspath(output)), exist_ok=True)
+    with open(output, "wb") as f:
+        f.write(content)
+
+    report = {"output": output, "glyphs": len(glyphs), "missing": len(codepoints) - len(glyphs),
+              "bytes": out_size, "full_glyphs": None, "full_bytes": None}
+    if report_full:
+        full, _ = load_font(source, size)
+        report["full_glyphs"] = len(full)
+        report["full_bytes"] = gfx_size(full) if fmt == "gfx" else len(ntf_bytes(full, y_advance, False))
+    return report
+
+
+def format_report(report):
+    line = "%s: %d glyphs (%d not in font), %.1f KB" % (report["output"], report["glyphs"], report["missing"],
+                                                       report["bytes"] / 1024.0)
+    if report["full_bytes"]:
+        saved = report["full_bytes"] - report["bytes"]
+        line += ", full font %d glyphs %.1f KB, saved %.1f KB (%d%%)" % (
+            report["full_glyphs"], report["full_bytes"] / 1024.0, saved / 1024.0,
+            100 * saved // report["full_bytes"])
+    return line
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Subset a TTF/BDF font into glyph tables.")
+    parser.add_argument("source", help="TTF/OTF or BDF file")
+    parser.add_argument("--size", type=int, default=12, help="point size at %d dpi (TTF only)" % DPI)
+    parser.add_argument("--ranges", default="0x20-0x7E", help="code points, e.g. 0x20-0x7E,0xA0-0x17F")
+    parser.add_argument("--format", choices=("ntf", "gfx"), default="ntf")
+    parser.add_argument("--rle", action="store_true", help="RLE compress glyphs where smaller (ntf)")
+    parser.add_argument("--name", help="GFXfont symbol name (gfx)")
+    parser.add_argument("--no-full-report", action="store_true", help="skip measuring the whole font")
+    parser.add_argument("-o", "--output", required=True)
+    args = parser.parse_args()
+    report = build(args.source, args.size, args.ranges, args.format, args.output, args.rle, args.name,
+                   not args.no_full_report)
+    print("font_subset: " + format_report(report))
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,38 @@
+"""PlatformIO pre-script: builds the font subsets listed in the JSON file named
+by custom_font_config (default fonts.json, see fonts.example.json) before each
+build, and prints the flash used / saved per font. A job is skipped while its
+output is newer than its source and the config. No config file, no work.
+"""
+Import("env")  # noqa: F821 (provided by PlatformIO)
+
+import json
+import os
+import sys
+
+project_dir = env.subst("$PROJECT_DIR")  # noqa: F821
+sys.path.insert(0, os.path.join(project_dir, "tools"))
+import font_subset  # noqa: E402
+
+config_name = env.GetProjectOption("custom_font_config", "fonts.json")  # noqa: F821
+config_path = os.path.join(project_dir, config_name)
+
+
+def newer(path, than):
+    return os.path.exists(path) and all(os.path.getmtime(path) >= os.path.getmtime(t) for t in than)
+
+
+if os.path.isfile(config_path):
+    with open(config_path) as f:
+        jobs = json.load(f).get("fonts", [])
+    for job in jobs:
+        source = os.path.join(project_dir, job["source"])
+        output = os.path.join(project_dir, job["output"])
+        if not os.path.isfile(source):
+            sys.stderr.write("font_subset: source %s not found, skipping %s\n" % (job["source"], job["output"]))
+            continue
+        if newer(output, [source, config_path]):
+            continue
+        report = font_subset.build(source, job.get("size", 12), job.get("ranges", "0x20-0x7E"),
+                                   job.get("format", "ntf"), output, job.get("rle", False), job.get("name"))
+        report["output"] = job["output"]
+        print("font_subset: " + font_subset.format_report(report))
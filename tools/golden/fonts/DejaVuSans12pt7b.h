@@ -0,0 +1,289 @@
+// DejaVuSans.ttf at 12pt, converted with Adafruit GFX fontconvert (7-bit, 141 dpi).
+// Fixed font for tools/golden_check.cpp; DejaVu fonts license in LICENSE.
+#pragma once
+#include <Adafruit_GFX.h>
+
+const uint8_t DejaVuSans12pt7bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xC0,
+  0x03, 0x08, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0x02, 0x18, 0x7F, 0xFF,
+  0x7F, 0xFF, 0x06, 0x30, 0x04, 0x30, 0x0C, 0x20, 0x0C, 0x60, 0xFF, 0xFE,
+  0xFF, 0xFE, 0x18, 0x40, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x10, 0xC0,
+  0x04, 0x00, 0x80, 0x10, 0x0F, 0xC7, 0xFD, 0xC8, 0xB1, 0x06, 0x20, 0xE4,
+  0x0F, 0x80, 0xFE, 0x03, 0xE0, 0x4E, 0x08, 0xC1, 0x1C, 0x27, 0xFF, 0xC7,
+  0xE0, 0x10, 0x02, 0x00, 0x40, 0x08, 0x00, 0x3C, 0x03, 0x06, 0x60, 0x70,
+  0xC3, 0x06, 0x0C, 0x30, 0xC0, 0xC3, 0x1C, 0x0C, 0x31, 0x80, 0xC3, 0x38,
+  0x0C, 0x33, 0x00, 0x66, 0x63, 0xC3, 0xC6, 0x66, 0x00, 0xCC, 0x30, 0x1C,
+  0xC3, 0x01, 0x8C, 0x30, 0x38, 0xC3, 0x03, 0x0C, 0x30, 0x60, 0xC3, 0x0E,
+  0x06, 0x60, 0xC0, 0x3C, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0x20, 0x30, 0x00,
+  0x30, 0x00, 0x30, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x3E, 0x00, 0x77, 0x06,
+  0xE3, 0x86, 0xC1, 0xCC, 0xC0, 0xEC, 0xC0, 0x78, 0xE0, 0x38, 0x70, 0xFC,
+  0x3F, 0xCE, 0x0F, 0x87, 0xFF, 0xFC, 0x19, 0x8C, 0xC6, 0x33, 0x18, 0xC6,
+  0x31, 0x8C, 0x63, 0x0C, 0x63, 0x0C, 0x61, 0x80, 0xC3, 0x18, 0x63, 0x18,
+  0x63, 0x18, 0xC6, 0x31, 0x8C, 0x66, 0x31, 0x98, 0xCC, 0x00, 0x04, 0x00,
+  0x83, 0x11, 0xBA, 0xE1, 0xF0, 0x3E, 0x1D, 0x76, 0x23, 0x04, 0x00, 0x80,
+  0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+  0x01, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+  0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x6D, 0xBD, 0x80, 0xFF,
+  0xF0, 0xFC, 0x03, 0x07, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x0C, 0x1C, 0x18,
+  0x18, 0x38, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x0F, 0x03,
+  0xFC, 0x70, 0xE6, 0x06, 0x60, 0x6C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C,
+  0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x36, 0x06, 0x60, 0x67, 0x0E, 0x3F, 0xC0,
+  0xF0, 0x3C, 0x3F, 0x0C, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C,
+  0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0,
+  0x3F, 0x1F, 0xFB, 0x07, 0x00, 0x70, 0x06, 0x00, 0xC0, 0x18, 0x06, 0x01,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x07, 0x00, 0xFF, 0xFF,
+  0xFC, 0x3F, 0x07, 0xFC, 0x40, 0xC0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+  0x0C, 0x1F, 0x81, 0xFC, 0x00, 0xE0, 0x07, 0x00, 0x30, 0x03, 0x00, 0x78,
+  0x0E, 0xFF, 0xC3, 0xF8, 0x01, 0xC0, 0x1E, 0x00, 0xB0, 0x0D, 0x80, 0xCC,
+  0x06, 0x60, 0x63, 0x07, 0x18, 0x30, 0xC3, 0x06, 0x18, 0x31, 0x81, 0x8F,
+  0xFF, 0xFF, 0xFC, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x7F, 0xCF,
+  0xF9, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x1F, 0xC3, 0xFC, 0x41, 0xC0, 0x1C,
+  0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x3C, 0x0E, 0xFF, 0x8F, 0xC0, 0x07,
+  0xC1, 0xFE, 0x38, 0x27, 0x00, 0x60, 0x0C, 0x00, 0xCF, 0x8D, 0xFC, 0xF8,
+  0xEF, 0x07, 0xE0, 0x3E, 0x03, 0xE0, 0x36, 0x03, 0x70, 0x77, 0x8E, 0x3F,
+  0xC0, 0xF8, 0xFF, 0xFF, 0xFC, 0x03, 0x00, 0x60, 0x1C, 0x03, 0x00, 0x60,
+  0x18, 0x03, 0x00, 0xE0, 0x18, 0x03, 0x00, 0xC0, 0x18, 0x07, 0x00, 0xC0,
+  0x18, 0x06, 0x00, 0x1F, 0x87, 0xFE, 0x70, 0xEC, 0x03, 0xC0, 0x3C, 0x03,
+  0xC0, 0x37, 0x0E, 0x3F, 0xC3, 0xFC, 0x70, 0xEC, 0x03, 0xC0, 0x3C, 0x03,
+  0xC0, 0x37, 0x0E, 0x7F, 0xE1, 0xF8, 0x1F, 0x03, 0xFC, 0x71, 0xEE, 0x0E,
+  0xC0, 0x6C, 0x07, 0xC0, 0x7C, 0x07, 0xE0, 0xF7, 0x1F, 0x3F, 0xB1, 0xF3,
+  0x00, 0x30, 0x06, 0x00, 0xE4, 0x1C, 0x7F, 0x83, 0xE0, 0xFC, 0x00, 0x3F,
+  0x6D, 0x80, 0x00, 0x0D, 0xB7, 0xB0, 0x00, 0x02, 0x00, 0x3C, 0x03, 0xF0,
+  0x3F, 0x01, 0xF8, 0x1F, 0x80, 0x38, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x0F,
+  0xC0, 0x03, 0xF0, 0x00, 0xF0, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x01, 0xE0,
+  0x01, 0xF8, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0x80, 0x3F,
+  0x03, 0xF0, 0x1F, 0x81, 0xF8, 0x07, 0x80, 0x08, 0x00, 0x00, 0x3E, 0x3F,
+  0xB0, 0xF0, 0x30, 0x18, 0x0C, 0x0C, 0x0E, 0x0E, 0x0E, 0x06, 0x03, 0x01,
+  0x80, 0x00, 0x00, 0x30, 0x18, 0x0C, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xF8,
+  0x03, 0xC0, 0xF0, 0x38, 0x01, 0xC3, 0x00, 0x07, 0x38, 0x79, 0x99, 0x8F,
+  0xFC, 0xFC, 0x71, 0xE3, 0xC6, 0x07, 0x1E, 0x30, 0x18, 0xF1, 0x80, 0xC7,
+  0x8C, 0x06, 0x3C, 0x60, 0x73, 0x71, 0xC7, 0xB9, 0x8F, 0xFF, 0x8E, 0x1E,
+  0x70, 0x38, 0x00, 0x00, 0xE0, 0x04, 0x03, 0xC0, 0xE0, 0x0F, 0xFE, 0x00,
+  0x1F, 0xC0, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xE0, 0x06,
+  0x60, 0x06, 0x60, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x18, 0x18, 0x18,
+  0x18, 0x38, 0x1C, 0x3F, 0xFC, 0x3F, 0xFC, 0x60, 0x06, 0x60, 0x06, 0x60,
+  0x06, 0xC0, 0x03, 0xFF, 0x0F, 0xFC, 0xC0, 0xEC, 0x06, 0xC0, 0x6C, 0x06,
+  0xC0, 0x6C, 0x0C, 0xFF, 0x8F, 0xFC, 0xC0, 0x6C, 0x03, 0xC0, 0x3C, 0x03,
+  0xC0, 0x3C, 0x06, 0xFF, 0xEF, 0xF8, 0x07, 0xE0, 0x7F, 0xE3, 0xC1, 0xDC,
+  0x01, 0x60, 0x03, 0x80, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C,
+  0x00, 0x30, 0x00, 0xE0, 0x01, 0x80, 0x07, 0x00, 0x4F, 0x07, 0x1F, 0xF8,
+  0x1F, 0x80, 0xFF, 0x81, 0xFF, 0xE3, 0x01, 0xE6, 0x00, 0xEC, 0x00, 0xD8,
+  0x01, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00,
+  0x3C, 0x00, 0xF8, 0x01, 0xB0, 0x07, 0x60, 0x3C, 0xFF, 0xF1, 0xFF, 0x00,
+  0xFF, 0xFF, 0xFF, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xFF,
+  0xDF, 0xFB, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xFF, 0xFF,
+  0xFC, 0xFF, 0xFF, 0xFC, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xFF,
+  0xBF, 0xEC, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x00,
+  0x07, 0xE0, 0x3F, 0xF0, 0xE0, 0x73, 0x80, 0x26, 0x00, 0x1C, 0x00, 0x30,
+  0x00, 0x60, 0x00, 0xC0, 0x7F, 0x80, 0xFF, 0x00, 0x1E, 0x00, 0x3E, 0x00,
+  0x6C, 0x00, 0xDC, 0x01, 0x9E, 0x07, 0x1F, 0xFC, 0x0F, 0xE0, 0xC0, 0x1E,
+  0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03,
+  0xC0, 0x1E, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0C, 0x30, 0xC3,
+  0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3,
+  0x1B, 0xEF, 0x00, 0xC0, 0x73, 0x03, 0x8C, 0x1C, 0x30, 0xE0, 0xC7, 0x03,
+  0x38, 0x0D, 0xC0, 0x3E, 0x00, 0xF0, 0x03, 0xF0, 0x0C, 0xE0, 0x31, 0xC0,
+  0xC3, 0x83, 0x07, 0x0C, 0x0E, 0x30, 0x1C, 0xC0, 0x3B, 0x00, 0x70, 0xC0,
+  0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xFF, 0xFF, 0xFC,
+  0xE0, 0x07, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x1F, 0xD8, 0x1B, 0xD8, 0x1B,
+  0xCC, 0x33, 0xCC, 0x33, 0xCC, 0x33, 0xC6, 0x63, 0xC6, 0x63, 0xC7, 0xE3,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC1, 0x83, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xE0, 0x1F, 0x80, 0xFC, 0x07, 0xF0, 0x3D, 0x81, 0xE6, 0x0F, 0x30, 0x78,
+  0xC3, 0xC6, 0x1E, 0x18, 0xF0, 0xC7, 0x83, 0x3C, 0x19, 0xE0, 0x6F, 0x03,
+  0x78, 0x0F, 0xC0, 0x7E, 0x01, 0xC0, 0x07, 0xE0, 0x1F, 0xF8, 0x3C, 0x1C,
+  0x70, 0x0E, 0x60, 0x06, 0xE0, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x07, 0x60, 0x06, 0x70, 0x0E,
+  0x38, 0x1C, 0x1F, 0xF8, 0x07, 0xE0, 0xFF, 0x1F, 0xFB, 0x03, 0x60, 0x3C,
+  0x07, 0x80, 0xF0, 0x1E, 0x06, 0xFF, 0xDF, 0xE3, 0x00, 0x60, 0x0C, 0x01,
+  0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3C,
+  0x1C, 0x70, 0x0E, 0x60, 0x06, 0xE0, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x07, 0x60, 0x06, 0x70,
+  0x0E, 0x38, 0x1C, 0x1F, 0xF8, 0x07, 0xF0, 0x00, 0x38, 0x00, 0x18, 0x00,
+  0x0C, 0xFF, 0x07, 0xFE, 0x30, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x01,
+  0x98, 0x18, 0xFF, 0xC7, 0xFC, 0x30, 0x71, 0x81, 0x8C, 0x06, 0x60, 0x33,
+  0x01, 0xD8, 0x06, 0xC0, 0x36, 0x00, 0xC0, 0x1F, 0xC7, 0xFE, 0x70, 0x6C,
+  0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x07, 0x00, 0x7F, 0x01, 0xFC, 0x01, 0xE0,
+  0x07, 0x00, 0x30, 0x03, 0x00, 0x3C, 0x0E, 0xFF, 0xE3, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0,
+  0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30,
+  0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80,
+  0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07,
+  0x80, 0x3C, 0x01, 0xE0, 0x0D, 0x80, 0xCE, 0x0E, 0x3F, 0xE0, 0xFE, 0x00,
+  0xC0, 0x03, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x30, 0x0C, 0x30, 0x0C,
+  0x38, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30,
+  0x06, 0x60, 0x06, 0x60, 0x07, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x36, 0x07, 0x81, 0x98, 0x1E, 0x06, 0x60,
+  0xEC, 0x19, 0x83, 0x30, 0x63, 0x0C, 0xC3, 0x0C, 0x33, 0x0C, 0x31, 0xCE,
+  0x30, 0xC6, 0x18, 0xC1, 0x98, 0x66, 0x06, 0x61, 0x98, 0x19, 0x86, 0x60,
+  0x6C, 0x0D, 0x80, 0xF0, 0x3C, 0x03, 0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0x38,
+  0x07, 0x00, 0x70, 0x0E, 0x60, 0x18, 0x60, 0x60, 0xE1, 0xC0, 0xC7, 0x00,
+  0xCC, 0x01, 0xF0, 0x01, 0xE0, 0x03, 0x80, 0x07, 0x80, 0x1F, 0x00, 0x37,
+  0x00, 0xC6, 0x03, 0x86, 0x0E, 0x0E, 0x18, 0x0C, 0x60, 0x0D, 0xC0, 0x1C,
+  0xE0, 0x1D, 0x80, 0x63, 0x03, 0x0E, 0x1C, 0x18, 0x60, 0x73, 0x80, 0xFC,
+  0x01, 0xE0, 0x07, 0x80, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C,
+  0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x01, 0x80, 0x0E, 0x00, 0x70, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x80,
+  0x1C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xE0, 0x07, 0x00, 0x18, 0x00,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xF1, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C,
+  0x63, 0x18, 0xC6, 0x31, 0xFF, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x30,
+  0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x06, 0x06, 0x06,
+  0x07, 0x03, 0xFF, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63,
+  0x18, 0xC7, 0xFF, 0x80, 0x03, 0x80, 0x0F, 0x80, 0x3B, 0x80, 0xE3, 0x83,
+  0x83, 0x8E, 0x03, 0xB8, 0x03, 0x80, 0xFF, 0xFF, 0xFF, 0xE0, 0xC1, 0x83,
+  0x3F, 0x0F, 0xF9, 0x03, 0x00, 0x30, 0x06, 0x3F, 0xDF, 0xFF, 0x03, 0xC0,
+  0x78, 0x1F, 0x87, 0xBF, 0xF3, 0xE6, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00,
+  0xC0, 0x0C, 0xF8, 0xFF, 0xCF, 0x0E, 0xE0, 0x6C, 0x03, 0xC0, 0x3C, 0x03,
+  0xC0, 0x3C, 0x03, 0xE0, 0x6F, 0x0E, 0xFF, 0xCC, 0xF8, 0x0F, 0x8F, 0xF7,
+  0x05, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x18, 0x07, 0x04, 0xFF,
+  0x1F, 0x80, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x31, 0xF3, 0x3F,
+  0xF7, 0x0F, 0x60, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0x60,
+  0x77, 0x0F, 0x3F, 0xF1, 0xF3, 0x0F, 0x83, 0xFC, 0x70, 0xE6, 0x03, 0xC0,
+  0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0xC0, 0x06, 0x00, 0x70, 0x23, 0xFE, 0x0F,
+  0xC0, 0x0F, 0x1F, 0x30, 0x30, 0x30, 0xFF, 0xFF, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1F, 0x33, 0xFF, 0x70, 0xFE,
+  0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x70, 0xF3,
+  0xFF, 0x1F, 0x30, 0x03, 0x00, 0x72, 0x0E, 0x3F, 0xC1, 0xF8, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x9F, 0x3F, 0xF7, 0x87, 0xE0, 0x78, 0x0F,
+  0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0C, 0xFC,
+  0x3F, 0xFF, 0xFF, 0xF0, 0x18, 0xC6, 0x00, 0x0C, 0x63, 0x18, 0xC6, 0x31,
+  0x8C, 0x63, 0x18, 0xC6, 0x31, 0xFB, 0x80, 0xC0, 0x0C, 0x00, 0xC0, 0x0C,
+  0x00, 0xC0, 0x0C, 0x1C, 0xC3, 0x8C, 0x70, 0xCE, 0x0D, 0xC0, 0xF8, 0x0F,
+  0x80, 0xDC, 0x0C, 0xE0, 0xC7, 0x0C, 0x38, 0xC1, 0xCC, 0x0E, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xCF, 0x87, 0xCF, 0xFD, 0xFE, 0xF0, 0xF8, 0x7E, 0x07,
+  0x03, 0xC0, 0x60, 0x3C, 0x06, 0x03, 0xC0, 0x60, 0x3C, 0x06, 0x03, 0xC0,
+  0x60, 0x3C, 0x06, 0x03, 0xC0, 0x60, 0x3C, 0x06, 0x03, 0xC0, 0x60, 0x30,
+  0xCF, 0x9F, 0xFB, 0xC3, 0xF0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0,
+  0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x06, 0x1F, 0x83, 0xFC, 0x70, 0xEE, 0x06,
+  0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x06, 0x70, 0xE3, 0xFC,
+  0x1F, 0x80, 0xCF, 0x8F, 0xFC, 0xF0, 0xEE, 0x06, 0xC0, 0x3C, 0x03, 0xC0,
+  0x3C, 0x03, 0xC0, 0x3E, 0x06, 0xF0, 0xEF, 0xFC, 0xCF, 0x8C, 0x00, 0xC0,
+  0x0C, 0x00, 0xC0, 0x0C, 0x00, 0x1F, 0x33, 0xFF, 0x70, 0xF6, 0x07, 0xC0,
+  0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x36, 0x07, 0x70, 0xF3, 0xFF, 0x1F,
+  0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0xCF, 0xFF, 0xF0, 0xE0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x1F, 0xEE,
+  0x0B, 0x00, 0xC0, 0x3F, 0x03, 0xF8, 0x1F, 0x00, 0xC0, 0x38, 0x1F, 0xFE,
+  0x7F, 0x00, 0x30, 0x30, 0x30, 0x30, 0xFF, 0xFF, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x3F, 0x1F, 0xC0, 0x78, 0x0F, 0x01, 0xE0,
+  0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x1F, 0x87, 0xBF, 0xF3,
+  0xE6, 0xC0, 0x1B, 0x01, 0x98, 0x0C, 0xC0, 0xE3, 0x06, 0x18, 0x30, 0x63,
+  0x83, 0x18, 0x18, 0xC0, 0x6C, 0x03, 0x60, 0x1F, 0x00, 0x70, 0x00, 0xC1,
+  0xE0, 0xF0, 0x78, 0x36, 0x1E, 0x19, 0x87, 0x86, 0x63, 0x31, 0x9C, 0xCC,
+  0xE3, 0x33, 0x30, 0xCC, 0xCC, 0x36, 0x1B, 0x07, 0x87, 0x81, 0xE1, 0xE0,
+  0x78, 0x78, 0x1C, 0x0E, 0x00, 0xE0, 0x3B, 0x83, 0x8E, 0x38, 0x31, 0x80,
+  0xD8, 0x07, 0xC0, 0x1C, 0x01, 0xF0, 0x1D, 0xC0, 0xC6, 0x0C, 0x18, 0xE0,
+  0xEE, 0x03, 0x80, 0xC0, 0x1B, 0x01, 0x98, 0x0C, 0xE0, 0xE3, 0x06, 0x18,
+  0x70, 0x63, 0x03, 0x18, 0x0D, 0x80, 0x6C, 0x03, 0xE0, 0x0E, 0x00, 0x70,
+  0x03, 0x00, 0x18, 0x01, 0x80, 0x7C, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFC,
+  0x03, 0x00, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x01, 0x80,
+  0x7F, 0xFF, 0xFE, 0x07, 0x87, 0xC3, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18,
+  0x0C, 0x0E, 0x3E, 0x1F, 0x01, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03,
+  0x01, 0x80, 0xF8, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7C,
+  0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0E, 0x03, 0xE1, 0xF1,
+  0xC0, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x0F, 0x87, 0x80, 0x3E,
+  0x02, 0xFF, 0x0F, 0x0F, 0xF0, 0x07, 0xC0 };
+
+const GFXglyph DejaVuSans12pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
+  {     1,   2,  18,  10,    4,  -17 },   // 0x21 '!'
+  {     6,   6,   7,  11,    2,  -17 },   // 0x22 '"'
+  {    12,  16,  18,  20,    2,  -17 },   // 0x23 '#'
+  {    48,  11,  22,  15,    2,  -17 },   // 0x24 '$'
+  {    79,  20,  18,  23,    1,  -17 },   // 0x25 '%'
+  {   124,  16,  18,  19,    1,  -17 },   // 0x26 '&'
+  {   160,   2,   7,   7,    2,  -17 },   // 0x27 '''
+  {   162,   5,  21,   9,    2,  -17 },   // 0x28 '('
+  {   176,   5,  21,   9,    2,  -17 },   // 0x29 ')'
+  {   190,  11,  10,  12,    0,  -17 },   // 0x2A '*'
+  {   204,  16,  16,  20,    3,  -15 },   // 0x2B '+'
+  {   236,   3,   6,   8,    2,   -2 },   // 0x2C ','
+  {   239,   6,   2,   9,    1,   -7 },   // 0x2D '-'
+  {   241,   2,   3,   8,    3,   -2 },   // 0x2E '.'
+  {   242,   8,  20,   8,    0,  -17 },   // 0x2F '/'
+  {   262,  12,  18,  15,    2,  -17 },   // 0x30 '0'
+  {   289,  10,  18,  15,    3,  -17 },   // 0x31 '1'
+  {   312,  11,  18,  15,    2,  -17 },   // 0x32 '2'
+  {   337,  12,  18,  15,    2,  -17 },   // 0x33 '3'
+  {   364,  13,  18,  15,    1,  -17 },   // 0x34 '4'
+  {   394,  11,  18,  15,    2,  -17 },   // 0x35 '5'
+  {   419,  12,  18,  15,    2,  -17 },   // 0x36 '6'
+  {   446,  11,  18,  15,    2,  -17 },   // 0x37 '7'
+  {   471,  12,  18,  15,    2,  -17 },   // 0x38 '8'
+  {   498,  12,  18,  15,    2,  -17 },   // 0x39 '9'
+  {   525,   2,  12,   8,    3,  -11 },   // 0x3A ':'
+  {   528,   3,  15,   8,    2,  -11 },   // 0x3B ';'
+  {   534,  15,  13,  20,    3,  -13 },   // 0x3C '<'
+  {   559,  15,   7,  20,    3,  -10 },   // 0x3D '='
+  {   573,  15,  13,  20,    3,  -13 },   // 0x3E '>'
+  {   598,   9,  18,  13,    2,  -17 },   // 0x3F '?'
+  {   619,  21,  21,  24,    2,  -16 },   // 0x40 '@'
+  {   675,  16,  18,  16,    0,  -17 },   // 0x41 'A'
+  {   711,  12,  18,  16,    2,  -17 },   // 0x42 'B'
+  {   738,  14,  18,  17,    1,  -17 },   // 0x43 'C'
+  {   770,  15,  18,  18,    2,  -17 },   // 0x44 'D'
+  {   804,  11,  18,  15,    2,  -17 },   // 0x45 'E'
+  {   829,  10,  18,  14,    2,  -17 },   // 0x46 'F'
+  {   852,  15,  18,  19,    1,  -17 },   // 0x47 'G'
+  {   886,  13,  18,  18,    2,  -17 },   // 0x48 'H'
+  {   916,   2,  18,   7,    2,  -17 },   // 0x49 'I'
+  {   921,   6,  23,   7,   -2,  -17 },   // 0x4A 'J'
+  {   939,  14,  18,  16,    2,  -17 },   // 0x4B 'K'
+  {   971,  11,  18,  13,    2,  -17 },   // 0x4C 'L'
+  {   996,  16,  18,  21,    2,  -17 },   // 0x4D 'M'
+  {  1032,  13,  18,  18,    2,  -17 },   // 0x4E 'N'
+  {  1062,  16,  18,  19,    1,  -17 },   // 0x4F 'O'
+  {  1098,  11,  18,  14,    2,  -17 },   // 0x50 'P'
+  {  1123,  16,  21,  19,    1,  -17 },   // 0x51 'Q'
+  {  1165,  13,  18,  17,    2,  -17 },   // 0x52 'R'
+  {  1195,  12,  18,  15,    2,  -17 },   // 0x53 'S'
+  {  1222,  14,  18,  15,    0,  -17 },   // 0x54 'T'
+  {  1254,  13,  18,  18,    2,  -17 },   // 0x55 'U'
+  {  1284,  16,  18,  16,    0,  -17 },   // 0x56 'V'
+  {  1320,  22,  18,  24,    1,  -17 },   // 0x57 'W'
+  {  1370,  15,  18,  17,    1,  -17 },   // 0x58 'X'
+  {  1404,  14,  18,  15,    0,  -17 },   // 0x59 'Y'
+  {  1436,  14,  18,  16,    1,  -17 },   // 0x5A 'Z'
+  {  1468,   5,  21,   9,    2,  -17 },   // 0x5B '['
+  {  1482,   8,  20,   8,    0,  -17 },   // 0x5C '\'
+  {  1502,   5,  21,   9,    2,  -17 },   // 0x5D ']'
+  {  1516,  15,   7,  20,    3,  -17 },   // 0x5E '^'
+  {  1530,  12,   2,  12,    0,    5 },   // 0x5F '_'
+  {  1533,   6,   4,  12,    2,  -18 },   // 0x60 '`'
+  {  1536,  11,  13,  14,    1,  -12 },   // 0x61 'a'
+  {  1554,  12,  18,  15,    2,  -17 },   // 0x62 'b'
+  {  1581,  10,  13,  13,    1,  -12 },   // 0x63 'c'
+  {  1598,  12,  18,  15,    1,  -17 },   // 0x64 'd'
+  {  1625,  12,  13,  14,    1,  -12 },   // 0x65 'e'
+  {  1645,   8,  18,   8,    1,  -17 },   // 0x66 'f'
+  {  1663,  12,  18,  15,    1,  -12 },   // 0x67 'g'
+  {  1690,  11,  18,  15,    2,  -17 },   // 0x68 'h'
+  {  1715,   2,  18,   7,    2,  -17 },   // 0x69 'i'
+  {  1720,   5,  23,   7,   -1,  -17 },   // 0x6A 'j'
+  {  1735,  12,  18,  14,    2,  -17 },   // 0x6B 'k'
+  {  1762,   2,  18,   6,    2,  -17 },   // 0x6C 'l'
+  {  1767,  20,  13,  24,    2,  -12 },   // 0x6D 'm'
+  {  1800,  11,  13,  15,    2,  -12 },   // 0x6E 'n'
+  {  1818,  12,  13,  14,    1,  -12 },   // 0x6F 'o'
+  {  1838,  12,  18,  15,    2,  -12 },   // 0x70 'p'
+  {  1865,  12,  18,  15,    1,  -12 },   // 0x71 'q'
+  {  1892,   8,  13,  10,    2,  -12 },   // 0x72 'r'
+  {  1905,  10,  13,  12,    1,  -12 },   // 0x73 's'
+  {  1922,   8,  17,   9,    0,  -16 },   // 0x74 't'
+  {  1939,  11,  13,  15,    2,  -12 },   // 0x75 'u'
+  {  1957,  13,  13,  15,    1,  -12 },   // 0x76 'v'
+  {  1979,  18,  13,  20,    1,  -12 },   // 0x77 'w'
+  {  2009,  13,  13,  15,    1,  -12 },   // 0x78 'x'
+  {  2031,  13,  18,  15,    1,  -12 },   // 0x79 'y'
+  {  2061,  11,  13,  13,    1,  -12 },   // 0x7A 'z'
+  {  2079,   9,  22,  15,    3,  -17 },   // 0x7B '{'
+  {  2104,   2,  24,   8,    3,  -17 },   // 0x7C '|'
+  {  2110,   9,  22,  15,    3,  -17 },   // 0x7D '}'
+  {  2135,  15,   4,  20,    3,   -8 } }; // 0x7E '~'
+
+const GFXfont DejaVuSans12pt7b PROGMEM = {
+  (uint8_t  *)DejaVuSans12pt7bBitmaps,
+  (GFXglyph *)DejaVuSans12pt7bGlyphs,
+  0x20, 0x7E, 27 };
+
+// Approx. 2815 bytes
@@ -0,0 +1,488 @@
+// DejaVuSans.ttf at 18pt, converted with Adafruit GFX fontconvert (7-bit, 141 dpi).
+// Fixed font for tools/golden_check.cpp; DejaVu fonts license in LICENSE.
+#pragma once
+#include <Adafruit_GFX.h>
+
+const uint8_t DejaVuSans18pt7bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFC, 0xE1,
+  0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xC0, 0x00,
+  0x38, 0x30, 0x00, 0x30, 0x70, 0x00, 0x70, 0x70, 0x00, 0x70, 0x70, 0x00,
+  0x70, 0xE0, 0x00, 0x60, 0xE0, 0x00, 0xE0, 0xE0, 0x3F, 0xFF, 0xFF, 0x3F,
+  0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x01, 0xC1, 0xC0, 0x01, 0xC1, 0xC0, 0x01,
+  0xC1, 0x80, 0x03, 0x83, 0x80, 0x03, 0x83, 0x80, 0xFF, 0xFF, 0xFC, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x07,
+  0x06, 0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x0E,
+  0x0C, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0xFF,
+  0x81, 0xFF, 0xF1, 0xFF, 0xF8, 0xF3, 0x0C, 0xF1, 0x80, 0x70, 0xC0, 0x38,
+  0x60, 0x1C, 0x30, 0x0F, 0x18, 0x03, 0xFC, 0x00, 0xFF, 0xC0, 0x1F, 0xF8,
+  0x01, 0xFF, 0x00, 0xC7, 0x80, 0x61, 0xE0, 0x30, 0x70, 0x18, 0x38, 0x0C,
+  0x1E, 0x06, 0x1F, 0xC3, 0x3E, 0xFF, 0xFE, 0x3F, 0xFE, 0x03, 0xFC, 0x00,
+  0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x1F, 0x80,
+  0x06, 0x01, 0xFE, 0x00, 0x70, 0x1E, 0x78, 0x03, 0x00, 0xE1, 0xC0, 0x30,
+  0x0E, 0x07, 0x03, 0x80, 0x70, 0x38, 0x18, 0x03, 0x81, 0xC1, 0xC0, 0x1C,
+  0x0E, 0x0C, 0x00, 0xE0, 0x70, 0xC0, 0x07, 0x03, 0x8E, 0x00, 0x1C, 0x38,
+  0x60, 0x00, 0xF3, 0xC7, 0x00, 0x03, 0xFC, 0x30, 0xFC, 0x0F, 0xC3, 0x0F,
+  0xF0, 0x00, 0x38, 0xF3, 0xC0, 0x01, 0x87, 0x0E, 0x00, 0x1C, 0x70, 0x38,
+  0x00, 0xC3, 0x81, 0xC0, 0x0C, 0x1C, 0x0E, 0x00, 0xE0, 0xE0, 0x70, 0x06,
+  0x07, 0x03, 0x80, 0x70, 0x38, 0x1C, 0x03, 0x00, 0xE1, 0xC0, 0x30, 0x07,
+  0x9E, 0x03, 0x80, 0x1F, 0xE0, 0x18, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00,
+  0x07, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0x03, 0x00, 0x1E, 0x00, 0x00,
+  0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x3D, 0xE0, 0x0E,
+  0x78, 0xF0, 0x0E, 0x70, 0x78, 0x1E, 0xF0, 0x3C, 0x1C, 0xE0, 0x1F, 0x1C,
+  0xE0, 0x0F, 0xB8, 0xE0, 0x07, 0xF8, 0xE0, 0x03, 0xF0, 0xF0, 0x01, 0xF0,
+  0x78, 0x03, 0xF0, 0x3E, 0x0F, 0xF8, 0x3F, 0xFF, 0x7C, 0x0F, 0xFE, 0x3E,
+  0x03, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0x0E, 0x1E, 0x1C, 0x18,
+  0x38, 0x38, 0x70, 0x70, 0x70, 0x70, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0x60, 0x70, 0x70, 0x70, 0x38, 0x38, 0x1C, 0x1C, 0x1C,
+  0x0E, 0x07, 0xE0, 0x70, 0x70, 0x38, 0x38, 0x1C, 0x1C, 0x0E, 0x0E, 0x0E,
+  0x0E, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0E, 0x0E,
+  0x0E, 0x0E, 0x1C, 0x1C, 0x38, 0x38, 0x78, 0x70, 0xE0, 0x01, 0x80, 0x01,
+  0x80, 0x01, 0x80, 0x41, 0x82, 0xF1, 0x8F, 0x39, 0x9C, 0x1F, 0xF8, 0x07,
+  0xE0, 0x07, 0xE0, 0x1F, 0xF0, 0x39, 0x9C, 0xF1, 0x8F, 0x41, 0x82, 0x01,
+  0x80, 0x01, 0x80, 0x01, 0x80, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00,
+  0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0E,
+  0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0x00, 0x00, 0x0E, 0x00,
+  0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00,
+  0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00,
+  0x77, 0x77, 0x6E, 0xEC, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x70,
+  0x0F, 0x00, 0xE0, 0x0E, 0x01, 0xE0, 0x1C, 0x01, 0xC0, 0x1C, 0x03, 0x80,
+  0x38, 0x03, 0x80, 0x78, 0x07, 0x00, 0x70, 0x0F, 0x00, 0xE0, 0x0E, 0x00,
+  0xE0, 0x1C, 0x01, 0xC0, 0x1C, 0x03, 0x80, 0x38, 0x03, 0x80, 0x78, 0x07,
+  0x00, 0x70, 0x0F, 0x00, 0xE0, 0x00, 0x03, 0xF0, 0x03, 0xFF, 0x01, 0xFF,
+  0xE0, 0xF8, 0x7C, 0x38, 0x07, 0x1E, 0x01, 0xE7, 0x00, 0x39, 0xC0, 0x0E,
+  0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8,
+  0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x77, 0x00,
+  0x39, 0xC0, 0x0E, 0x78, 0x07, 0x8E, 0x01, 0xC3, 0xE1, 0xF0, 0x7F, 0xF8,
+  0x0F, 0xFC, 0x00, 0xFC, 0x00, 0x1F, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0x1C,
+  0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00,
+  0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03,
+  0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0,
+  0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xE0, 0xFF, 0xF8, 0xFF, 0xFC,
+  0xF0, 0x3E, 0x80, 0x0E, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+  0x00, 0x07, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x78,
+  0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00,
+  0x3C, 0x00, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xE0,
+  0x3F, 0xFC, 0x1F, 0xFF, 0x0C, 0x07, 0xC0, 0x00, 0xF0, 0x00, 0x38, 0x00,
+  0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x81, 0xFF, 0x80,
+  0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x7C, 0x00, 0x0E, 0x00, 0x07, 0x80, 0x01,
+  0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3B, 0x00, 0x7D, 0xFF,
+  0xFC, 0xFF, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x01,
+  0xF8, 0x00, 0x77, 0x00, 0x0E, 0xE0, 0x03, 0x9C, 0x00, 0xE3, 0x80, 0x1C,
+  0x70, 0x07, 0x0E, 0x00, 0xE1, 0xC0, 0x38, 0x38, 0x0E, 0x07, 0x01, 0xC0,
+  0xE0, 0x70, 0x1C, 0x1C, 0x03, 0x83, 0x80, 0x70, 0xE0, 0x0E, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03,
+  0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x7F, 0xFE, 0x3F, 0xFF,
+  0x1F, 0xFF, 0x8E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0,
+  0x00, 0x70, 0x00, 0x3F, 0xF0, 0x1F, 0xFE, 0x0F, 0xFF, 0xC6, 0x03, 0xE0,
+  0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00,
+  0xE0, 0x00, 0x70, 0x00, 0x78, 0x00, 0x7B, 0x00, 0xFD, 0xFF, 0xFC, 0xFF,
+  0xF8, 0x1F, 0xF0, 0x00, 0x01, 0xFC, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x7C,
+  0x0C, 0x3C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0xF0, 0x00,
+  0x38, 0xFE, 0x0E, 0x7F, 0xE3, 0xBF, 0xFC, 0xFE, 0x0F, 0xBE, 0x00, 0xEF,
+  0x80, 0x3F, 0xC0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x77, 0x00, 0x1D, 0xC0,
+  0x07, 0x78, 0x03, 0xCE, 0x00, 0xE3, 0xE0, 0xF8, 0x7F, 0xFC, 0x0F, 0xFE,
+  0x00, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x00,
+  0x0E, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x38, 0x00,
+  0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x01,
+  0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x07,
+  0x00, 0x07, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x03, 0xF8, 0x03, 0xFF, 0x03,
+  0xFF, 0xF0, 0xF0, 0x3C, 0x78, 0x07, 0x9C, 0x00, 0xE7, 0x00, 0x39, 0xC0,
+  0x0E, 0x70, 0x03, 0x8E, 0x01, 0xC3, 0xC0, 0xF0, 0x7F, 0xF8, 0x07, 0xF8,
+  0x07, 0xFF, 0x87, 0xC0, 0xF9, 0xC0, 0x0E, 0xE0, 0x01, 0xF8, 0x00, 0x7E,
+  0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xFC, 0x00, 0xF7, 0xC0, 0xF8, 0xFF,
+  0xFC, 0x1F, 0xFE, 0x01, 0xFE, 0x00, 0x07, 0xF0, 0x07, 0xFF, 0x03, 0xFF,
+  0xE1, 0xF0, 0x7C, 0x70, 0x07, 0x3C, 0x01, 0xEE, 0x00, 0x3B, 0x80, 0x0E,
+  0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x1F, 0x70, 0x07, 0xDF,
+  0x07, 0xF3, 0xFF, 0xDC, 0x7F, 0xE7, 0x07, 0xF1, 0xC0, 0x00, 0xF0, 0x00,
+  0x38, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0xC3, 0x03, 0xE0, 0xFF, 0xF0,
+  0x3F, 0xF8, 0x03, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC,
+  0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x6E, 0xEC, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0xC0, 0x03, 0xFE, 0x00, 0x3F,
+  0xC0, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x03,
+  0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x07,
+  0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x80, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8,
+  0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xF0,
+  0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0xFF,
+  0x00, 0x1F, 0xF0, 0x00, 0xFE, 0x00, 0x03, 0xC0, 0x00, 0x08, 0x00, 0x00,
+  0x00, 0x1F, 0xC1, 0xFF, 0xCF, 0xFF, 0xBC, 0x1E, 0x80, 0x3C, 0x00, 0x70,
+  0x01, 0xC0, 0x07, 0x00, 0x78, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0,
+  0x3C, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x1F,
+  0x80, 0x7E, 0x00, 0x7C, 0x00, 0x3E, 0x01, 0xE0, 0x00, 0x1E, 0x07, 0x80,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x1E, 0x38, 0x0F, 0x8E, 0x1C, 0xF0, 0x7F,
+  0xDC, 0x39, 0xC1, 0xFF, 0xF8, 0x3F, 0x83, 0xC1, 0xF0, 0x7E, 0x0F, 0x01,
+  0xE0, 0xFC, 0x1C, 0x01, 0xC1, 0xF8, 0x38, 0x03, 0x83, 0xF0, 0x70, 0x07,
+  0x07, 0xE0, 0xE0, 0x0E, 0x1F, 0xC1, 0xC0, 0x1C, 0x3B, 0x83, 0xC0, 0x78,
+  0xF7, 0x83, 0xC1, 0xF3, 0xC7, 0x07, 0xFF, 0xFF, 0x0E, 0x07, 0xFD, 0xF8,
+  0x0E, 0x03, 0xE3, 0xC0, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x00, 0x02, 0x00, 0x3F, 0x00, 0x0E, 0x00, 0x1F, 0x80, 0xFC, 0x00,
+  0x1F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00,
+  0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x07, 0x70, 0x00,
+  0x0E, 0xE0, 0x00, 0x1D, 0xC0, 0x00, 0x71, 0xC0, 0x00, 0xE3, 0x80, 0x03,
+  0xC7, 0x80, 0x07, 0x07, 0x00, 0x0E, 0x0E, 0x00, 0x3C, 0x1E, 0x00, 0x70,
+  0x1C, 0x00, 0xE0, 0x38, 0x03, 0x80, 0x38, 0x07, 0x00, 0x70, 0x1E, 0x00,
+  0xF0, 0x3F, 0xFF, 0xE0, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0xC3, 0x80, 0x03,
+  0x87, 0x00, 0x07, 0x1C, 0x00, 0x07, 0x38, 0x00, 0x0E, 0x70, 0x00, 0x1D,
+  0xC0, 0x00, 0x1C, 0xFF, 0xF8, 0x3F, 0xFF, 0x8F, 0xFF, 0xF3, 0x80, 0x3C,
+  0xE0, 0x07, 0xB8, 0x00, 0xEE, 0x00, 0x3B, 0x80, 0x0E, 0xE0, 0x03, 0xB8,
+  0x01, 0xEE, 0x00, 0xF3, 0xFF, 0xF8, 0xFF, 0xFC, 0x3F, 0xFF, 0xCE, 0x00,
+  0xFB, 0x80, 0x0E, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07,
+  0xE0, 0x01, 0xF8, 0x00, 0xFE, 0x00, 0xFB, 0xFF, 0xFC, 0xFF, 0xFE, 0x3F,
+  0xFE, 0x00, 0x00, 0x7F, 0x80, 0x1F, 0xFF, 0x83, 0xFF, 0xFE, 0x3F, 0x01,
+  0xF3, 0xE0, 0x01, 0x9E, 0x00, 0x05, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0x70,
+  0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00,
+  0x70, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80,
+  0x00, 0x1C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x9F, 0x00, 0x0C,
+  0x7E, 0x03, 0xE1, 0xFF, 0xFF, 0x03, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0xFF,
+  0xF0, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0xE1, 0xC0, 0x1F, 0x8E, 0x00, 0x3E,
+  0x70, 0x00, 0x73, 0x80, 0x03, 0xDC, 0x00, 0x0E, 0xE0, 0x00, 0x7F, 0x00,
+  0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x1F,
+  0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00,
+  0x1D, 0xC0, 0x01, 0xEE, 0x00, 0x0E, 0x70, 0x01, 0xF3, 0x80, 0x3F, 0x1F,
+  0xFF, 0xF0, 0xFF, 0xFE, 0x07, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38,
+  0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0xFF, 0xEF, 0xFF,
+  0xDF, 0xFF, 0xB8, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07,
+  0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0,
+  0x00, 0x00, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0xFF, 0xFF, 0x87, 0xE0, 0x3E,
+  0x3E, 0x00, 0x18, 0xE0, 0x00, 0x27, 0x80, 0x00, 0x1C, 0x00, 0x00, 0x70,
+  0x00, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x07,
+  0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x7F, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1D,
+  0xC0, 0x00, 0x77, 0x00, 0x01, 0xDE, 0x00, 0x07, 0x38, 0x00, 0x1C, 0xF8,
+  0x00, 0x71, 0xF8, 0x07, 0xC3, 0xFF, 0xFE, 0x03, 0xFF, 0xE0, 0x03, 0xFE,
+  0x00, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00,
+  0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00,
+  0x1F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+  0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00,
+  0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00,
+  0xFC, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x0E, 0x1E, 0xFE, 0xFC, 0xF0, 0xE0, 0x03,
+  0xCE, 0x00, 0x78, 0xE0, 0x0F, 0x0E, 0x01, 0xE0, 0xE0, 0x3C, 0x0E, 0x07,
+  0x80, 0xE0, 0xF0, 0x0E, 0x1E, 0x00, 0xE3, 0xC0, 0x0E, 0x78, 0x00, 0xEF,
+  0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0xEF, 0x80, 0x0E,
+  0x7C, 0x00, 0xE3, 0xE0, 0x0E, 0x1F, 0x00, 0xE0, 0xF8, 0x0E, 0x07, 0xC0,
+  0xE0, 0x3E, 0x0E, 0x01, 0xF0, 0xE0, 0x0F, 0x8E, 0x00, 0x7C, 0xE0, 0x03,
+  0xEE, 0x00, 0x1F, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+  0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+  0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+  0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF8, 0x00,
+  0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x0F, 0xFD, 0xC0, 0x1D,
+  0xFB, 0x80, 0x3B, 0xF3, 0x80, 0xE7, 0xE7, 0x01, 0xCF, 0xCF, 0x07, 0x9F,
+  0x8E, 0x0E, 0x3F, 0x1C, 0x1C, 0x7E, 0x1C, 0x70, 0xFC, 0x38, 0xE1, 0xF8,
+  0x71, 0xC3, 0xF0, 0x77, 0x07, 0xE0, 0xEE, 0x0F, 0xC1, 0xFC, 0x1F, 0x81,
+  0xF0, 0x3F, 0x03, 0xE0, 0x7E, 0x03, 0x80, 0xFC, 0x00, 0x01, 0xF8, 0x00,
+  0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1C, 0xF8, 0x00,
+  0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x7F, 0xE0, 0x0F, 0xDC, 0x01,
+  0xFB, 0xC0, 0x3F, 0x38, 0x07, 0xE7, 0x80, 0xFC, 0x70, 0x1F, 0x8F, 0x03,
+  0xF0, 0xE0, 0x7E, 0x0E, 0x0F, 0xC1, 0xC1, 0xF8, 0x1C, 0x3F, 0x03, 0xC7,
+  0xE0, 0x38, 0xFC, 0x07, 0x9F, 0x80, 0x73, 0xF0, 0x0F, 0x7E, 0x00, 0xEF,
+  0xC0, 0x1F, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0x7C,
+  0x00, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x1F, 0x81, 0xF8,
+  0x3E, 0x00, 0x7C, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x1E, 0x70, 0x00, 0x0E,
+  0x70, 0x00, 0x0E, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07,
+  0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07,
+  0xE0, 0x00, 0x07, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0x78, 0x00, 0x1E,
+  0x3C, 0x00, 0x3C, 0x3E, 0x00, 0x7C, 0x1F, 0x81, 0xF8, 0x0F, 0xFF, 0xF0,
+  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0xE0, 0xFF, 0xF8, 0xFF, 0xFC,
+  0xE0, 0x3E, 0xE0, 0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x0F, 0xE0, 0x3E, 0xFF, 0xFC, 0xFF, 0xF8, 0xFF, 0xE0,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xFF,
+  0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x1F, 0x81, 0xF8, 0x3E, 0x00,
+  0x7C, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x1E, 0x70, 0x00, 0x0E, 0x70, 0x00,
+  0x0E, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00,
+  0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00,
+  0x07, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0x78, 0x00, 0x1E, 0x3C, 0x00,
+  0x3C, 0x3E, 0x00, 0x7C, 0x1F, 0x81, 0xF8, 0x0F, 0xFF, 0xF0, 0x03, 0xFF,
+  0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0xFF, 0xE0, 0x1F, 0xFF, 0x03,
+  0xFF, 0xF8, 0x70, 0x1F, 0x0E, 0x00, 0xF1, 0xC0, 0x0E, 0x38, 0x01, 0xC7,
+  0x00, 0x38, 0xE0, 0x07, 0x1C, 0x00, 0xE3, 0x80, 0x3C, 0x70, 0x0F, 0x0F,
+  0xFF, 0xC1, 0xFF, 0xF0, 0x3F, 0xFE, 0x07, 0x01, 0xE0, 0xE0, 0x1E, 0x1C,
+  0x01, 0xC3, 0x80, 0x3C, 0x70, 0x03, 0x8E, 0x00, 0x79, 0xC0, 0x07, 0x38,
+  0x00, 0xE7, 0x00, 0x0E, 0xE0, 0x01, 0xDC, 0x00, 0x1C, 0x07, 0xFC, 0x07,
+  0xFF, 0xC3, 0xFF, 0xF1, 0xF0, 0x0C, 0xF0, 0x00, 0x38, 0x00, 0x0E, 0x00,
+  0x03, 0x80, 0x00, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xFF, 0x80,
+  0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x01, 0xF8, 0x00, 0x1E, 0x00, 0x03, 0xC0,
+  0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xE0, 0x00, 0xEF, 0x00,
+  0xFB, 0xFF, 0xFC, 0xFF, 0xFE, 0x0F, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00,
+  0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C,
+  0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00,
+  0x0E, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0,
+  0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00,
+  0x70, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03,
+  0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07,
+  0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F,
+  0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F,
+  0x80, 0x03, 0xF8, 0x00, 0xF7, 0x00, 0x1C, 0xF0, 0x07, 0x8F, 0x01, 0xE1,
+  0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0x7F, 0x00, 0xE0, 0x00, 0x0E, 0xE0, 0x00,
+  0x39, 0xC0, 0x00, 0x73, 0x80, 0x01, 0xE3, 0x80, 0x03, 0x87, 0x00, 0x07,
+  0x0F, 0x00, 0x1E, 0x0E, 0x00, 0x38, 0x1C, 0x00, 0x70, 0x3C, 0x01, 0xE0,
+  0x38, 0x03, 0x80, 0x70, 0x07, 0x00, 0x70, 0x1C, 0x00, 0xE0, 0x38, 0x01,
+  0xE0, 0xF0, 0x01, 0xC1, 0xC0, 0x03, 0x83, 0x80, 0x07, 0x8F, 0x00, 0x07,
+  0x1C, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0xE0, 0x00, 0x1D, 0xC0, 0x00, 0x3F,
+  0x80, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0xE0, 0x03,
+  0xC0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x70, 0x07, 0xE0, 0x0E, 0x70, 0x07,
+  0xE0, 0x0E, 0x70, 0x07, 0xE0, 0x0E, 0x70, 0x0F, 0xF0, 0x0E, 0x38, 0x0E,
+  0x70, 0x1C, 0x38, 0x0E, 0x70, 0x1C, 0x38, 0x0E, 0x70, 0x1C, 0x38, 0x1E,
+  0x78, 0x1C, 0x1C, 0x1C, 0x38, 0x38, 0x1C, 0x1C, 0x38, 0x38, 0x1C, 0x1C,
+  0x38, 0x38, 0x1C, 0x1C, 0x38, 0x38, 0x0E, 0x38, 0x1C, 0x70, 0x0E, 0x38,
+  0x1C, 0x70, 0x0E, 0x38, 0x1C, 0x70, 0x0E, 0x38, 0x1C, 0x70, 0x0F, 0x70,
+  0x0E, 0xE0, 0x07, 0x70, 0x0E, 0xE0, 0x07, 0x70, 0x0E, 0xE0, 0x07, 0x70,
+  0x0E, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x03, 0xE0, 0x07, 0xC0, 0x03, 0xE0,
+  0x07, 0xC0, 0x03, 0xE0, 0x07, 0xC0, 0x78, 0x00, 0x78, 0xF0, 0x03, 0xC1,
+  0xC0, 0x0E, 0x07, 0x80, 0x78, 0x0F, 0x03, 0xC0, 0x1C, 0x0E, 0x00, 0x78,
+  0x78, 0x00, 0xF3, 0xC0, 0x01, 0xCE, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xC0,
+  0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
+  0x7F, 0x80, 0x03, 0xCF, 0x00, 0x0E, 0x1C, 0x00, 0x78, 0x78, 0x03, 0xC0,
+  0xF0, 0x0E, 0x01, 0xC0, 0x78, 0x07, 0x83, 0xC0, 0x0F, 0x0E, 0x00, 0x1C,
+  0x78, 0x00, 0x7B, 0xC0, 0x00, 0xF0, 0xF0, 0x00, 0x7B, 0xC0, 0x07, 0x8E,
+  0x00, 0x38, 0x78, 0x03, 0xC1, 0xE0, 0x3C, 0x07, 0x01, 0xC0, 0x3C, 0x1E,
+  0x00, 0xF1, 0xE0, 0x03, 0x8E, 0x00, 0x1E, 0xF0, 0x00, 0x7F, 0x00, 0x01,
+  0xF0, 0x00, 0x0F, 0x80, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00,
+  0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07,
+  0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00,
+  0x03, 0x80, 0x00, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0xFC, 0x00,
+  0x01, 0xC0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xE0,
+  0x00, 0x0E, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
+  0x00, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00,
+  0x38, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x01, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0xFF, 0xFF, 0xFF, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C,
+  0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87,
+  0x0F, 0xFF, 0xFF, 0x80, 0xE0, 0x0F, 0x00, 0x70, 0x07, 0x00, 0x78, 0x03,
+  0x80, 0x38, 0x03, 0x80, 0x1C, 0x01, 0xC0, 0x1C, 0x00, 0xE0, 0x0E, 0x00,
+  0xE0, 0x0F, 0x00, 0x70, 0x07, 0x00, 0x70, 0x03, 0x80, 0x38, 0x03, 0x80,
+  0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xE0, 0x0E, 0x00, 0xE0, 0x0F, 0x00, 0x70,
+  0xFF, 0xFF, 0xF8, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1,
+  0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38,
+  0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x78, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xE0,
+  0x00, 0xF3, 0xC0, 0x07, 0x87, 0x80, 0x3C, 0x0F, 0x01, 0xE0, 0x1E, 0x0F,
+  0x00, 0x3C, 0x78, 0x00, 0x7B, 0xC0, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0xF0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x0F, 0xE0, 0x3F,
+  0xF8, 0x7F, 0xFC, 0x70, 0x1E, 0x40, 0x0E, 0x00, 0x07, 0x00, 0x07, 0x0F,
+  0xFF, 0x3F, 0xFF, 0x7F, 0xFF, 0x78, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x0F, 0xE0, 0x1F, 0xF8, 0x3F, 0x7F, 0xFF, 0x3F, 0xF7, 0x0F, 0xC7, 0xE0,
+  0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03,
+  0x80, 0x01, 0xC0, 0x00, 0xE3, 0xF0, 0x77, 0xFE, 0x3F, 0xFF, 0x9F, 0x83,
+  0xCF, 0x80, 0xF7, 0x80, 0x3B, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0,
+  0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x3B, 0xE0, 0x3D,
+  0xF8, 0x3C, 0xFF, 0xFE, 0x77, 0xFE, 0x38, 0xFC, 0x00, 0x03, 0xF8, 0x1F,
+  0xFC, 0x7F, 0xF9, 0xF0, 0x37, 0x80, 0x0E, 0x00, 0x3C, 0x00, 0x70, 0x00,
+  0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x1E,
+  0x00, 0x1F, 0x03, 0x1F, 0xFE, 0x1F, 0xFC, 0x0F, 0xE0, 0x00, 0x03, 0x80,
+  0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E,
+  0x00, 0x07, 0x07, 0xE3, 0x8F, 0xFD, 0xCF, 0xFF, 0xE7, 0x83, 0xF7, 0x80,
+  0xFB, 0x80, 0x3F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8,
+  0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3B, 0x80, 0x3D, 0xE0, 0x3E, 0x78, 0x3F,
+  0x3F, 0xFF, 0x8F, 0xFD, 0xC1, 0xF8, 0xE0, 0x03, 0xF8, 0x03, 0xFF, 0x81,
+  0xFF, 0xF0, 0xF8, 0x3E, 0x78, 0x03, 0x9C, 0x00, 0xEE, 0x00, 0x1F, 0x80,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xE0, 0x00,
+  0x1C, 0x00, 0x07, 0x80, 0x08, 0xF8, 0x0E, 0x1F, 0xFF, 0x83, 0xFF, 0xC0,
+  0x3F, 0xC0, 0x03, 0xF0, 0x7F, 0x0F, 0xF1, 0xE0, 0x1C, 0x01, 0xC0, 0x1C,
+  0x01, 0xC0, 0xFF, 0xEF, 0xFE, 0xFF, 0xE1, 0xC0, 0x1C, 0x01, 0xC0, 0x1C,
+  0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C,
+  0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x00, 0x07, 0xE3, 0x8F, 0xFD, 0xCF,
+  0xFF, 0xEF, 0x83, 0xF7, 0x80, 0xFB, 0x80, 0x3F, 0x80, 0x0F, 0xC0, 0x07,
+  0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3B, 0x80,
+  0x3D, 0xE0, 0x3E, 0xF8, 0x3F, 0x3F, 0xFF, 0x8F, 0xFD, 0xC1, 0xF8, 0xE0,
+  0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0xC0, 0x7C, 0x7F, 0xFC, 0x3F, 0xFC,
+  0x07, 0xF8, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+  0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE3, 0xF0, 0xEF, 0xFC, 0xFF,
+  0xFE, 0xFC, 0x1E, 0xF0, 0x0F, 0xF0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xFF, 0xF0, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0E, 0x1C, 0x38, 0x70,
+  0x00, 0x00, 0x00, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C,
+  0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC7, 0xFE,
+  0xF9, 0xE0, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00,
+  0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x0F, 0x70, 0x0F, 0x38,
+  0x1F, 0x1C, 0x1F, 0x0E, 0x1F, 0x07, 0x1E, 0x03, 0x9E, 0x01, 0xFE, 0x00,
+  0xFE, 0x00, 0x7F, 0x00, 0x3B, 0xC0, 0x1C, 0xF0, 0x0E, 0x3C, 0x07, 0x0F,
+  0x03, 0x83, 0xC1, 0xC0, 0xF0, 0xE0, 0x3C, 0x70, 0x0F, 0x38, 0x03, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xE3,
+  0xF0, 0x1F, 0x87, 0x7F, 0xE3, 0xFF, 0x3F, 0xFF, 0xBF, 0xFD, 0xF8, 0x3D,
+  0xC1, 0xEF, 0x00, 0xF8, 0x07, 0xF8, 0x03, 0xC0, 0x1F, 0x80, 0x1C, 0x00,
+  0xFC, 0x00, 0xE0, 0x07, 0xE0, 0x07, 0x00, 0x3F, 0x00, 0x38, 0x01, 0xF8,
+  0x01, 0xC0, 0x0F, 0xC0, 0x0E, 0x00, 0x7E, 0x00, 0x70, 0x03, 0xF0, 0x03,
+  0x80, 0x1F, 0x80, 0x1C, 0x00, 0xFC, 0x00, 0xE0, 0x07, 0xE0, 0x07, 0x00,
+  0x3F, 0x00, 0x38, 0x01, 0xF8, 0x01, 0xC0, 0x0E, 0xE3, 0xF0, 0xEF, 0xFC,
+  0xFF, 0xFE, 0xFC, 0x1E, 0xF0, 0x0F, 0xF0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x03, 0xF0,
+  0x03, 0xFF, 0x03, 0xFF, 0xF0, 0xF0, 0x3C, 0x78, 0x07, 0x9C, 0x00, 0xEE,
+  0x00, 0x3F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80,
+  0x07, 0xF0, 0x03, 0xDC, 0x00, 0xE7, 0x80, 0x78, 0xF0, 0x3C, 0x3F, 0xFF,
+  0x03, 0xFF, 0x00, 0x3F, 0x00, 0xE3, 0xF0, 0x77, 0xFE, 0x3F, 0xFF, 0x9F,
+  0x83, 0xCF, 0x80, 0xF7, 0x80, 0x3B, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03,
+  0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x3B, 0xE0,
+  0x3D, 0xF8, 0x3C, 0xFF, 0xFE, 0x77, 0xFE, 0x38, 0xFC, 0x1C, 0x00, 0x0E,
+  0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00,
+  0x00, 0x07, 0xE3, 0x8F, 0xFD, 0xCF, 0xFF, 0xE7, 0x83, 0xF7, 0x80, 0xFB,
+  0x80, 0x3F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00,
+  0xFC, 0x00, 0x7E, 0x00, 0x3B, 0x80, 0x3D, 0xE0, 0x3E, 0x78, 0x3F, 0x3F,
+  0xFF, 0x8F, 0xFD, 0xC1, 0xF8, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C,
+  0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0xE3, 0xFD, 0xFF,
+  0xFF, 0xFE, 0x0F, 0x01, 0xE0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80,
+  0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x00,
+  0x0F, 0xF0, 0x7F, 0xF9, 0xFF, 0xF7, 0xC0, 0x6E, 0x00, 0x1C, 0x00, 0x3C,
+  0x00, 0x3F, 0xC0, 0x3F, 0xF0, 0x1F, 0xF0, 0x03, 0xF0, 0x00, 0xF0, 0x00,
+  0xE0, 0x01, 0xE0, 0x03, 0xF8, 0x1F, 0xFF, 0xFC, 0xFF, 0xF0, 0x3F, 0x80,
+  0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0x38,
+  0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07,
+  0x00, 0xE0, 0x1C, 0x03, 0xC0, 0x3F, 0xC7, 0xF8, 0x3F, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x0F, 0xF0, 0x0F, 0x78, 0x3F, 0x7F, 0xFF, 0x3F, 0xF7, 0x0F, 0xC7, 0xE0,
+  0x00, 0xEE, 0x00, 0x39, 0xC0, 0x07, 0x3C, 0x01, 0xE3, 0x80, 0x38, 0x70,
+  0x07, 0x0F, 0x01, 0xE0, 0xE0, 0x38, 0x1C, 0x0F, 0x01, 0xC1, 0xC0, 0x38,
+  0x38, 0x07, 0x8F, 0x00, 0x71, 0xC0, 0x0E, 0x38, 0x00, 0xEE, 0x00, 0x1D,
+  0xC0, 0x03, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xE0, 0x1E, 0x01,
+  0xFC, 0x0F, 0xC0, 0xF7, 0x03, 0xF0, 0x39, 0xC0, 0xFC, 0x0E, 0x70, 0x3F,
+  0x03, 0x9E, 0x1C, 0xE1, 0xE3, 0x87, 0x38, 0x70, 0xE1, 0xCE, 0x1C, 0x38,
+  0x73, 0x87, 0x07, 0x38, 0x73, 0x81, 0xCE, 0x1C, 0xE0, 0x73, 0x87, 0x38,
+  0x1D, 0xE1, 0xEE, 0x03, 0xF0, 0x3F, 0x00, 0xFC, 0x0F, 0xC0, 0x3F, 0x03,
+  0xF0, 0x0F, 0xC0, 0xFC, 0x01, 0xE0, 0x1E, 0x00, 0x78, 0x07, 0x80, 0x78,
+  0x01, 0xE7, 0x80, 0x78, 0x78, 0x1E, 0x07, 0x03, 0x80, 0xF0, 0xF0, 0x0F,
+  0x3C, 0x00, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x07,
+  0xE0, 0x01, 0xFE, 0x00, 0x79, 0xC0, 0x1E, 0x3C, 0x03, 0x83, 0xC0, 0xF0,
+  0x38, 0x3C, 0x07, 0x8F, 0x00, 0x7B, 0xC0, 0x07, 0x80, 0xE0, 0x00, 0xEE,
+  0x00, 0x39, 0xC0, 0x07, 0x1C, 0x01, 0xE3, 0x80, 0x38, 0x78, 0x0F, 0x07,
+  0x01, 0xC0, 0xF0, 0x38, 0x0E, 0x0E, 0x01, 0xC1, 0xC0, 0x1C, 0x78, 0x03,
+  0x8E, 0x00, 0x79, 0xC0, 0x07, 0x70, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x01,
+  0xF0, 0x00, 0x1E, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x03,
+  0x80, 0x00, 0xF0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07,
+  0x80, 0x1E, 0x00, 0x3C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+  0xF8, 0x1F, 0xC0, 0xFE, 0x0F, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0,
+  0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x07, 0x03, 0xF8, 0x1F,
+  0x00, 0xFE, 0x00, 0xF0, 0x03, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C,
+  0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x78, 0x01, 0xFC,
+  0x0F, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xF8, 0x07, 0xF0, 0x3F, 0x80, 0x1E, 0x00,
+  0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E,
+  0x00, 0x70, 0x03, 0xC0, 0x0F, 0xE0, 0x1F, 0x03, 0xF8, 0x1E, 0x01, 0xE0,
+  0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01,
+  0xC0, 0x0E, 0x00, 0xF0, 0x7F, 0x03, 0xF8, 0x1F, 0x00, 0x0F, 0xC0, 0x05,
+  0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFE, 0xC0, 0x0F, 0xE0, 0x00,
+  0x00, 0x00 };
+
+const GFXglyph DejaVuSans18pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  11,    0,    0 },   // 0x20 ' '
+  {     1,   3,  26,  14,    5,  -25 },   // 0x21 '!'
+  {    11,  10,   9,  16,    3,  -25 },   // 0x22 '"'
+  {    23,  24,  25,  29,    3,  -24 },   // 0x23 '#'
+  {    98,  17,  32,  22,    3,  -26 },   // 0x24 '$'
+  {   166,  29,  26,  33,    2,  -25 },   // 0x25 '%'
+  {   261,  24,  26,  27,    2,  -25 },   // 0x26 '&'
+  {   339,   3,   9,  10,    3,  -25 },   // 0x27 '''
+  {   343,   8,  31,  14,    3,  -26 },   // 0x28 '('
+  {   374,   8,  31,  14,    3,  -26 },   // 0x29 ')'
+  {   405,  16,  16,  18,    1,  -25 },   // 0x2A '*'
+  {   437,  23,  23,  29,    4,  -22 },   // 0x2B '+'
+  {   504,   4,   8,  11,    3,   -3 },   // 0x2C ','
+  {   508,   9,   3,  13,    2,  -10 },   // 0x2D '-'
+  {   512,   3,   4,  11,    4,   -3 },   // 0x2E '.'
+  {   514,  12,  29,  12,    0,  -25 },   // 0x2F '/'
+  {   558,  18,  26,  22,    2,  -25 },   // 0x30 '0'
+  {   617,  15,  26,  22,    4,  -25 },   // 0x31 '1'
+  {   666,  16,  26,  22,    3,  -25 },   // 0x32 '2'
+  {   718,  17,  26,  22,    3,  -25 },   // 0x33 '3'
+  {   774,  19,  26,  22,    2,  -25 },   // 0x34 '4'
+  {   836,  17,  26,  22,    3,  -25 },   // 0x35 '5'
+  {   892,  18,  26,  22,    2,  -25 },   // 0x36 '6'
+  {   951,  16,  26,  22,    3,  -25 },   // 0x37 '7'
+  {  1003,  18,  26,  22,    2,  -25 },   // 0x38 '8'
+  {  1062,  18,  26,  22,    2,  -25 },   // 0x39 '9'
+  {  1121,   3,  18,  12,    4,  -17 },   // 0x3A ':'
+  {  1128,   4,  22,  12,    3,  -17 },   // 0x3B ';'
+  {  1139,  22,  19,  29,    4,  -19 },   // 0x3C '<'
+  {  1192,  22,  10,  29,    4,  -15 },   // 0x3D '='
+  {  1220,  22,  19,  29,    4,  -19 },   // 0x3E '>'
+  {  1273,  14,  26,  19,    3,  -25 },   // 0x3F '?'
+  {  1319,  31,  31,  35,    2,  -24 },   // 0x40 '@'
+  {  1440,  23,  26,  24,    0,  -25 },   // 0x41 'A'
+  {  1515,  18,  26,  24,    3,  -25 },   // 0x42 'B'
+  {  1574,  21,  26,  24,    2,  -25 },   // 0x43 'C'
+  {  1643,  21,  26,  27,    3,  -25 },   // 0x44 'D'
+  {  1712,  16,  26,  22,    3,  -25 },   // 0x45 'E'
+  {  1764,  15,  26,  20,    3,  -25 },   // 0x46 'F'
+  {  1813,  22,  26,  27,    2,  -25 },   // 0x47 'G'
+  {  1885,  19,  26,  26,    3,  -25 },   // 0x48 'H'
+  {  1947,   3,  26,  10,    3,  -25 },   // 0x49 'I'
+  {  1957,   8,  33,  10,   -2,  -25 },   // 0x4A 'J'
+  {  1990,  20,  26,  23,    3,  -25 },   // 0x4B 'K'
+  {  2055,  16,  26,  20,    3,  -25 },   // 0x4C 'L'
+  {  2107,  23,  26,  30,    3,  -25 },   // 0x4D 'M'
+  {  2182,  19,  26,  26,    3,  -25 },   // 0x4E 'N'
+  {  2244,  24,  26,  28,    2,  -25 },   // 0x4F 'O'
+  {  2322,  16,  26,  21,    3,  -25 },   // 0x50 'P'
+  {  2374,  24,  31,  28,    2,  -25 },   // 0x51 'Q'
+  {  2467,  19,  26,  24,    3,  -25 },   // 0x52 'R'
+  {  2529,  18,  26,  22,    2,  -25 },   // 0x53 'S'
+  {  2588,  21,  26,  21,    0,  -25 },   // 0x54 'T'
+  {  2657,  19,  26,  26,    3,  -25 },   // 0x55 'U'
+  {  2719,  23,  26,  24,    0,  -25 },   // 0x56 'V'
+  {  2794,  32,  26,  35,    1,  -25 },   // 0x57 'W'
+  {  2898,  22,  26,  24,    1,  -25 },   // 0x58 'X'
+  {  2970,  21,  26,  21,    0,  -25 },   // 0x59 'Y'
+  {  3039,  21,  26,  24,    2,  -25 },   // 0x5A 'Z'
+  {  3108,   7,  31,  14,    3,  -26 },   // 0x5B '['
+  {  3136,  12,  29,  12,    0,  -25 },   // 0x5C '\'
+  {  3180,   7,  31,  14,    3,  -26 },   // 0x5D ']'
+  {  3208,  22,  10,  29,    4,  -25 },   // 0x5E '^'
+  {  3236,  18,   3,  18,    0,    6 },   // 0x5F '_'
+  {  3243,   8,   6,  18,    3,  -27 },   // 0x60 '`'
+  {  3249,  16,  19,  21,    2,  -18 },   // 0x61 'a'
+  {  3287,  17,  27,  22,    3,  -26 },   // 0x62 'b'
+  {  3345,  15,  19,  19,    2,  -18 },   // 0x63 'c'
+  {  3381,  17,  27,  22,    2,  -26 },   // 0x64 'd'
+  {  3439,  18,  19,  22,    2,  -18 },   // 0x65 'e'
+  {  3482,  12,  27,  12,    1,  -26 },   // 0x66 'f'
+  {  3523,  17,  26,  22,    2,  -18 },   // 0x67 'g'
+  {  3579,  16,  27,  22,    3,  -26 },   // 0x68 'h'
+  {  3633,   3,  27,  10,    3,  -26 },   // 0x69 'i'
+  {  3644,   7,  34,  10,   -1,  -26 },   // 0x6A 'j'
+  {  3674,  17,  27,  20,    3,  -26 },   // 0x6B 'k'
+  {  3732,   3,  27,  10,    3,  -26 },   // 0x6C 'l'
+  {  3743,  29,  19,  34,    3,  -18 },   // 0x6D 'm'
+  {  3812,  16,  19,  22,    3,  -18 },   // 0x6E 'n'
+  {  3850,  18,  19,  21,    2,  -18 },   // 0x6F 'o'
+  {  3893,  17,  26,  22,    3,  -18 },   // 0x70 'p'
+  {  3949,  17,  26,  22,    2,  -18 },   // 0x71 'q'
+  {  4005,  11,  19,  14,    3,  -18 },   // 0x72 'r'
+  {  4032,  15,  19,  18,    2,  -18 },   // 0x73 's'
+  {  4068,  11,  24,  14,    1,  -23 },   // 0x74 't'
+  {  4101,  16,  19,  22,    3,  -18 },   // 0x75 'u'
+  {  4139,  19,  19,  21,    1,  -18 },   // 0x76 'v'
+  {  4185,  26,  19,  29,    1,  -18 },   // 0x77 'w'
+  {  4247,  19,  19,  21,    1,  -18 },   // 0x78 'x'
+  {  4293,  19,  26,  21,    1,  -18 },   // 0x79 'y'
+  {  4355,  15,  19,  18,    2,  -18 },   // 0x7A 'z'
+  {  4391,  13,  32,  22,    5,  -26 },   // 0x7B '{'
+  {  4443,   3,  35,  12,    4,  -26 },   // 0x7C '|'
+  {  4457,  13,  32,  22,    4,  -26 },   // 0x7D '}'
+  {  4509,  22,   6,  29,    4,  -13 } }; // 0x7E '~'
+
+const GFXfont DejaVuSans18pt7b PROGMEM = {
+  (uint8_t  *)DejaVuSans18pt7bBitmaps,
+  (GFXglyph *)DejaVuSans18pt7bGlyphs,
+  0x20, 0x7E, 41 };
+
+// Approx. 5198 bytes
@@ -0,0 +1,321 @@
+// DejaVuSans-Bold.ttf at 12pt, converted with Adafruit GFX fontconvert (7-bit, 141 dpi).
+// Fixed font for tools/golden_check.cpp; DejaVu fonts license in LICENSE.
+#pragma once
+#include <Adafruit_GFX.h>
+
+const uint8_t DejaVuSans_Bold12pt7bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE7, 0xE7,
+  0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0x03, 0x8E, 0x01, 0xC7, 0x00, 0xE3, 0x00,
+  0x63, 0x80, 0x71, 0xC3, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFF, 0x06, 0x38,
+  0x07, 0x1C, 0x03, 0x8C, 0x1F, 0xFF, 0xEF, 0xFF, 0xF7, 0xFF, 0xF8, 0x71,
+  0xC0, 0x38, 0xC0, 0x18, 0xE0, 0x1C, 0x70, 0x00, 0x03, 0x00, 0x0C, 0x00,
+  0x30, 0x07, 0xF8, 0x7F, 0xF9, 0xFF, 0xEF, 0xB1, 0xBC, 0xC0, 0xF3, 0x03,
+  0xFE, 0x07, 0xFF, 0x0F, 0xFE, 0x07, 0xFC, 0x0D, 0xF0, 0x33, 0xF0, 0xCF,
+  0xFF, 0xFB, 0xFF, 0xE3, 0xFE, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30,
+  0x00, 0x3E, 0x00, 0xC0, 0xFE, 0x03, 0x03, 0xDE, 0x0E, 0x07, 0x1C, 0x18,
+  0x0E, 0x38, 0x60, 0x1C, 0x71, 0xC0, 0x38, 0xE3, 0x00, 0x7B, 0xCE, 0x00,
+  0x7F, 0x18, 0xF8, 0x7C, 0x63, 0xF8, 0x01, 0xCF, 0x78, 0x03, 0x1C, 0x70,
+  0x0E, 0x38, 0xE0, 0x38, 0x71, 0xC0, 0x60, 0xE3, 0x81, 0xC1, 0xEF, 0x03,
+  0x01, 0xFC, 0x0C, 0x01, 0xF0, 0x03, 0xF0, 0x03, 0xFE, 0x01, 0xFF, 0x80,
+  0x78, 0x20, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xF0, 0x00, 0x7E, 0x00, 0x3F,
+  0xC7, 0x9F, 0xF9, 0xEF, 0xBF, 0x73, 0xC7, 0xFC, 0xF0, 0xFE, 0x3C, 0x1F,
+  0x8F, 0x83, 0xE1, 0xFF, 0xFC, 0x3F, 0xFF, 0x83, 0xF3, 0xF0, 0xFF, 0xFF,
+  0xF8, 0x1E, 0x38, 0xF1, 0xC7, 0x8F, 0x1C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F,
+  0x1E, 0x1C, 0x3C, 0x78, 0x70, 0xF0, 0xE1, 0xE0, 0xF0, 0xE1, 0xE1, 0xC3,
+  0xC7, 0x87, 0x0F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x1E, 0x3C, 0x71,
+  0xE3, 0x8F, 0x00, 0x06, 0x00, 0x60, 0x46, 0x2F, 0x6F, 0x3F, 0xC0, 0xF0,
+  0x3F, 0xCF, 0x6F, 0x46, 0x20, 0x60, 0x06, 0x00, 0x03, 0x80, 0x07, 0x00,
+  0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0,
+  0x00, 0x7B, 0xDE, 0xF7, 0xBB, 0xDC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF0,
+  0x03, 0x81, 0xC0, 0xC0, 0xE0, 0x70, 0x30, 0x38, 0x1C, 0x0C, 0x0E, 0x07,
+  0x03, 0x03, 0x81, 0xC0, 0xC0, 0xE0, 0x70, 0x30, 0x38, 0x1C, 0x00, 0x0F,
+  0xC0, 0x7F, 0x83, 0xFF, 0x1E, 0x1E, 0x78, 0x7B, 0xC0, 0xFF, 0x03, 0xFC,
+  0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3D, 0xE1, 0xE7,
+  0x87, 0x8F, 0xFC, 0x1F, 0xE0, 0x3F, 0x00, 0x3F, 0x0F, 0xF0, 0xFF, 0x0C,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x87,
+  0xFF, 0x3F, 0xFD, 0xC1, 0xF8, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00,
+  0xF8, 0x0F, 0x81, 0xF8, 0x1F, 0x81, 0xF8, 0x1F, 0x81, 0xF8, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xC3, 0xFF, 0x9F, 0xFE, 0x81, 0xF0, 0x07,
+  0x80, 0x3C, 0x03, 0xC3, 0xFC, 0x1F, 0xE0, 0xFF, 0x80, 0x3E, 0x00, 0xF0,
+  0x07, 0x80, 0x3F, 0x03, 0xFF, 0xFE, 0xFF, 0xE3, 0xFC, 0x00, 0x01, 0xF0,
+  0x07, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0xFF, 0x03, 0xDE, 0x07, 0x3C, 0x1E,
+  0x78, 0x38, 0xF0, 0xF1, 0xE3, 0xC3, 0xC7, 0x07, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x7F, 0xF3, 0xFF, 0x9F,
+  0xFC, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xFF, 0x0F, 0xFC, 0x7F, 0xF2, 0x07,
+  0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3F, 0x03, 0xFF, 0xFE, 0xFF, 0xE1,
+  0xFC, 0x00, 0x07, 0xF0, 0x7F, 0xE3, 0xFF, 0x9F, 0x02, 0x78, 0x03, 0xC0,
+  0x0F, 0x7E, 0x3F, 0xFC, 0xFF, 0xFB, 0xE1, 0xFF, 0x03, 0xFC, 0x0F, 0xF0,
+  0x3D, 0xC0, 0xF7, 0x87, 0x8F, 0xFE, 0x1F, 0xF0, 0x3F, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x01, 0xF0, 0x0F, 0x00, 0xF8, 0x07, 0x80, 0x7C, 0x03,
+  0xC0, 0x1E, 0x01, 0xF0, 0x0F, 0x00, 0xF8, 0x07, 0x80, 0x7C, 0x03, 0xC0,
+  0x1E, 0x01, 0xF0, 0x00, 0x1F, 0xE1, 0xFF, 0xEF, 0xFF, 0xFE, 0x1F, 0xF0,
+  0x3F, 0xC0, 0xFF, 0x87, 0x9F, 0xFE, 0x1F, 0xE1, 0xFF, 0xE7, 0x87, 0xBC,
+  0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x87, 0xDF, 0xFE, 0x3F, 0xF0, 0x7F, 0x80,
+  0x0F, 0xC0, 0xFF, 0x87, 0xFF, 0x1E, 0x1E, 0xF0, 0x3B, 0xC0, 0xFF, 0x03,
+  0xFC, 0x0F, 0xF8, 0x7D, 0xFF, 0xF3, 0xFF, 0xC7, 0xEF, 0x00, 0x38, 0x01,
+  0xE4, 0x0F, 0x9F, 0xFC, 0x7F, 0xE0, 0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
+  0xFF, 0xFF, 0xF0, 0x7B, 0xDE, 0xF7, 0x80, 0x00, 0x7B, 0xDE, 0xF7, 0xBB,
+  0xDC, 0x00, 0x02, 0x00, 0x3C, 0x03, 0xF8, 0x1F, 0xE1, 0xFE, 0x1F, 0xE0,
+  0x3E, 0x00, 0x7C, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x07, 0xF0,
+  0x01, 0xE0, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0x01, 0xE0,
+  0x03, 0xF8, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0x80, 0x1F,
+  0x01, 0xFE, 0x1F, 0xE1, 0xFE, 0x07, 0xF0, 0x0F, 0x00, 0x10, 0x00, 0x00,
+  0xFF, 0x1F, 0xFB, 0xFF, 0xE1, 0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x7E, 0x1F,
+  0x07, 0xC0, 0xF0, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0x01, 0xE0, 0x3C, 0x07,
+  0x80, 0x01, 0xFC, 0x00, 0x3F, 0xF8, 0x03, 0xC0, 0xF0, 0x38, 0x01, 0xC3,
+  0x80, 0x07, 0x38, 0x7B, 0x99, 0x8F, 0xFC, 0xFC, 0x71, 0xE3, 0xC7, 0x07,
+  0x1E, 0x38, 0x38, 0xF1, 0xC1, 0xC7, 0x8E, 0x0E, 0x3C, 0x70, 0x73, 0x61,
+  0xC7, 0xB9, 0x8F, 0xFF, 0x8E, 0x1E, 0xF0, 0x30, 0x00, 0x00, 0xE0, 0x04,
+  0x03, 0xC0, 0xE0, 0x0F, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
+  0xFC, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x03, 0xFF, 0x00, 0xF3,
+  0xC0, 0x3C, 0xF0, 0x1F, 0x3E, 0x07, 0x87, 0x81, 0xE1, 0xE0, 0xF8, 0x7C,
+  0x3F, 0xFF, 0x0F, 0xFF, 0xC7, 0xFF, 0xF9, 0xE0, 0x1E, 0x78, 0x07, 0xBC,
+  0x00, 0xF0, 0xFF, 0xC3, 0xFF, 0xCF, 0xFF, 0xBC, 0x3E, 0xF0, 0x7B, 0xC1,
+  0xEF, 0x0F, 0xBF, 0xFC, 0xFF, 0xF3, 0xFF, 0xEF, 0x07, 0xFC, 0x0F, 0xF0,
+  0x3F, 0xC0, 0xFF, 0x07, 0xFF, 0xFE, 0xFF, 0xFB, 0xFF, 0x80, 0x03, 0xF8,
+  0x1F, 0xFC, 0xFF, 0xF9, 0xF0, 0x77, 0xC0, 0x2F, 0x00, 0x3C, 0x00, 0x78,
+  0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x0F, 0x80,
+  0x4F, 0x83, 0x9F, 0xFF, 0x0F, 0xFE, 0x07, 0xF0, 0xFF, 0xC0, 0xFF, 0xF0,
+  0xFF, 0xFC, 0xF0, 0x7C, 0xF0, 0x3E, 0xF0, 0x1E, 0xF0, 0x0F, 0xF0, 0x0F,
+  0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x1E, 0xF0, 0x3E,
+  0xF0, 0x7C, 0xFF, 0xFC, 0xFF, 0xF0, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0xFE, 0xFF, 0xEF, 0xFE, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0x03, 0xFC, 0x07, 0xFF, 0x8F, 0xFF, 0xC7, 0xC0, 0xE7, 0xC0,
+  0x13, 0xC0, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x3F, 0xF8, 0x1F, 0xFC,
+  0x0F, 0xFE, 0x00, 0xF7, 0x80, 0x7B, 0xE0, 0x3C, 0xF8, 0x1E, 0x3F, 0xFF,
+  0x0F, 0xFF, 0x81, 0xFE, 0x00, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1F, 0xFE, 0xFC,
+  0xF0, 0xF0, 0x3F, 0x78, 0x3F, 0x3C, 0x3E, 0x1E, 0x3E, 0x0F, 0x3E, 0x07,
+  0xBE, 0x03, 0xFE, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0xE0,
+  0x1E, 0xF8, 0x0F, 0x3E, 0x07, 0x8F, 0x83, 0xC3, 0xE1, 0xE0, 0xF8, 0xF0,
+  0x3E, 0x78, 0x0F, 0xC0, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
+  0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
+  0x00, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF,
+  0xF0, 0x1F, 0xFF, 0x07, 0xFF, 0xE0, 0xFF, 0xFC, 0x1F, 0xFD, 0xC7, 0x7F,
+  0xB8, 0xEF, 0xF7, 0xBD, 0xFE, 0x77, 0x3F, 0xCE, 0xE7, 0xF8, 0xF8, 0xFF,
+  0x1F, 0x1F, 0xE3, 0xE3, 0xFC, 0x38, 0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE,
+  0x00, 0x3C, 0xF8, 0x0F, 0xFC, 0x0F, 0xFC, 0x0F, 0xFE, 0x0F, 0xFE, 0x0F,
+  0xFF, 0x0F, 0xF7, 0x0F, 0xF7, 0x8F, 0xF3, 0x8F, 0xF1, 0xCF, 0xF1, 0xCF,
+  0xF0, 0xEF, 0xF0, 0xEF, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x3F,
+  0xF0, 0x1F, 0x03, 0xF0, 0x07, 0xFF, 0x83, 0xFF, 0xF1, 0xF8, 0x7E, 0x78,
+  0x07, 0xBE, 0x01, 0xEF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00,
+  0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x07, 0x9E, 0x01, 0xE7, 0xE1, 0xF8,
+  0xFF, 0xFC, 0x1F, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0xE3, 0xFF, 0xCF, 0xFF,
+  0xBC, 0x1F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x1F, 0xFF, 0xFB, 0xFF,
+  0xCF, 0xFE, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x00, 0x03, 0xF0, 0x07, 0xFF, 0x83, 0xFF, 0xF1, 0xF8, 0x7E,
+  0x78, 0x07, 0xBE, 0x01, 0xEF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC,
+  0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x07, 0xDE, 0x01, 0xE7, 0xE1,
+  0xF8, 0xFF, 0xFC, 0x1F, 0xFE, 0x00, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0x78,
+  0x00, 0x1F, 0x00, 0x03, 0xC0, 0xFF, 0xE0, 0xFF, 0xF8, 0xFF, 0xF8, 0xF0,
+  0x7C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x78, 0xFF, 0xF8, 0xFF,
+  0xE0, 0xFF, 0xF8, 0xF0, 0xF8, 0xF0, 0x7C, 0xF0, 0x3C, 0xF0, 0x3E, 0xF0,
+  0x1E, 0xF0, 0x1E, 0xF0, 0x1F, 0x1F, 0xF0, 0xFF, 0xE7, 0xFF, 0xBE, 0x0E,
+  0xF0, 0x0B, 0xC0, 0x0F, 0x80, 0x3F, 0xE0, 0x7F, 0xF0, 0xFF, 0xE0, 0x7F,
+  0xC0, 0x1F, 0x00, 0x3E, 0x00, 0xFF, 0x07, 0xFF, 0xFE, 0xFF, 0xF0, 0xFF,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0xF0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7F, 0x80, 0xFF, 0x01, 0xFE, 0x03,
+  0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7F, 0x80, 0xFF,
+  0x01, 0xFE, 0x07, 0xDE, 0x0F, 0x3F, 0xFE, 0x3F, 0xF8, 0x1F, 0xC0, 0xF0,
+  0x03, 0xDE, 0x01, 0xE7, 0x80, 0x79, 0xE0, 0x1E, 0x3C, 0x0F, 0x0F, 0x03,
+  0xC3, 0xE1, 0xF0, 0x78, 0x78, 0x1E, 0x1E, 0x07, 0xCF, 0x80, 0xF3, 0xC0,
+  0x3C, 0xF0, 0x0F, 0xFC, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x03,
+  0xF0, 0x00, 0xFC, 0x00, 0xF0, 0x3E, 0x07, 0xF8, 0x1F, 0x03, 0xDE, 0x0F,
+  0x83, 0xCF, 0x07, 0xC1, 0xE7, 0x87, 0x70, 0xF3, 0xC3, 0xB8, 0x79, 0xF1,
+  0xDC, 0x7C, 0x78, 0xEE, 0x3C, 0x3C, 0xE3, 0x9E, 0x1E, 0x71, 0xCF, 0x0F,
+  0xB8, 0xEF, 0x83, 0xDC, 0x77, 0x81, 0xFE, 0x3F, 0xC0, 0xFE, 0x0F, 0xE0,
+  0x7F, 0x07, 0xF0, 0x1F, 0x83, 0xF0, 0x0F, 0xC1, 0xF8, 0x07, 0xC0, 0x7C,
+  0x00, 0xF8, 0x07, 0xDF, 0x03, 0xE3, 0xE1, 0xF0, 0xF8, 0x7C, 0x1F, 0x3E,
+  0x03, 0xFF, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x03, 0xF0, 0x00, 0xFC, 0x00,
+  0x7F, 0x80, 0x3F, 0xF0, 0x0F, 0x3C, 0x07, 0xCF, 0x83, 0xE1, 0xF0, 0xF0,
+  0x3C, 0x7C, 0x0F, 0xBE, 0x01, 0xF0, 0xF8, 0x07, 0xDF, 0x03, 0xE3, 0xC1,
+  0xF0, 0xF8, 0x7C, 0x1F, 0x3E, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x1F, 0xE0,
+  0x03, 0xF0, 0x00, 0xFC, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00,
+  0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C,
+  0x01, 0xF0, 0x07, 0xC0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F,
+  0x80, 0x3F, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+  0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1,
+  0xE3, 0xFF, 0xFF, 0xE0, 0xE0, 0x70, 0x18, 0x0E, 0x07, 0x01, 0x80, 0xE0,
+  0x70, 0x18, 0x0E, 0x07, 0x01, 0x80, 0xE0, 0x70, 0x18, 0x0E, 0x07, 0x01,
+  0x80, 0xE0, 0x70, 0xFF, 0xFF, 0xF8, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C,
+  0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3F, 0xFF, 0xFF, 0xE0, 0x03, 0x80,
+  0x0F, 0x80, 0x3F, 0x80, 0xF7, 0x83, 0xC7, 0x8F, 0x07, 0xB8, 0x03, 0x80,
+  0xFF, 0xFF, 0xFF, 0x70, 0x70, 0x70, 0x70, 0x1F, 0xC3, 0xFF, 0x9F, 0xFC,
+  0x81, 0xF0, 0x07, 0x8F, 0xFD, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0x87, 0xFF,
+  0xFE, 0xFF, 0xF3, 0xE7, 0x80, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xCF, 0x8F, 0xFF, 0x3F, 0xFE, 0xF8, 0x7B, 0xC0, 0xFF, 0x03,
+  0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x87, 0xBF, 0xFE, 0xFF, 0xF3, 0xCF,
+  0x80, 0x0F, 0xE3, 0xFF, 0x7F, 0xF7, 0xC1, 0xF8, 0x0F, 0x00, 0xF0, 0x0F,
+  0x00, 0xF8, 0x07, 0xC1, 0x7F, 0xF3, 0xFF, 0x0F, 0xE0, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x7C, 0xF3, 0xFF, 0xDF, 0xFF, 0x78,
+  0x7F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xF7, 0x87, 0xDF,
+  0xFF, 0x3F, 0xFC, 0x7C, 0xF0, 0x0F, 0xC0, 0xFF, 0xC7, 0xFF, 0x9E, 0x1E,
+  0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xE0, 0x67, 0xFF,
+  0x8F, 0xFE, 0x0F, 0xE0, 0x0F, 0xC7, 0xF3, 0xFC, 0xF0, 0x3C, 0x3F, 0xFF,
+  0xFF, 0xFF, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x00, 0x1F, 0x3C, 0xFF, 0xF7, 0xFF, 0xDE, 0x1F, 0xF0, 0x3F,
+  0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3D, 0xE1, 0xF7, 0xFF, 0xCF, 0xFF,
+  0x1F, 0x3C, 0x00, 0xF2, 0x07, 0xCF, 0xFE, 0x3F, 0xF0, 0x7F, 0x00, 0xF0,
+  0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x79, 0xF3, 0xFF, 0xDF, 0xFF,
+  0xF8, 0xFF, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE,
+  0x0F, 0xF0, 0x7F, 0x83, 0xC0, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x1E, 0x3C, 0x78, 0xF0, 0x03, 0xC7, 0x8F, 0x1E, 0x3C, 0x78,
+  0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x79, 0xFF, 0xDF, 0xBE, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC3, 0xEF, 0x1F, 0x3C,
+  0xF8, 0xF7, 0xC3, 0xFE, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x83, 0xDF, 0x0F,
+  0x3E, 0x3C, 0x7C, 0xF0, 0xFB, 0xC1, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xC3, 0xCF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF,
+  0x8F, 0x8F, 0xF0, 0xF0, 0xFF, 0x0F, 0x0F, 0xF0, 0xF0, 0xFF, 0x0F, 0x0F,
+  0xF0, 0xF0, 0xFF, 0x0F, 0x0F, 0xF0, 0xF0, 0xFF, 0x0F, 0x0F, 0xF0, 0xF0,
+  0xF0, 0xF3, 0xE7, 0xFF, 0xBF, 0xFF, 0xF1, 0xFF, 0x07, 0xF8, 0x3F, 0xC1,
+  0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0x80, 0x0F,
+  0xC0, 0xFF, 0xC7, 0xFF, 0x9E, 0x1E, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC,
+  0x0F, 0xF0, 0x3D, 0xE1, 0xE7, 0xFF, 0x8F, 0xFC, 0x0F, 0xC0, 0xF3, 0xE3,
+  0xFF, 0xCF, 0xFF, 0xBE, 0x1E, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F,
+  0xF0, 0x3F, 0xE1, 0xEF, 0xFF, 0xBF, 0xFC, 0xF3, 0xE3, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x1F, 0x3C, 0xFF, 0xF7, 0xFF, 0xDE,
+  0x1F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3D, 0xE1, 0xF7,
+  0xFF, 0xCF, 0xFF, 0x1F, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0xF3, 0xFF, 0xFF, 0xFF, 0xF1, 0xF8, 0x3C, 0x0F, 0x03, 0xC0,
+  0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x00, 0x3F, 0x87, 0xFE, 0xFF, 0xEF,
+  0x06, 0xF8, 0x0F, 0xFC, 0x7F, 0xE0, 0xFF, 0x00, 0xFC, 0x0F, 0xFF, 0xFF,
+  0xFE, 0x3F, 0x80, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xFC, 0x7F, 0x0F,
+  0xC0, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1,
+  0xFE, 0x0F, 0xF0, 0x7F, 0xC7, 0xFF, 0xFE, 0xFF, 0xF3, 0xE7, 0x80, 0xF0,
+  0x1E, 0xF0, 0x79, 0xE0, 0xF3, 0xC1, 0xE3, 0xC7, 0x87, 0x8F, 0x07, 0x1C,
+  0x0F, 0x78, 0x1E, 0xF0, 0x1D, 0xC0, 0x3F, 0x80, 0x3E, 0x00, 0x7C, 0x00,
+  0xF0, 0x70, 0x7F, 0xC7, 0xC7, 0xDE, 0x3E, 0x3C, 0xF1, 0xF1, 0xE7, 0x8F,
+  0x8F, 0x3E, 0xEE, 0xF8, 0xF7, 0x77, 0x87, 0xBB, 0xBC, 0x3D, 0xDD, 0xE0,
+  0xFC, 0x7E, 0x07, 0xE3, 0xF0, 0x3F, 0x1F, 0x81, 0xF8, 0xFC, 0x00, 0xF8,
+  0x3E, 0xF8, 0xF8, 0xFB, 0xE0, 0xF7, 0x80, 0xFE, 0x01, 0xFC, 0x01, 0xF0,
+  0x07, 0xF0, 0x0F, 0xE0, 0x3D, 0xE0, 0xF1, 0xE3, 0xE3, 0xEF, 0x83, 0xE0,
+  0xF8, 0x3E, 0xF0, 0x79, 0xE0, 0xF1, 0xE3, 0xE3, 0xC7, 0x87, 0xDF, 0x07,
+  0xBC, 0x0F, 0xF8, 0x0F, 0xF0, 0x1F, 0xC0, 0x1F, 0x80, 0x3E, 0x00, 0x7C,
+  0x00, 0xF8, 0x01, 0xE0, 0x1F, 0xC0, 0x3F, 0x00, 0x7C, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x3E, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x07,
+  0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xE0, 0xFC, 0x3F, 0x87, 0x80,
+  0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x03, 0xE3, 0xF8, 0x7E, 0x0F, 0xE0,
+  0x3E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0xF0, 0x7E, 0x07,
+  0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F,
+  0x83, 0xF8, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xE0,
+  0x3F, 0x83, 0xF0, 0xFE, 0x3E, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78,
+  0x7F, 0x0F, 0xC1, 0xF0, 0x00, 0x3E, 0x02, 0xFF, 0x0F, 0xFF, 0xFE, 0x1F,
+  0xE0, 0x0F, 0x80 };
+
+const GFXglyph DejaVuSans_Bold12pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
+  {     1,   4,  18,  11,    3,  -17 },   // 0x21 '!'
+  {    10,   8,   7,  13,    2,  -17 },   // 0x22 '"'
+  {    17,  17,  18,  20,    2,  -17 },   // 0x23 '#'
+  {    56,  14,  23,  17,    1,  -18 },   // 0x24 '$'
+  {    97,  23,  18,  24,    1,  -17 },   // 0x25 '%'
+  {   149,  18,  18,  21,    1,  -17 },   // 0x26 '&'
+  {   190,   3,   7,   7,    2,  -17 },   // 0x27 '''
+  {   193,   7,  21,  11,    2,  -17 },   // 0x28 '('
+  {   212,   7,  21,  11,    2,  -17 },   // 0x29 ')'
+  {   231,  12,  11,  13,    0,  -17 },   // 0x2A '*'
+  {   248,  15,  15,  20,    3,  -14 },   // 0x2B '+'
+  {   277,   5,   8,   9,    1,   -4 },   // 0x2C ','
+  {   282,   7,   3,  10,    1,   -8 },   // 0x2D '-'
+  {   285,   4,   5,   9,    2,   -4 },   // 0x2E '.'
+  {   288,   9,  20,   9,    0,  -17 },   // 0x2F '/'
+  {   311,  14,  18,  17,    1,  -17 },   // 0x30 '0'
+  {   343,  12,  18,  17,    3,  -17 },   // 0x31 '1'
+  {   370,  13,  18,  17,    2,  -17 },   // 0x32 '2'
+  {   400,  13,  18,  17,    1,  -17 },   // 0x33 '3'
+  {   430,  15,  18,  17,    1,  -17 },   // 0x34 '4'
+  {   464,  13,  18,  17,    2,  -17 },   // 0x35 '5'
+  {   494,  14,  18,  17,    1,  -17 },   // 0x36 '6'
+  {   526,  13,  18,  17,    2,  -17 },   // 0x37 '7'
+  {   556,  14,  18,  17,    1,  -17 },   // 0x38 '8'
+  {   588,  14,  18,  17,    1,  -17 },   // 0x39 '9'
+  {   620,   4,  13,  10,    3,  -12 },   // 0x3A ':'
+  {   627,   5,  16,  10,    2,  -12 },   // 0x3B ';'
+  {   637,  15,  14,  20,    3,  -13 },   // 0x3C '<'
+  {   664,  15,   9,  20,    3,  -11 },   // 0x3D '='
+  {   681,  15,  14,  20,    3,  -13 },   // 0x3E '>'
+  {   708,  11,  18,  14,    2,  -17 },   // 0x3F '?'
+  {   733,  21,  21,  24,    2,  -17 },   // 0x40 '@'
+  {   789,  18,  18,  19,    0,  -17 },   // 0x41 'A'
+  {   830,  14,  18,  18,    2,  -17 },   // 0x42 'B'
+  {   862,  15,  18,  18,    1,  -17 },   // 0x43 'C'
+  {   896,  16,  18,  20,    2,  -17 },   // 0x44 'D'
+  {   932,  12,  18,  16,    2,  -17 },   // 0x45 'E'
+  {   959,  12,  18,  16,    2,  -17 },   // 0x46 'F'
+  {   986,  17,  18,  20,    1,  -17 },   // 0x47 'G'
+  {  1025,  16,  18,  20,    2,  -17 },   // 0x48 'H'
+  {  1061,   4,  18,   9,    2,  -17 },   // 0x49 'I'
+  {  1070,   8,  23,   9,   -2,  -17 },   // 0x4A 'J'
+  {  1093,  17,  18,  19,    2,  -17 },   // 0x4B 'K'
+  {  1132,  12,  18,  15,    2,  -17 },   // 0x4C 'L'
+  {  1159,  19,  18,  24,    2,  -17 },   // 0x4D 'M'
+  {  1202,  16,  18,  20,    2,  -17 },   // 0x4E 'N'
+  {  1238,  18,  18,  20,    1,  -17 },   // 0x4F 'O'
+  {  1279,  14,  18,  18,    2,  -17 },   // 0x50 'P'
+  {  1311,  18,  22,  20,    1,  -17 },   // 0x51 'Q'
+  {  1361,  16,  18,  18,    2,  -17 },   // 0x52 'R'
+  {  1397,  14,  18,  17,    2,  -17 },   // 0x53 'S'
+  {  1429,  16,  18,  16,    0,  -17 },   // 0x54 'T'
+  {  1465,  15,  18,  19,    2,  -17 },   // 0x55 'U'
+  {  1499,  18,  18,  19,    0,  -17 },   // 0x56 'V'
+  {  1540,  25,  18,  26,    1,  -17 },   // 0x57 'W'
+  {  1597,  18,  18,  19,    0,  -17 },   // 0x58 'X'
+  {  1638,  18,  18,  17,   -1,  -17 },   // 0x59 'Y'
+  {  1679,  15,  18,  17,    1,  -17 },   // 0x5A 'Z'
+  {  1713,   7,  21,  11,    2,  -17 },   // 0x5B '['
+  {  1732,   9,  20,   9,    0,  -17 },   // 0x5C '\'
+  {  1755,   7,  21,  11,    2,  -17 },   // 0x5D ']'
+  {  1774,  15,   7,  20,    2,  -17 },   // 0x5E '^'
+  {  1788,  12,   2,  12,    0,    5 },   // 0x5F '_'
+  {  1791,   7,   4,  12,    1,  -18 },   // 0x60 '`'
+  {  1795,  13,  13,  16,    1,  -12 },   // 0x61 'a'
+  {  1817,  14,  18,  17,    2,  -17 },   // 0x62 'b'
+  {  1849,  12,  13,  14,    1,  -12 },   // 0x63 'c'
+  {  1869,  14,  18,  17,    1,  -17 },   // 0x64 'd'
+  {  1901,  14,  13,  16,    1,  -12 },   // 0x65 'e'
+  {  1924,  10,  18,  10,    1,  -17 },   // 0x66 'f'
+  {  1947,  14,  18,  17,    1,  -12 },   // 0x67 'g'
+  {  1979,  13,  18,  17,    2,  -17 },   // 0x68 'h'
+  {  2009,   4,  18,   8,    2,  -17 },   // 0x69 'i'
+  {  2018,   7,  23,   8,   -1,  -17 },   // 0x6A 'j'
+  {  2039,  14,  18,  16,    2,  -17 },   // 0x6B 'k'
+  {  2071,   4,  18,   8,    2,  -17 },   // 0x6C 'l'
+  {  2080,  20,  13,  25,    2,  -12 },   // 0x6D 'm'
+  {  2113,  13,  13,  17,    2,  -12 },   // 0x6E 'n'
+  {  2135,  14,  13,  16,    1,  -12 },   // 0x6F 'o'
+  {  2158,  14,  18,  17,    2,  -12 },   // 0x70 'p'
+  {  2190,  14,  18,  17,    1,  -12 },   // 0x71 'q'
+  {  2222,  10,  13,  12,    2,  -12 },   // 0x72 'r'
+  {  2239,  12,  13,  14,    1,  -12 },   // 0x73 's'
+  {  2259,  10,  17,  11,    0,  -16 },   // 0x74 't'
+  {  2281,  13,  13,  17,    2,  -12 },   // 0x75 'u'
+  {  2303,  15,  13,  16,    0,  -12 },   // 0x76 'v'
+  {  2328,  21,  13,  22,    1,  -12 },   // 0x77 'w'
+  {  2363,  15,  13,  15,    0,  -12 },   // 0x78 'x'
+  {  2388,  15,  18,  16,    0,  -12 },   // 0x79 'y'
+  {  2422,  12,  13,  14,    1,  -12 },   // 0x7A 'z'
+  {  2442,  11,  22,  17,    3,  -17 },   // 0x7B '{'
+  {  2473,   3,  24,   9,    3,  -17 },   // 0x7C '|'
+  {  2482,  11,  22,  17,    3,  -17 },   // 0x7D '}'
+  {  2513,  15,   5,  20,    3,   -9 } }; // 0x7E '~'
+
+const GFXfont DejaVuSans_Bold12pt7b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Bold12pt7bBitmaps,
+  (GFXglyph *)DejaVuSans_Bold12pt7bGlyphs,
+  0x20, 0x7E, 27 };
+
+// Approx. 3195 bytes
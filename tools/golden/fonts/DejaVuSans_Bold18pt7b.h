@@ -0,0 +1,552 @@
+// DejaVuSans-Bold.ttf at 18pt, converted with Adafruit GFX fontconvert (7-bit, 141 dpi).
+// Fixed font for tools/golden_check.cpp; DejaVu fonts license in LICENSE.
+#pragma once
+#include <Adafruit_GFX.h>
+
+const uint8_t DejaVuSans_Bold18pt7bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xDE, 0x79, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF1, 0xFE, 0x3F,
+  0xC7, 0xF8, 0xFF, 0x1F, 0xE3, 0xFC, 0x7F, 0x8F, 0xF1, 0xE0, 0x00, 0x78,
+  0x3C, 0x00, 0x3C, 0x1E, 0x00, 0x1E, 0x1E, 0x00, 0x0F, 0x0F, 0x00, 0x0F,
+  0x07, 0x80, 0x07, 0x83, 0xC0, 0x03, 0xC3, 0xC0, 0x7F, 0xFF, 0xFF, 0x3F,
+  0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xE0, 0x3C, 0x3C, 0x00,
+  0x1C, 0x1E, 0x00, 0x1E, 0x0F, 0x00, 0x0F, 0x07, 0x00, 0x07, 0x87, 0x80,
+  0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+  0xC0, 0x78, 0x78, 0x00, 0x78, 0x3C, 0x00, 0x3C, 0x1C, 0x00, 0x1E, 0x1E,
+  0x00, 0x0E, 0x0F, 0x00, 0x0F, 0x07, 0x80, 0x00, 0x00, 0xE0, 0x00, 0x1C,
+  0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x7F, 0x80, 0x3F, 0xFE, 0x0F, 0xFF,
+  0xE3, 0xFF, 0xFC, 0xFC, 0xE3, 0x9F, 0x1C, 0x13, 0xE3, 0x80, 0x7C, 0x70,
+  0x0F, 0xCE, 0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0xC1, 0xFF, 0xFC, 0x1F, 0xFF,
+  0xC0, 0x7F, 0xFC, 0x03, 0xBF, 0x80, 0x71, 0xF0, 0x0E, 0x3F, 0x01, 0xC7,
+  0xFC, 0x39, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xCF, 0xFF, 0xE0, 0x3F, 0xF0,
+  0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00,
+  0x0F, 0xC0, 0x03, 0xC0, 0x1F, 0xF8, 0x01, 0xC0, 0x1F, 0xFE, 0x01, 0xE0,
+  0x0F, 0x0F, 0x01, 0xE0, 0x0F, 0x87, 0xC0, 0xE0, 0x07, 0x81, 0xE0, 0xF0,
+  0x03, 0xC0, 0xF0, 0x70, 0x01, 0xE0, 0x78, 0x78, 0x00, 0xF0, 0x3C, 0x78,
+  0x00, 0x7C, 0x3E, 0x38, 0x00, 0x1E, 0x1E, 0x3C, 0x00, 0x0F, 0xFF, 0x1C,
+  0x00, 0x03, 0xFF, 0x1E, 0x1F, 0x80, 0x7E, 0x1E, 0x3F, 0xF0, 0x00, 0x0E,
+  0x3F, 0xFC, 0x00, 0x0F, 0x1E, 0x1E, 0x00, 0x07, 0x1F, 0x0F, 0x80, 0x07,
+  0x8F, 0x03, 0xC0, 0x07, 0x87, 0x81, 0xE0, 0x03, 0x83, 0xC0, 0xF0, 0x03,
+  0xC1, 0xE0, 0x78, 0x01, 0xC0, 0xF8, 0x7C, 0x01, 0xE0, 0x3C, 0x3C, 0x01,
+  0xE0, 0x1F, 0xFE, 0x00, 0xE0, 0x07, 0xFE, 0x00, 0xF0, 0x00, 0xFC, 0x00,
+  0x00, 0x7F, 0x80, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xFF,
+  0xF0, 0x00, 0xFE, 0x0E, 0x00, 0x1F, 0x80, 0x40, 0x03, 0xF0, 0x00, 0x00,
+  0x7E, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xE0,
+  0x00, 0x0F, 0xFE, 0x03, 0xE3, 0xFF, 0xE0, 0x7C, 0xFE, 0xFE, 0x0F, 0x9F,
+  0x8F, 0xE3, 0xE7, 0xE0, 0xFE, 0x7C, 0xFC, 0x0F, 0xFF, 0x9F, 0x80, 0xFF,
+  0xE3, 0xF0, 0x0F, 0xFC, 0x7F, 0x00, 0xFF, 0x0F, 0xE0, 0x1F, 0xC0, 0xFF,
+  0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xDF,
+  0xC0, 0x7F, 0xC1, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xC3, 0xE0,
+  0xF8, 0x7C, 0x1F, 0x0F, 0xC3, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xC3, 0xF0,
+  0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0x7C, 0x1F,
+  0x87, 0xE1, 0xF8, 0x3E, 0x0F, 0xC1, 0xF0, 0x7C, 0x0F, 0x83, 0xE0, 0x7C,
+  0xF8, 0x1F, 0x07, 0xC0, 0xF8, 0x3E, 0x0F, 0xC1, 0xF0, 0x7E, 0x1F, 0x87,
+  0xE0, 0xF8, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC,
+  0x3F, 0x0F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x0F, 0xC3, 0xE0, 0xF8, 0x7C,
+  0x1F, 0x0F, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x08, 0x38, 0x2F,
+  0x1C, 0x7B, 0xEE, 0xF8, 0x7F, 0xF0, 0x0F, 0xE0, 0x07, 0xF0, 0x0F, 0xFE,
+  0x1F, 0x77, 0xFE, 0x38, 0xF4, 0x1C, 0x10, 0x0E, 0x00, 0x07, 0x00, 0x03,
+  0x80, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00,
+  0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00,
+  0x78, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00,
+  0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x01,
+  0xE0, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3E, 0x7E, 0x7C, 0x7C,
+  0xF8, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x00, 0x78, 0x03, 0xC0, 0x3C, 0x01, 0xE0, 0x0F, 0x00,
+  0xF0, 0x07, 0x80, 0x3C, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x0F, 0x00, 0x78,
+  0x03, 0xC0, 0x1C, 0x01, 0xE0, 0x0F, 0x00, 0x70, 0x07, 0x80, 0x3C, 0x01,
+  0xE0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x78, 0x03, 0xC0, 0x1E, 0x01, 0xE0,
+  0x0F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0xE0, 0x3F,
+  0xFF, 0x83, 0xF0, 0x7E, 0x3F, 0x01, 0xF9, 0xF8, 0x0F, 0xCF, 0x80, 0x7E,
+  0xFC, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xC0,
+  0x1F, 0xFE, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x3F, 0xFC, 0x01, 0xFF,
+  0xE0, 0x0F, 0xDF, 0x80, 0xFC, 0xFC, 0x07, 0xE7, 0xE0, 0x3F, 0x1F, 0x83,
+  0xF0, 0x7F, 0xFF, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0x00, 0x0F, 0xE0, 0x00,
+  0x1F, 0xF0, 0x3F, 0xFC, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x38,
+  0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
+  0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
+  0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07,
+  0xF8, 0x0F, 0xFF, 0xE3, 0xFF, 0xFE, 0x7F, 0xFF, 0xEF, 0xC1, 0xFD, 0xC0,
+  0x1F, 0xF0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00,
+  0x1F, 0x80, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x0F,
+  0xFC, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE,
+  0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x7F, 0xF8, 0x0F, 0xFF, 0xC1, 0xFF, 0xFE, 0x3F, 0xFF, 0xC6, 0x03,
+  0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x03,
+  0xF0, 0x00, 0xFE, 0x07, 0xFF, 0x80, 0xFF, 0xC0, 0x1F, 0xFF, 0x03, 0xFF,
+  0xF0, 0x01, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03,
+  0xF8, 0x00, 0xFF, 0xE0, 0x3F, 0xBF, 0xFF, 0xF7, 0xFF, 0xFC, 0xFF, 0xFF,
+  0x07, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00,
+  0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x3E, 0xFC, 0x00, 0xF3,
+  0xF0, 0x07, 0xCF, 0xC0, 0x3E, 0x3F, 0x00, 0xF0, 0xFC, 0x07, 0xC3, 0xF0,
+  0x3E, 0x0F, 0xC0, 0xF0, 0x3F, 0x07, 0xC0, 0xFC, 0x3E, 0x03, 0xF0, 0xF0,
+  0x0F, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
+  0x00, 0x3F, 0x00, 0x7F, 0xFF, 0x8F, 0xFF, 0xF1, 0xFF, 0xFE, 0x3F, 0xFF,
+  0xC7, 0xFF, 0xF8, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7F, 0xF8,
+  0x0F, 0xFF, 0xC1, 0xFF, 0xFE, 0x3F, 0xFF, 0xC7, 0x83, 0xFC, 0x80, 0x1F,
+  0x80, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F,
+  0x80, 0x07, 0xF8, 0x00, 0xFD, 0xE0, 0x7F, 0xBF, 0xFF, 0xE7, 0xFF, 0xF8,
+  0xFF, 0xFE, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xFC, 0x0F, 0xFF,
+  0xC1, 0xFF, 0xFC, 0x3F, 0xC1, 0xC3, 0xF0, 0x04, 0x7E, 0x00, 0x07, 0xE0,
+  0x00, 0x7C, 0x00, 0x0F, 0xCF, 0xE0, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF,
+  0xFF, 0xEF, 0xF8, 0xFE, 0xFF, 0x07, 0xFF, 0xE0, 0x3F, 0xFE, 0x03, 0xFF,
+  0xE0, 0x3F, 0x7E, 0x03, 0xF7, 0xE0, 0x3F, 0x7F, 0x07, 0xE3, 0xF8, 0xFE,
+  0x1F, 0xFF, 0xC1, 0xFF, 0xF8, 0x07, 0xFF, 0x00, 0x1F, 0xC0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F,
+  0x80, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xE0, 0x01, 0xFC,
+  0x00, 0x3F, 0x80, 0x07, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xE0,
+  0x01, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0x7F, 0x00,
+  0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00,
+  0x03, 0xFC, 0x00, 0xFF, 0xF0, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x7F, 0x0F,
+  0xE7, 0xE0, 0x7E, 0x7E, 0x07, 0xE7, 0xE0, 0x7E, 0x7E, 0x07, 0xE7, 0xE0,
+  0x7E, 0x3F, 0x0F, 0xC1, 0xFF, 0xF8, 0x0F, 0xFF, 0x01, 0xFF, 0xF8, 0x3F,
+  0xFF, 0xC7, 0xF0, 0xFE, 0xFE, 0x07, 0xFF, 0xC0, 0x3F, 0xFC, 0x03, 0xFF,
+  0xC0, 0x3F, 0xFE, 0x07, 0xFF, 0xF0, 0xFF, 0x7F, 0xFF, 0xE3, 0xFF, 0xFC,
+  0x1F, 0xFF, 0x80, 0x7F, 0xE0, 0x03, 0xF8, 0x00, 0xFF, 0xE0, 0x1F, 0xFF,
+  0x83, 0xFF, 0xF8, 0x7F, 0x1F, 0xC7, 0xE0, 0xFE, 0xFC, 0x07, 0xEF, 0xC0,
+  0x7E, 0xFC, 0x07, 0xFF, 0xC0, 0x7F, 0xFC, 0x07, 0xFF, 0xE0, 0xFF, 0x7F,
+  0x1F, 0xF7, 0xFF, 0xFF, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0x07, 0xF3, 0xF0,
+  0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0xC3, 0x03, 0xFC,
+  0x3F, 0xFF, 0x83, 0xFF, 0xF0, 0x3F, 0xFE, 0x03, 0xFF, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3E, 0x7E, 0x7C, 0x7C, 0xF8,
+  0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0xC0, 0x03, 0xFF,
+  0x00, 0x3F, 0xF8, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x1F, 0xFE, 0x00, 0xFF,
+  0xC0, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF8,
+  0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFC,
+  0x00, 0x07, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xE0,
+  0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFC,
+  0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0,
+  0x03, 0xFF, 0x00, 0x7F, 0xF8, 0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x1F, 0xFC,
+  0x00, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0x0F, 0x00, 0x00, 0x20, 0x00, 0x00,
+  0x3F, 0xE0, 0xFF, 0xF8, 0xFF, 0xFE, 0xFF, 0xFE, 0xF0, 0x7F, 0x80, 0x3F,
+  0x00, 0x3F, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0xFE, 0x01, 0xFC,
+  0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0,
+  0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0x00,
+  0x1F, 0xFF, 0xF0, 0x00, 0xFC, 0x07, 0xE0, 0x0F, 0x80, 0x03, 0xC0, 0x3C,
+  0x00, 0x07, 0x81, 0xE0, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x1E, 0x38, 0x0F,
+  0x3C, 0x39, 0xC0, 0xFE, 0xF0, 0xE7, 0x07, 0xFF, 0xC1, 0xFC, 0x1E, 0x3F,
+  0x07, 0xE0, 0xF8, 0x7C, 0x1F, 0x83, 0xC0, 0xF0, 0x7E, 0x0F, 0x03, 0xC1,
+  0xF8, 0x3C, 0x0F, 0x07, 0xE0, 0xF0, 0x3C, 0x3F, 0x83, 0xC0, 0xF0, 0xEE,
+  0x0F, 0x87, 0xC7, 0xBC, 0x1E, 0x3F, 0x3C, 0x70, 0x7F, 0xFF, 0xE1, 0xC0,
+  0xFE, 0xFF, 0x03, 0x80, 0xF3, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x00, 0x7C, 0x00, 0x08, 0x00, 0xF8, 0x00, 0x70, 0x01, 0xFC, 0x0F,
+  0xE0, 0x01, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFE, 0x00,
+  0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x00,
+  0x7F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xFC,
+  0x00, 0x0F, 0xDF, 0x80, 0x03, 0xFB, 0xF8, 0x00, 0x7E, 0x3F, 0x00, 0x0F,
+  0xC7, 0xE0, 0x03, 0xF8, 0xFE, 0x00, 0x7E, 0x0F, 0xC0, 0x0F, 0xC1, 0xF8,
+  0x03, 0xF8, 0x3F, 0x80, 0x7E, 0x03, 0xF0, 0x1F, 0xC0, 0x7F, 0x03, 0xFF,
+  0xFF, 0xE0, 0x7F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8,
+  0x7F, 0xFF, 0xFF, 0x1F, 0xC0, 0x07, 0xF3, 0xF0, 0x00, 0x7E, 0x7E, 0x00,
+  0x0F, 0xDF, 0xC0, 0x01, 0xFC, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x3F, 0xFF,
+  0xF1, 0xFF, 0xFF, 0xCF, 0xC0, 0xFF, 0x7E, 0x01, 0xFB, 0xF0, 0x0F, 0xDF,
+  0x80, 0x7E, 0xFC, 0x03, 0xF7, 0xE0, 0x1F, 0xBF, 0x01, 0xF9, 0xFF, 0xFF,
+  0xCF, 0xFF, 0xF8, 0x7F, 0xFF, 0xE3, 0xFF, 0xFF, 0xDF, 0x80, 0xFE, 0xFC,
+  0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xC0, 0x3F,
+  0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFC, 0xFF, 0xFF, 0xC7, 0xFF,
+  0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xFF, 0xE0, 0x7F, 0xFF, 0xC3, 0xFF,
+  0xFF, 0x1F, 0xFF, 0xFC, 0xFF, 0x80, 0xF7, 0xF8, 0x00, 0x5F, 0xC0, 0x00,
+  0x7E, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
+  0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFE, 0x00,
+  0x01, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xE0, 0x01, 0x3F, 0xE0, 0x3C,
+  0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x01, 0xFF, 0xF8, 0x01,
+  0xFF, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xE0, 0xFF,
+  0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0xFC, 0x07, 0xFC, 0xFC, 0x01, 0xFE, 0xFC,
+  0x00, 0xFE, 0xFC, 0x00, 0x7E, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xFC,
+  0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC,
+  0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x7E, 0xFC, 0x00, 0xFE, 0xFC,
+  0x01, 0xFC, 0xFC, 0x07, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xE0, 0xFF, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xC0, 0x03,
+  0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFE, 0xFF,
+  0xFF, 0xBF, 0xFF, 0xEF, 0xFF, 0xFB, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00,
+  0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
+  0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFE, 0xFF, 0xFF,
+  0xBF, 0xFF, 0xEF, 0xFF, 0xFB, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
+  0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
+  0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0xFC,
+  0x07, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x3F, 0xE0, 0x1E,
+  0x7F, 0x80, 0x02, 0x7F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFE, 0x00, 0x00,
+  0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x03, 0xFF, 0xFC, 0x03, 0xFF,
+  0xFC, 0x03, 0xFF, 0xFC, 0x03, 0xFF, 0xFE, 0x00, 0x3F, 0x7E, 0x00, 0x3F,
+  0x7F, 0x00, 0x3F, 0x7F, 0x80, 0x3F, 0x3F, 0xE0, 0x3F, 0x1F, 0xFF, 0xFF,
+  0x0F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xC0,
+  0xFC, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x03, 0xFF,
+  0xC0, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFC,
+  0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFC, 0x00,
+  0x7F, 0xF8, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x07,
+  0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x7F,
+  0xF8, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07,
+  0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0,
+  0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC,
+  0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x3F,
+  0x8F, 0xEF, 0xFD, 0xFF, 0x3F, 0xE7, 0xF0, 0xF8, 0x00, 0xFC, 0x01, 0xFE,
+  0x7E, 0x01, 0xFE, 0x3F, 0x01, 0xFE, 0x1F, 0x81, 0xFE, 0x0F, 0xC1, 0xFE,
+  0x07, 0xE1, 0xFE, 0x03, 0xF1, 0xFE, 0x01, 0xF9, 0xFE, 0x00, 0xFD, 0xFE,
+  0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xFE,
+  0x00, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0xFD,
+  0xFE, 0x00, 0x7E, 0x7F, 0x80, 0x3F, 0x1F, 0xE0, 0x1F, 0x87, 0xF8, 0x0F,
+  0xC1, 0xFE, 0x07, 0xE0, 0x7F, 0x83, 0xF0, 0x1F, 0xE1, 0xF8, 0x07, 0xF8,
+  0xFC, 0x01, 0xFE, 0x7E, 0x00, 0x7F, 0xC0, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
+  0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
+  0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00,
+  0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
+  0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
+  0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
+  0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x07, 0xFF, 0xFD, 0xE0,
+  0x7B, 0xFF, 0xDE, 0x07, 0xBF, 0xFD, 0xF0, 0xFB, 0xFF, 0xCF, 0x0F, 0x3F,
+  0xFC, 0xF9, 0xF3, 0xFF, 0xC7, 0x9E, 0x3F, 0xFC, 0x7B, 0xE3, 0xFF, 0xC3,
+  0xFC, 0x3F, 0xFC, 0x3F, 0xC3, 0xFF, 0xC3, 0xFC, 0x3F, 0xFC, 0x1F, 0x83,
+  0xFF, 0xC1, 0xF8, 0x3F, 0xFC, 0x0F, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFC,
+  0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00,
+  0x3F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xFC, 0x03,
+  0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF0, 0x3F,
+  0xFD, 0xE0, 0x7F, 0xFB, 0xE0, 0xFF, 0xF3, 0xC1, 0xFF, 0xE7, 0xC3, 0xFF,
+  0xC7, 0x87, 0xFF, 0x8F, 0x8F, 0xFF, 0x0F, 0x1F, 0xFE, 0x1F, 0x3F, 0xFC,
+  0x1E, 0x7F, 0xF8, 0x3E, 0xFF, 0xF0, 0x3D, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0,
+  0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x01,
+  0xFF, 0xF8, 0x01, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x7F,
+  0xFF, 0x80, 0x7F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFE, 0x0F, 0xF0, 0x3F, 0xC7,
+  0xF0, 0x03, 0xF9, 0xFC, 0x00, 0xFE, 0x7E, 0x00, 0x1F, 0xBF, 0x80, 0x07,
+  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
+  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xDF,
+  0x80, 0x07, 0xE7, 0xF0, 0x03, 0xF9, 0xFC, 0x00, 0xFE, 0x3F, 0xC0, 0xFF,
+  0x07, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x03, 0xFF,
+  0xF0, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x3F, 0xFF,
+  0xF9, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x7E, 0x03, 0xFF, 0xF0, 0x0F, 0xFF,
+  0x80, 0x3F, 0xFC, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0xFF, 0xF8, 0x0F,
+  0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFB, 0xFF, 0xFF, 0x9F, 0xFF, 0xF8, 0xFF,
+  0xFE, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00,
+  0x7E, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0,
+  0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xC0,
+  0x7F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0x0F, 0xF0, 0x3F, 0xC7, 0xF0, 0x03,
+  0xF9, 0xFC, 0x00, 0xFE, 0x7E, 0x00, 0x1F, 0xBF, 0x80, 0x07, 0xFF, 0xC0,
+  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
+  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xDF, 0x80, 0x07,
+  0xE7, 0xE0, 0x03, 0xF9, 0xFC, 0x00, 0xFE, 0x3F, 0xC0, 0xFF, 0x0F, 0xFF,
+  0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00,
+  0x1F, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC,
+  0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xF0, 0xFF, 0xFE, 0x01, 0xFF, 0xFF,
+  0x03, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0x80, 0xFE,
+  0x3F, 0x00, 0xFC, 0x7E, 0x01, 0xF8, 0xFC, 0x03, 0xF1, 0xF8, 0x07, 0xE3,
+  0xF0, 0x3F, 0x87, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0x3F,
+  0xFF, 0xE0, 0x7F, 0xFF, 0xE0, 0xFC, 0x1F, 0xE1, 0xF8, 0x1F, 0xC3, 0xF0,
+  0x1F, 0xC7, 0xE0, 0x1F, 0x8F, 0xC0, 0x3F, 0x9F, 0x80, 0x7F, 0x3F, 0x00,
+  0x7E, 0x7E, 0x00, 0xFE, 0xFC, 0x00, 0xFD, 0xF8, 0x01, 0xFC, 0x07, 0xFC,
+  0x01, 0xFF, 0xFC, 0x3F, 0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 0xFF, 0xCF, 0xE0,
+  0x3C, 0xFC, 0x00, 0x4F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x7F,
+  0xF8, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x03, 0xFF, 0xE0,
+  0x01, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xFE, 0x00, 0x3F,
+  0xFC, 0x0F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFC, 0x7F, 0xFF,
+  0x80, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
+  0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
+  0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00,
+  0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
+  0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00,
+  0x03, 0xF0, 0x00, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF,
+  0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00,
+  0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F,
+  0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC,
+  0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x1F, 0xDF, 0x80, 0x7E, 0x7F, 0x03,
+  0xF9, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0,
+  0x07, 0xF8, 0x00, 0xFE, 0x00, 0x0F, 0xEF, 0xC0, 0x01, 0xF9, 0xF8, 0x00,
+  0x3F, 0x3F, 0x80, 0x0F, 0xE3, 0xF0, 0x01, 0xF8, 0x7E, 0x00, 0x3F, 0x0F,
+  0xE0, 0x0F, 0xE0, 0xFC, 0x01, 0xF8, 0x1F, 0xC0, 0x7F, 0x03, 0xF8, 0x0F,
+  0xE0, 0x3F, 0x01, 0xF8, 0x07, 0xF0, 0x7F, 0x00, 0x7E, 0x0F, 0xC0, 0x0F,
+  0xC1, 0xF8, 0x01, 0xFC, 0x7F, 0x00, 0x1F, 0x8F, 0xC0, 0x03, 0xF1, 0xF8,
+  0x00, 0x7F, 0x7F, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x0F,
+  0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFE, 0x00,
+  0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xFF,
+  0xE0, 0x1F, 0xC0, 0x7F, 0x7E, 0x03, 0xFC, 0x07, 0xE7, 0xE0, 0x3F, 0xC0,
+  0x7E, 0x7E, 0x03, 0xFC, 0x07, 0xE7, 0xE0, 0x3F, 0xC0, 0x7E, 0x3F, 0x07,
+  0xDE, 0x0F, 0xE3, 0xF0, 0x79, 0xE0, 0xFC, 0x3F, 0x07, 0x9E, 0x0F, 0xC3,
+  0xF0, 0x79, 0xE0, 0xFC, 0x3F, 0x8F, 0x9F, 0x1F, 0xC1, 0xF8, 0xF0, 0xF1,
+  0xF8, 0x1F, 0x8F, 0x0F, 0x1F, 0x81, 0xF8, 0xF0, 0xF1, 0xF8, 0x1F, 0x8F,
+  0x0F, 0x1F, 0x80, 0xFD, 0xE0, 0x7B, 0xF0, 0x0F, 0xDE, 0x07, 0xBF, 0x00,
+  0xFD, 0xE0, 0x7B, 0xF0, 0x0F, 0xDE, 0x07, 0xBF, 0x00, 0xFF, 0xE0, 0x3F,
+  0xF0, 0x07, 0xFC, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x07, 0xFC,
+  0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x03, 0xF8, 0x01, 0xFC, 0x00,
+  0x3F, 0x80, 0x1F, 0xC0, 0xFF, 0x00, 0x3F, 0xDF, 0xC0, 0x0F, 0xE3, 0xF8,
+  0x07, 0xF0, 0xFF, 0x03, 0xFC, 0x1F, 0xC0, 0xFE, 0x03, 0xF8, 0x7F, 0x00,
+  0x7F, 0x3F, 0x80, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x00, 0x7F, 0xF8,
+  0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F,
+  0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x00,
+  0xFF, 0xFC, 0x00, 0x7F, 0x3F, 0x80, 0x3F, 0xCF, 0xF0, 0x0F, 0xE1, 0xFC,
+  0x07, 0xF0, 0x3F, 0x83, 0xFC, 0x0F, 0xF0, 0xFE, 0x01, 0xFC, 0x7F, 0x00,
+  0x3F, 0xBF, 0xC0, 0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xDF, 0xC0, 0x0F, 0xE3,
+  0xF8, 0x07, 0xF0, 0xFF, 0x03, 0xFC, 0x1F, 0xC0, 0xFE, 0x03, 0xF8, 0x7F,
+  0x00, 0xFF, 0x3F, 0xC0, 0x1F, 0xCF, 0xE0, 0x03, 0xFF, 0xF0, 0x00, 0xFF,
+  0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00,
+  0x1F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00,
+  0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F,
+  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00,
+  0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xE0, 0x00,
+  0xFF, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xF8,
+  0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xC0, 0x01,
+  0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xF0,
+  0x00, 0x7F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1,
+  0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8,
+  0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF0, 0x07, 0x80, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x1E, 0x00, 0xF0,
+  0x07, 0x80, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x1C, 0x00, 0xF0, 0x07, 0x80,
+  0x1C, 0x00, 0xF0, 0x07, 0x80, 0x1C, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x00,
+  0xF0, 0x07, 0x80, 0x3C, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x00, 0xF0, 0x07,
+  0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F,
+  0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07,
+  0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0,
+  0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFC, 0x00, 0x03,
+  0xF0, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x3F, 0x3F,
+  0x01, 0xF8, 0x7E, 0x0F, 0x80, 0x7C, 0x7C, 0x00, 0xFB, 0xE0, 0x01, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x78, 0x0F, 0x01, 0xE0, 0x3C,
+  0x07, 0x80, 0xF0, 0x0F, 0xFC, 0x07, 0xFF, 0xE0, 0xFF, 0xFE, 0x1F, 0xFF,
+  0xE3, 0x81, 0xFC, 0x40, 0x0F, 0xC0, 0x01, 0xF8, 0x3F, 0xFF, 0x3F, 0xFF,
+  0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x1F,
+  0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xE7, 0xFE, 0xFC, 0x3F, 0x1F,
+  0x80, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0F,
+  0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x3F,
+  0x07, 0xE7, 0xFC, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0xCF, 0xF0, 0x7F, 0x7F,
+  0x01, 0xFB, 0xF8, 0x0F, 0xFF, 0x80, 0x3F, 0xFC, 0x01, 0xFF, 0xE0, 0x0F,
+  0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFB, 0xFC,
+  0x1F, 0xDF, 0xFF, 0xFC, 0xFF, 0xFF, 0xC7, 0xE7, 0xFC, 0x3F, 0x1F, 0x80,
+  0x01, 0xFE, 0x07, 0xFF, 0xC7, 0xFF, 0xE7, 0xFF, 0xF7, 0xF8, 0x3B, 0xF0,
+  0x07, 0xF8, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F,
+  0x80, 0x0F, 0xE0, 0x03, 0xF0, 0x05, 0xFE, 0x0E, 0x7F, 0xFF, 0x1F, 0xFF,
+  0x87, 0xFF, 0xC0, 0x7F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00,
+  0x7E, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0,
+  0x00, 0x3F, 0x03, 0xF1, 0xF8, 0x7F, 0xCF, 0xCF, 0xFF, 0xFE, 0x7F, 0xFF,
+  0xF7, 0xF0, 0x7F, 0xBF, 0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0x80, 0x3F, 0xFC,
+  0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xE0, 0x3F,
+  0xBF, 0x01, 0xFD, 0xFC, 0x1F, 0xE7, 0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x7F,
+  0xCF, 0xC1, 0xFC, 0x7E, 0x01, 0xFC, 0x00, 0x7F, 0xFC, 0x07, 0xFF, 0xF0,
+  0x7F, 0xFF, 0xC7, 0xF8, 0x7F, 0x3F, 0x01, 0xFB, 0xF8, 0x07, 0xDF, 0x80,
+  0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x00, 0x3F, 0x00, 0x09, 0xFC, 0x03, 0xC7, 0xFF, 0xFE, 0x1F, 0xFF,
+  0xF0, 0x7F, 0xFF, 0x80, 0x7F, 0xE0, 0x01, 0xFE, 0x0F, 0xFC, 0x3F, 0xF8,
+  0xFF, 0xF1, 0xFC, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0xFF, 0xFD, 0xFF,
+  0xFB, 0xFF, 0xF7, 0xFF, 0xE1, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0,
+  0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07,
+  0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0x03, 0xF1, 0xF8,
+  0x7F, 0xCF, 0xC7, 0xFF, 0xFE, 0x7F, 0xFF, 0xF7, 0xF0, 0x7F, 0xBF, 0x01,
+  0xFF, 0xF8, 0x0F, 0xFF, 0x80, 0x3F, 0xFC, 0x01, 0xFF, 0xE0, 0x0F, 0xFF,
+  0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xC0, 0x3F, 0xBF, 0x01, 0xFD, 0xFC, 0x1F,
+  0xE7, 0xFF, 0xFF, 0x1F, 0xFF, 0xF8, 0x7F, 0xCF, 0xC1, 0xFC, 0x7E, 0x00,
+  0x03, 0xF2, 0x00, 0x3F, 0x1C, 0x07, 0xF8, 0xFF, 0xFF, 0x87, 0xFF, 0xF8,
+  0x3F, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0,
+  0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0,
+  0x00, 0xFC, 0x7E, 0x1F, 0x9F, 0xF3, 0xFF, 0xFF, 0x7F, 0xFF, 0xEF, 0xFF,
+  0xFF, 0xFE, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x3F, 0xFC, 0x07, 0xFF, 0x80,
+  0xFF, 0xF0, 0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x0F, 0xFF, 0x01,
+  0xFF, 0xE0, 0x3F, 0xFC, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x1F, 0x80, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xC3, 0xF0, 0xFC,
+  0x3F, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F,
+  0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0,
+  0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC7, 0xFF, 0xFB, 0xFE,
+  0xFF, 0x3F, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF8,
+  0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00,
+  0xFC, 0x0F, 0xE7, 0xE0, 0xFE, 0x3F, 0x0F, 0xE1, 0xF8, 0xFE, 0x0F, 0xCF,
+  0xE0, 0x7E, 0xFE, 0x03, 0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0xFF, 0xE0, 0x07,
+  0xFF, 0x80, 0x3F, 0xFE, 0x01, 0xFF, 0xF8, 0x0F, 0xDF, 0xE0, 0x7E, 0x7F,
+  0x83, 0xF1, 0xFE, 0x1F, 0x87, 0xF8, 0xFC, 0x1F, 0xE7, 0xE0, 0x7F, 0xBF,
+  0x01, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFC,
+  0x7C, 0x07, 0xC3, 0xF7, 0xFC, 0x7F, 0xCF, 0xFF, 0xFB, 0xFF, 0xBF, 0xFF,
+  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xC7, 0xFF, 0xE0, 0xFE,
+  0x0F, 0xFF, 0x03, 0xF0, 0x3F, 0xFC, 0x0F, 0xC0, 0xFF, 0xF0, 0x3F, 0x03,
+  0xFF, 0xC0, 0xFC, 0x0F, 0xFF, 0x03, 0xF0, 0x3F, 0xFC, 0x0F, 0xC0, 0xFF,
+  0xF0, 0x3F, 0x03, 0xFF, 0xC0, 0xFC, 0x0F, 0xFF, 0x03, 0xF0, 0x3F, 0xFC,
+  0x0F, 0xC0, 0xFF, 0xF0, 0x3F, 0x03, 0xFF, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC,
+  0x7E, 0x1F, 0x9F, 0xF3, 0xFF, 0xFF, 0x7F, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE,
+  0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x3F, 0xFC, 0x07, 0xFF, 0x80, 0xFF, 0xF0,
+  0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x0F, 0xFF, 0x01, 0xFF, 0xE0,
+  0x3F, 0xFC, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x1F, 0x80, 0x01, 0xFC, 0x00,
+  0x7F, 0xFC, 0x07, 0xFF, 0xF0, 0x7F, 0xFF, 0xC7, 0xF0, 0x7F, 0x3F, 0x01,
+  0xFB, 0xF8, 0x0F, 0xFF, 0x80, 0x3F, 0xFC, 0x01, 0xFF, 0xE0, 0x0F, 0xFF,
+  0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xE0, 0x3F, 0xBF, 0x01, 0xF9, 0xFC, 0x1F,
+  0xC7, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0xFF, 0x00, 0xFC,
+  0x3F, 0x07, 0xE7, 0xFC, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0xCF, 0xF0, 0x7F,
+  0x7F, 0x01, 0xFB, 0xF8, 0x0F, 0xFF, 0x80, 0x3F, 0xFC, 0x01, 0xFF, 0xE0,
+  0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFB,
+  0xFC, 0x1F, 0xDF, 0xFF, 0xFC, 0xFF, 0xFF, 0xC7, 0xE7, 0xFC, 0x3F, 0x1F,
+  0x81, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x1F,
+  0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF1, 0xF8, 0x7F,
+  0xCF, 0xCF, 0xFF, 0xFE, 0x7F, 0xFF, 0xF7, 0xF0, 0x7F, 0xBF, 0x01, 0xFF,
+  0xF8, 0x0F, 0xFF, 0x80, 0x3F, 0xFC, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00,
+  0x7F, 0xF8, 0x03, 0xFF, 0xE0, 0x3F, 0xBF, 0x01, 0xFD, 0xFC, 0x1F, 0xE7,
+  0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x7F, 0xCF, 0xC1, 0xFC, 0x7E, 0x00, 0x03,
+  0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00,
+  0x01, 0xF8, 0x00, 0x0F, 0xC0, 0xFC, 0x3F, 0xF3, 0xFF, 0xDF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x1F, 0xE0, 0x3F, 0x80, 0xFC, 0x03, 0xF0, 0x0F, 0xC0,
+  0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0,
+  0x0F, 0xC0, 0x00, 0x0F, 0xFC, 0x1F, 0xFF, 0x9F, 0xFF, 0xDF, 0xFF, 0xEF,
+  0xE0, 0xF7, 0xE0, 0x0B, 0xF0, 0x01, 0xFF, 0x80, 0x7F, 0xFC, 0x1F, 0xFF,
+  0x83, 0xFF, 0xC0, 0x0F, 0xF0, 0x01, 0xFC, 0x00, 0xFF, 0xC0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0x07, 0xFC, 0x00, 0x1F, 0x80, 0x3F, 0x00,
+  0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0,
+  0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xFC, 0x03,
+  0xFF, 0xC3, 0xFF, 0x87, 0xFF, 0x03, 0xFE, 0xFC, 0x07, 0xFF, 0x80, 0xFF,
+  0xF0, 0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x0F, 0xFF, 0x01, 0xFF,
+  0xE0, 0x3F, 0xFC, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x1F, 0xFE, 0x03, 0xFF,
+  0xC0, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x7F, 0xFF, 0xE7,
+  0xFC, 0xFC, 0x3F, 0x1F, 0x80, 0xFE, 0x01, 0xFD, 0xF8, 0x07, 0xE7, 0xE0,
+  0x1F, 0x9F, 0xC0, 0xFE, 0x3F, 0x03, 0xF0, 0xFE, 0x1F, 0xC1, 0xF8, 0x7E,
+  0x07, 0xE1, 0xF8, 0x1F, 0xCF, 0xE0, 0x3F, 0x3F, 0x00, 0xFF, 0xFC, 0x01,
+  0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
+  0xC0, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0xFC, 0x0F,
+  0xC0, 0xFF, 0xF8, 0x3F, 0x07, 0xF7, 0xE0, 0xFC, 0x1F, 0x9F, 0x83, 0xF0,
+  0x7E, 0x7E, 0x1F, 0xE1, 0xF9, 0xFC, 0x7F, 0x8F, 0xE3, 0xF1, 0xFE, 0x3F,
+  0x0F, 0xC7, 0xF8, 0xFC, 0x3F, 0x3C, 0xF3, 0xF0, 0x7E, 0xF3, 0xDF, 0x81,
+  0xFB, 0xCF, 0x7E, 0x07, 0xEF, 0x3D, 0xF8, 0x1F, 0xF8, 0x7F, 0xE0, 0x3F,
+  0xE1, 0xFF, 0x00, 0xFF, 0x87, 0xFC, 0x03, 0xFE, 0x1F, 0xF0, 0x0F, 0xF0,
+  0x3F, 0xC0, 0x1F, 0xC0, 0xFE, 0x00, 0x7F, 0x03, 0xF8, 0x00, 0xFF, 0x03,
+  0xFD, 0xFE, 0x1F, 0xE3, 0xFC, 0xFF, 0x07, 0xF3, 0xF8, 0x0F, 0xFF, 0xC0,
+  0x3F, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0x07,
+  0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x3F, 0xFF,
+  0x01, 0xFF, 0xFE, 0x07, 0xF3, 0xF8, 0x3F, 0x87, 0xF1, 0xFE, 0x1F, 0xEF,
+  0xF0, 0x3F, 0xC0, 0xFE, 0x01, 0xFD, 0xF8, 0x07, 0xE7, 0xF0, 0x1F, 0x8F,
+  0xC0, 0xFE, 0x3F, 0x83, 0xF0, 0xFE, 0x1F, 0xC1, 0xF8, 0x7E, 0x07, 0xF1,
+  0xF8, 0x0F, 0xCF, 0xE0, 0x3F, 0xBF, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xE0,
+  0x03, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xC0, 0x01,
+  0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xFC,
+  0x00, 0x07, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x1F, 0xE0, 0x00,
+  0x7F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x07, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x03, 0xFC,
+  0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x01, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0x01, 0xFF,
+  0x03, 0xFF, 0x07, 0xFF, 0x07, 0xF0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0,
+  0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0xC0, 0x1F, 0xE0, 0x0F, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xF0, 0x07, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x00, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0x00, 0xFF, 0x80, 0xFF, 0xC0,
+  0xFF, 0xE0, 0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xF0, 0x03, 0xFF,
+  0x01, 0xFF, 0x01, 0xFF, 0x03, 0xFF, 0x07, 0xF8, 0x07, 0xF0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x0F, 0xE0, 0xFF, 0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xFE, 0x00, 0x1F, 0xC0,
+  0x05, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFB,
+  0x00, 0x3F, 0x80, 0x00, 0x00, 0x00 };
+
+const GFXglyph DejaVuSans_Bold18pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  12,    0,    0 },   // 0x20 ' '
+  {     1,   6,  26,  16,    5,  -25 },   // 0x21 '!'
+  {    21,  11,   9,  18,    3,  -25 },   // 0x22 '"'
+  {    34,  25,  26,  29,    2,  -25 },   // 0x23 '#'
+  {   116,  19,  32,  24,    3,  -26 },   // 0x24 '$'
+  {   192,  33,  26,  35,    1,  -25 },   // 0x25 '%'
+  {   300,  27,  26,  31,    2,  -25 },   // 0x26 '&'
+  {   388,   4,   9,  11,    3,  -25 },   // 0x27 '''
+  {   393,  10,  31,  16,    3,  -26 },   // 0x28 '('
+  {   432,  10,  31,  16,    3,  -26 },   // 0x29 ')'
+  {   471,  17,  16,  18,    1,  -25 },   // 0x2A '*'
+  {   505,  22,  22,  29,    4,  -21 },   // 0x2B '+'
+  {   566,   8,  12,  13,    2,   -6 },   // 0x2C ','
+  {   578,  11,   5,  15,    2,  -12 },   // 0x2D '-'
+  {   585,   6,   7,  13,    4,   -6 },   // 0x2E '.'
+  {   591,  13,  29,  13,    0,  -25 },   // 0x2F '/'
+  {   639,  21,  26,  24,    2,  -25 },   // 0x30 '0'
+  {   708,  18,  26,  24,    4,  -25 },   // 0x31 '1'
+  {   767,  19,  26,  24,    3,  -25 },   // 0x32 '2'
+  {   829,  19,  26,  24,    2,  -25 },   // 0x33 '3'
+  {   891,  22,  26,  24,    2,  -25 },   // 0x34 '4'
+  {   963,  19,  26,  24,    3,  -25 },   // 0x35 '5'
+  {  1025,  20,  26,  24,    2,  -25 },   // 0x36 '6'
+  {  1090,  19,  26,  24,    2,  -25 },   // 0x37 '7'
+  {  1152,  20,  26,  24,    2,  -25 },   // 0x38 '8'
+  {  1217,  20,  26,  24,    2,  -25 },   // 0x39 '9'
+  {  1282,   6,  19,  14,    4,  -18 },   // 0x3A ':'
+  {  1297,   8,  24,  14,    2,  -18 },   // 0x3B ';'
+  {  1321,  22,  20,  29,    4,  -20 },   // 0x3C '<'
+  {  1376,  22,  12,  29,    4,  -16 },   // 0x3D '='
+  {  1409,  22,  20,  29,    4,  -20 },   // 0x3E '>'
+  {  1464,  16,  26,  20,    2,  -25 },   // 0x3F '?'
+  {  1516,  30,  31,  35,    2,  -25 },   // 0x40 '@'
+  {  1633,  27,  26,  27,    0,  -25 },   // 0x41 'A'
+  {  1721,  21,  26,  27,    3,  -25 },   // 0x42 'B'
+  {  1790,  22,  26,  26,    2,  -25 },   // 0x43 'C'
+  {  1862,  24,  26,  29,    3,  -25 },   // 0x44 'D'
+  {  1940,  18,  26,  24,    3,  -25 },   // 0x45 'E'
+  {  1999,  18,  26,  24,    3,  -25 },   // 0x46 'F'
+  {  2058,  24,  26,  29,    2,  -25 },   // 0x47 'G'
+  {  2136,  23,  26,  29,    3,  -25 },   // 0x48 'H'
+  {  2211,   6,  26,  13,    3,  -25 },   // 0x49 'I'
+  {  2231,  11,  33,  13,   -2,  -25 },   // 0x4A 'J'
+  {  2277,  25,  26,  27,    3,  -25 },   // 0x4B 'K'
+  {  2359,  18,  26,  22,    3,  -25 },   // 0x4C 'L'
+  {  2418,  28,  26,  35,    3,  -25 },   // 0x4D 'M'
+  {  2509,  23,  26,  29,    3,  -25 },   // 0x4E 'N'
+  {  2584,  26,  26,  30,    2,  -25 },   // 0x4F 'O'
+  {  2669,  21,  26,  26,    3,  -25 },   // 0x50 'P'
+  {  2738,  26,  31,  30,    2,  -25 },   // 0x51 'Q'
+  {  2839,  23,  26,  27,    3,  -25 },   // 0x52 'R'
+  {  2914,  20,  26,  25,    3,  -25 },   // 0x53 'S'
+  {  2979,  22,  26,  24,    1,  -25 },   // 0x54 'T'
+  {  3051,  22,  26,  28,    3,  -25 },   // 0x55 'U'
+  {  3123,  27,  26,  27,    0,  -25 },   // 0x56 'V'
+  {  3211,  36,  26,  39,    1,  -25 },   // 0x57 'W'
+  {  3328,  26,  26,  27,    1,  -25 },   // 0x58 'X'
+  {  3413,  26,  26,  25,   -1,  -25 },   // 0x59 'Y'
+  {  3498,  22,  26,  25,    2,  -25 },   // 0x5A 'Z'
+  {  3570,  11,  31,  16,    3,  -26 },   // 0x5B '['
+  {  3613,  13,  29,  13,    0,  -25 },   // 0x5C '\'
+  {  3661,  11,  31,  16,    2,  -26 },   // 0x5D ']'
+  {  3704,  22,  10,  29,    4,  -25 },   // 0x5E '^'
+  {  3732,  18,   3,  18,    0,    6 },   // 0x5F '_'
+  {  3739,  10,   6,  18,    2,  -27 },   // 0x60 '`'
+  {  3747,  19,  19,  24,    2,  -18 },   // 0x61 'a'
+  {  3793,  21,  27,  25,    3,  -26 },   // 0x62 'b'
+  {  3864,  17,  19,  21,    2,  -18 },   // 0x63 'c'
+  {  3905,  21,  27,  25,    2,  -26 },   // 0x64 'd'
+  {  3976,  21,  19,  24,    2,  -18 },   // 0x65 'e'
+  {  4026,  15,  27,  15,    1,  -26 },   // 0x66 'f'
+  {  4077,  21,  26,  25,    2,  -18 },   // 0x67 'g'
+  {  4146,  19,  27,  25,    3,  -26 },   // 0x68 'h'
+  {  4211,   6,  27,  12,    3,  -26 },   // 0x69 'i'
+  {  4232,  10,  34,  12,   -1,  -26 },   // 0x6A 'j'
+  {  4275,  21,  27,  23,    3,  -26 },   // 0x6B 'k'
+  {  4346,   6,  27,  12,    3,  -26 },   // 0x6C 'l'
+  {  4367,  30,  19,  36,    3,  -18 },   // 0x6D 'm'
+  {  4439,  19,  19,  25,    3,  -18 },   // 0x6E 'n'
+  {  4485,  21,  19,  24,    2,  -18 },   // 0x6F 'o'
+  {  4535,  21,  26,  25,    3,  -18 },   // 0x70 'p'
+  {  4604,  21,  26,  25,    2,  -18 },   // 0x71 'q'
+  {  4673,  14,  19,  17,    3,  -18 },   // 0x72 'r'
+  {  4707,  17,  19,  21,    2,  -18 },   // 0x73 's'
+  {  4748,  15,  25,  17,    1,  -24 },   // 0x74 't'
+  {  4795,  19,  19,  25,    3,  -18 },   // 0x75 'u'
+  {  4841,  22,  19,  23,    1,  -18 },   // 0x76 'v'
+  {  4894,  30,  19,  32,    1,  -18 },   // 0x77 'w'
+  {  4966,  22,  19,  23,    1,  -18 },   // 0x78 'x'
+  {  5019,  22,  26,  23,    0,  -18 },   // 0x79 'y'
+  {  5091,  17,  19,  20,    2,  -18 },   // 0x7A 'z'
+  {  5132,  16,  32,  25,    5,  -26 },   // 0x7B '{'
+  {  5196,   4,  35,  13,    4,  -26 },   // 0x7C '|'
+  {  5214,  16,  32,  25,    4,  -26 },   // 0x7D '}'
+  {  5278,  22,   7,  29,    4,  -13 } }; // 0x7E '~'
+
+const GFXfont DejaVuSans_Bold18pt7b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Bold18pt7bBitmaps,
+  (GFXglyph *)DejaVuSans_Bold18pt7bGlyphs,
+  0x20, 0x7E, 41 };
+
+// Approx. 5970 bytes
@@ -0,0 +1,909 @@
+// DejaVuSans-Bold.ttf at 24pt, converted with Adafruit GFX fontconvert (7-bit, 141 dpi).
+// Fixed font for tools/golden_check.cpp; DejaVu fonts license in LICENSE.
+#pragma once
+#include <Adafruit_GFX.h>
+
+const uint8_t DejaVuSans_Bold24pt7bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x3F, 0xF0, 0x7F, 0xE0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0x07, 0xFE, 0x0F,
+  0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0x7F, 0xE0, 0xFF, 0xC1, 0xFF, 0x83, 0xE0,
+  0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x03, 0xE0, 0x7C,
+  0x00, 0x01, 0xF0, 0x3E, 0x00, 0x01, 0xF8, 0x1F, 0x00, 0x00, 0xF8, 0x1F,
+  0x80, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0x1F, 0x03,
+  0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xF0,
+  0x3E, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFC, 0x0F, 0x80, 0x00, 0x7C,
+  0x0F, 0xC0, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0x1F, 0x03, 0xE0, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF,
+  0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xF0, 0x3F, 0x00, 0x00,
+  0xF8, 0x1F, 0x00, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0x3E, 0x07, 0xC0, 0x00,
+  0x3E, 0x07, 0xE0, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x0F, 0x81, 0xF0, 0x00,
+  0x07, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E,
+  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xFC, 0x3F,
+  0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC7, 0xF9, 0xE1, 0xF3, 0xFC, 0x78, 0x04,
+  0xFE, 0x1E, 0x00, 0x3F, 0x87, 0x80, 0x0F, 0xE1, 0xE0, 0x03, 0xFE, 0x78,
+  0x00, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x80, 0xFF,
+  0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8,
+  0x00, 0x7F, 0xFF, 0x00, 0x1E, 0xFF, 0xC0, 0x07, 0x8F, 0xF0, 0x01, 0xE1,
+  0xFC, 0x00, 0x78, 0x7F, 0x80, 0x1E, 0x1F, 0xF8, 0x07, 0x87, 0xFF, 0xE1,
+  0xE7, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x87,
+  0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80,
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07,
+  0x80, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0xFF,
+  0xC0, 0x00, 0x7C, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xC0, 0x03, 0xFF, 0xF0,
+  0x00, 0xF8, 0x00, 0x7F, 0x3F, 0x80, 0x0F, 0x80, 0x07, 0xE1, 0xF8, 0x01,
+  0xF0, 0x00, 0xFC, 0x0F, 0xC0, 0x3E, 0x00, 0x0F, 0xC0, 0xFC, 0x03, 0xE0,
+  0x00, 0xFC, 0x0F, 0xC0, 0x7C, 0x00, 0x0F, 0xC0, 0xFC, 0x07, 0xC0, 0x00,
+  0xFC, 0x0F, 0xC0, 0xF8, 0x00, 0x0F, 0xC0, 0xFC, 0x1F, 0x00, 0x00, 0xFC,
+  0x0F, 0xC1, 0xF0, 0x00, 0x07, 0xE1, 0xF8, 0x3E, 0x00, 0x00, 0x7F, 0x3F,
+  0x83, 0xE0, 0x00, 0x03, 0xFF, 0xF0, 0x7C, 0x00, 0x00, 0x3F, 0xFF, 0x0F,
+  0x80, 0x00, 0x00, 0xFF, 0xC0, 0xF8, 0x0F, 0xC0, 0x03, 0xF0, 0x1F, 0x03,
+  0xFF, 0x00, 0x00, 0x01, 0xF0, 0xFF, 0xFC, 0x00, 0x00, 0x3E, 0x0F, 0xFF,
+  0xC0, 0x00, 0x07, 0xC1, 0xFC, 0xFE, 0x00, 0x00, 0x7C, 0x1F, 0x87, 0xE0,
+  0x00, 0x0F, 0x83, 0xF0, 0x3F, 0x00, 0x00, 0xF8, 0x3F, 0x03, 0xF0, 0x00,
+  0x1F, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x00, 0x3E,
+  0x03, 0xF0, 0x3F, 0x00, 0x07, 0xC0, 0x3F, 0x03, 0xF0, 0x00, 0x7C, 0x03,
+  0xF0, 0x3F, 0x00, 0x0F, 0x80, 0x1F, 0x87, 0xE0, 0x01, 0xF8, 0x01, 0xFC,
+  0xFE, 0x00, 0x1F, 0x00, 0x0F, 0xFF, 0xC0, 0x03, 0xE0, 0x00, 0xFF, 0xFC,
+  0x00, 0x3E, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
+  0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+  0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xC0,
+  0x78, 0x00, 0x07, 0xF8, 0x00, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x07,
+  0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
+  0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF8,
+  0x00, 0x00, 0x07, 0xFF, 0xC0, 0x1F, 0xC0, 0xFF, 0xFE, 0x01, 0xFC, 0x1F,
+  0xFF, 0xF0, 0x1F, 0xC3, 0xFF, 0xFF, 0x81, 0xFC, 0x7F, 0xCF, 0xF8, 0x3F,
+  0x87, 0xF8, 0xFF, 0xC3, 0xF8, 0xFF, 0x87, 0xFE, 0x3F, 0x8F, 0xF0, 0x3F,
+  0xF7, 0xF8, 0xFF, 0x01, 0xFF, 0xFF, 0x0F, 0xF0, 0x0F, 0xFF, 0xF0, 0xFF,
+  0x00, 0x7F, 0xFE, 0x0F, 0xF0, 0x03, 0xFF, 0xE0, 0xFF, 0x80, 0x1F, 0xFC,
+  0x0F, 0xF8, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x1F, 0xFC, 0x07, 0xFF, 0x07,
+  0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xE7, 0xFE, 0x03, 0xFF, 0xF8, 0x3F,
+  0xF0, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x01, 0xFC, 0x0F, 0xE0, 0x7F, 0x81, 0xFC, 0x0F, 0xF0, 0x3F,
+  0x81, 0xFE, 0x07, 0xF8, 0x1F, 0xC0, 0xFF, 0x03, 0xFC, 0x1F, 0xE0, 0x7F,
+  0x81, 0xFE, 0x07, 0xF8, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F,
+  0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F,
+  0xF0, 0x1F, 0xE0, 0x7F, 0x81, 0xFE, 0x07, 0xF8, 0x0F, 0xF0, 0x3F, 0xC0,
+  0x7F, 0x01, 0xFE, 0x07, 0xF8, 0x0F, 0xE0, 0x3F, 0xC0, 0x7F, 0x01, 0xFE,
+  0x03, 0xF8, 0x07, 0xF0, 0xFE, 0x01, 0xFC, 0x07, 0xF0, 0x0F, 0xE0, 0x3F,
+  0xC0, 0x7F, 0x01, 0xFE, 0x07, 0xF8, 0x0F, 0xE0, 0x3F, 0xC0, 0xFF, 0x01,
+  0xFC, 0x07, 0xF8, 0x1F, 0xE0, 0x7F, 0x80, 0xFE, 0x03, 0xFC, 0x0F, 0xF0,
+  0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC,
+  0x0F, 0xF0, 0x3F, 0x81, 0xFE, 0x07, 0xF8, 0x1F, 0xE0, 0x7F, 0x03, 0xFC,
+  0x0F, 0xF0, 0x3F, 0x81, 0xFE, 0x07, 0xF8, 0x1F, 0xC0, 0xFF, 0x03, 0xF8,
+  0x1F, 0xC0, 0x7F, 0x03, 0xF8, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00,
+  0x07, 0x80, 0x00, 0x1E, 0x00, 0x60, 0x78, 0x19, 0xC1, 0xE0, 0xEF, 0xC7,
+  0x8F, 0xDF, 0xDE, 0xFE, 0x1F, 0xFF, 0xE0, 0x3F, 0xFF, 0x00, 0x3F, 0xF0,
+  0x00, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x7F, 0xFF, 0x87, 0xF7, 0xBF, 0xBF,
+  0x1E, 0x3F, 0x70, 0x78, 0x39, 0x81, 0xE0, 0x60, 0x07, 0x80, 0x00, 0x1E,
+  0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
+  0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00,
+  0x00, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
+  0x1F, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7C, 0x00,
+  0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0x07, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F,
+  0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF,
+  0xF3, 0xFC, 0xFF, 0x3F, 0x9F, 0xE7, 0xF1, 0xFC, 0x7E, 0x1F, 0x0F, 0xC3,
+  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0x0F, 0x80, 0x0F, 0xC0, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x01, 0xF0,
+  0x00, 0xF8, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x1F,
+  0x00, 0x0F, 0x80, 0x07, 0xC0, 0x07, 0xE0, 0x03, 0xE0, 0x01, 0xF0, 0x00,
+  0xF8, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x1F, 0x00,
+  0x0F, 0x80, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x01, 0xF0,
+  0x00, 0xF8, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x1F,
+  0x00, 0x0F, 0x80, 0x07, 0xC0, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0x00, 0x3F,
+  0xC0, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xE0,
+  0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x3F, 0xF0, 0xFF, 0xC3, 0xFE,
+  0x07, 0xFC, 0x7F, 0xC0, 0x3F, 0xC7, 0xFC, 0x03, 0xFE, 0x7F, 0xC0, 0x3F,
+  0xE7, 0xF8, 0x01, 0xFE, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF,
+  0x80, 0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x01,
+  0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
+  0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0x7F, 0x80,
+  0x1F, 0xE7, 0xFC, 0x03, 0xFE, 0x7F, 0xC0, 0x3F, 0xE7, 0xFC, 0x03, 0xFE,
+  0x3F, 0xE0, 0x7F, 0xC3, 0xFF, 0x0F, 0xFC, 0x1F, 0xFF, 0xFF, 0x80, 0xFF,
+  0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x01, 0xFF, 0xF8,
+  0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0xFF, 0xFF,
+  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFC, 0xFF,
+  0x00, 0xC0, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF,
+  0x80, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0x8F, 0xFF,
+  0xFF, 0xE7, 0xFF, 0xFF, 0xFB, 0xF8, 0x1F, 0xFD, 0xE0, 0x07, 0xFF, 0xC0,
+  0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF0,
+  0x00, 0x0F, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC,
+  0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE,
+  0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFC,
+  0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC,
+  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+  0x03, 0xFF, 0x80, 0x0F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
+  0xF8, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC7, 0xC0, 0x7F, 0xF9, 0x00,
+  0x07, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8,
+  0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x3F, 0xFF,
+  0xC0, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x3F,
+  0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xE0,
+  0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F,
+  0xF0, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x01,
+  0xFF, 0xEF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0x3F,
+  0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFF,
+  0x00, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00,
+  0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x01, 0xFF, 0xFC, 0x00, 0x0F,
+  0xFF, 0xE0, 0x00, 0xFE, 0xFF, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0x7F, 0x3F,
+  0xC0, 0x07, 0xF1, 0xFE, 0x00, 0x7F, 0x0F, 0xF0, 0x07, 0xF0, 0x7F, 0x80,
+  0x3F, 0x83, 0xFC, 0x03, 0xF8, 0x1F, 0xE0, 0x3F, 0x80, 0xFF, 0x01, 0xF8,
+  0x07, 0xF8, 0x1F, 0xC0, 0x3F, 0xC1, 0xFC, 0x01, 0xFE, 0x0F, 0xC0, 0x0F,
+  0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+  0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03,
+  0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8,
+  0x00, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1, 0xFF,
+  0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1,
+  0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00,
+  0x01, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x07, 0xFF,
+  0xFF, 0xE1, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0x1F, 0x01, 0xFF, 0xE4,
+  0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F,
+  0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00,
+  0x1F, 0xF8, 0x00, 0x0F, 0xFF, 0x80, 0x07, 0xFE, 0xFC, 0x07, 0xFF, 0xBF,
+  0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8,
+  0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0F,
+  0xFF, 0xE0, 0x07, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF8,
+  0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0x01, 0xE1, 0xFF, 0x80, 0x04, 0x3F, 0xE0,
+  0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07,
+  0xF0, 0x00, 0x01, 0xFE, 0x1F, 0xC0, 0x3F, 0xDF, 0xFF, 0x07, 0xFF, 0xFF,
+  0xF0, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x7F,
+  0xF0, 0x7F, 0xEF, 0xFC, 0x03, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xE0, 0x07,
+  0xFF, 0xFC, 0x00, 0xFF, 0x7F, 0x80, 0x1F, 0xEF, 0xF0, 0x03, 0xFD, 0xFE,
+  0x00, 0x7F, 0xBF, 0xE0, 0x1F, 0xF3, 0xFC, 0x03, 0xFC, 0x7F, 0xC1, 0xFF,
+  0x87, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x00, 0x7F,
+  0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFE, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF8,
+  0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F,
+  0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00,
+  0x7F, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x00,
+  0x01, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0,
+  0x00, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F,
+  0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00,
+  0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x0F, 0xFF,
+  0xFF, 0x83, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0x1F, 0xF8, 0x3F, 0xF3,
+  0xFE, 0x03, 0xFE, 0x7F, 0x80, 0x3F, 0xCF, 0xF0, 0x07, 0xF9, 0xFE, 0x00,
+  0xFF, 0x3F, 0xC0, 0x1F, 0xE3, 0xFC, 0x07, 0xF8, 0x7F, 0xC1, 0xFF, 0x07,
+  0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
+  0x80, 0x7F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xC7, 0xFE, 0x0F, 0xFC, 0xFF,
+  0x00, 0x7F, 0xBF, 0xE0, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x1F,
+  0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF8,
+  0x03, 0xFE, 0xFF, 0xC1, 0xFF, 0x9F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC,
+  0x3F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x00, 0x7F,
+  0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0xE0,
+  0x0F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFE, 0x1F, 0xF8,
+  0x7F, 0xE3, 0xFC, 0x03, 0xFC, 0xFF, 0x80, 0x7F, 0xDF, 0xE0, 0x07, 0xFB,
+  0xFC, 0x00, 0xFF, 0x7F, 0x80, 0x1F, 0xEF, 0xF0, 0x03, 0xFF, 0xFE, 0x00,
+  0x7F, 0xFF, 0xE0, 0x1F, 0xFF, 0xFC, 0x03, 0xFF, 0x7F, 0xE1, 0xFF, 0xEF,
+  0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+  0xFE, 0x0F, 0xFF, 0xBF, 0xC0, 0x3F, 0x87, 0xF8, 0x00, 0x01, 0xFE, 0x00,
+  0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F,
+  0xC2, 0x00, 0x1F, 0xF8, 0x78, 0x0F, 0xFE, 0x0F, 0xFF, 0xFF, 0x81, 0xFF,
+  0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x07, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0x00,
+  0x01, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F,
+  0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF,
+  0x3F, 0xCF, 0xE7, 0xF9, 0xFC, 0x7F, 0x1F, 0x87, 0xC3, 0xF0, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xFC, 0x00, 0x7F,
+  0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00,
+  0x1F, 0xFF, 0xC0, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xFF,
+  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFE,
+  0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xE0,
+  0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xC0, 0x00,
+  0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x00, 0x00,
+  0x07, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F,
+  0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+  0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF,
+  0xFC, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFC,
+  0x00, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x01,
+  0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xFC,
+  0x00, 0x7F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x00,
+  0xFE, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x07,
+  0xFC, 0x03, 0xFF, 0xFC, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
+  0x7F, 0xFF, 0xFB, 0xE0, 0x7F, 0xFC, 0x01, 0xFF, 0x80, 0x07, 0xF8, 0x00,
+  0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF8,
+  0x00, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x00, 0xFF,
+  0x80, 0x0F, 0xF8, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xF0,
+  0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07,
+  0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03,
+  0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF,
+  0xF0, 0x00, 0x0F, 0xF8, 0x07, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x80,
+  0x0F, 0xC0, 0x00, 0x0F, 0xE0, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x0F, 0x80,
+  0x00, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x07, 0x80, 0x1F, 0x8F,
+  0x87, 0x87, 0xC0, 0x3F, 0xF7, 0xC3, 0xE3, 0xC0, 0x3F, 0xFF, 0xE0, 0xF3,
+  0xE0, 0x3F, 0xFF, 0xF0, 0x79, 0xE0, 0x3F, 0x87, 0xF8, 0x1E, 0xF0, 0x1F,
+  0x81, 0xFC, 0x0F, 0xF0, 0x0F, 0x80, 0x7E, 0x07, 0xF8, 0x0F, 0x80, 0x1F,
+  0x03, 0xFC, 0x07, 0xC0, 0x0F, 0x81, 0xFE, 0x03, 0xE0, 0x07, 0xC0, 0xFF,
+  0x01, 0xF0, 0x03, 0xE0, 0x7F, 0x80, 0xF8, 0x01, 0xF0, 0x3F, 0xC0, 0x7C,
+  0x00, 0xF8, 0x3D, 0xE0, 0x3E, 0x00, 0x7C, 0x1E, 0xF0, 0x0F, 0x80, 0x7E,
+  0x1F, 0x3C, 0x07, 0xE0, 0x7F, 0x1F, 0x1E, 0x03, 0xF8, 0x7F, 0x9F, 0x0F,
+  0x00, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0x3F, 0xFF, 0xFF, 0x01, 0xF0, 0x0F,
+  0xFD, 0xFF, 0x00, 0xF8, 0x01, 0xF8, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x80, 0x01,
+  0xFC, 0x00, 0x00, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xF0, 0x00, 0x0F, 0xF8,
+  0x07, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF8,
+  0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
+  0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x01,
+  0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFC, 0x00,
+  0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x07, 0xF9, 0xFE, 0x00, 0x00, 0x7F, 0x9F,
+  0xE0, 0x00, 0x0F, 0xF9, 0xFF, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x0F,
+  0xF0, 0xFF, 0x00, 0x01, 0xFF, 0x0F, 0xF8, 0x00, 0x1F, 0xE0, 0x7F, 0x80,
+  0x01, 0xFE, 0x07, 0xF8, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x03, 0xFC, 0x03,
+  0xFC, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F,
+  0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
+  0xFF, 0x83, 0xFE, 0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0x7F, 0xC3, 0xFC,
+  0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFE,
+  0x7F, 0x80, 0x00, 0x1F, 0xEF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0,
+  0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0xFF,
+  0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0x80, 0xFF, 0xEF, 0xF8, 0x07,
+  0xFE, 0xFF, 0x80, 0x3F, 0xEF, 0xF8, 0x03, 0xFE, 0xFF, 0x80, 0x3F, 0xEF,
+  0xF8, 0x03, 0xFE, 0xFF, 0x80, 0x7F, 0xCF, 0xF8, 0x0F, 0xFC, 0xFF, 0xFF,
+  0xFF, 0x8F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0x80, 0x7F, 0xEF, 0xF8,
+  0x03, 0xFE, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x1F,
+  0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x07, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
+  0xF8, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00,
+  0x01, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF0, 0x7F,
+  0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFC, 0x7F, 0xFC, 0x07, 0xE3, 0xFF, 0x80,
+  0x07, 0x3F, 0xF0, 0x00, 0x09, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
+  0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFE,
+  0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00,
+  0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
+  0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F,
+  0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xE0,
+  0x00, 0x11, 0xFF, 0xC0, 0x03, 0x8F, 0xFF, 0x80, 0xFC, 0x3F, 0xFF, 0xFF,
+  0xE0, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xC0,
+  0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+  0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x80, 0xFF, 0xF8, 0xFF,
+  0x80, 0x3F, 0xFC, 0xFF, 0x80, 0x0F, 0xFC, 0xFF, 0x80, 0x07, 0xFE, 0xFF,
+  0x80, 0x07, 0xFE, 0xFF, 0x80, 0x03, 0xFE, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
+  0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
+  0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
+  0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
+  0x80, 0x03, 0xFE, 0xFF, 0x80, 0x07, 0xFE, 0xFF, 0x80, 0x07, 0xFE, 0xFF,
+  0x80, 0x0F, 0xFC, 0xFF, 0x80, 0x3F, 0xF8, 0xFF, 0x80, 0xFF, 0xF8, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF,
+  0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF,
+  0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF,
+  0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF,
+  0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF,
+  0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF,
+  0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF,
+  0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF,
+  0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF,
+  0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF,
+  0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF,
+  0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF,
+  0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x00,
+  0x03, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
+  0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF8,
+  0x3F, 0xFC, 0x01, 0xFC, 0x3F, 0xF8, 0x00, 0x1E, 0x3F, 0xF8, 0x00, 0x01,
+  0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
+  0x07, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
+  0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x07,
+  0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
+  0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x01, 0xFE, 0xFF, 0x80,
+  0x00, 0xFF, 0x7F, 0xC0, 0x00, 0x7F, 0xBF, 0xF0, 0x00, 0x3F, 0xCF, 0xFC,
+  0x00, 0x1F, 0xE7, 0xFF, 0x00, 0x0F, 0xF1, 0xFF, 0xC0, 0x07, 0xF8, 0x7F,
+  0xF8, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x01,
+  0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFE, 0x00,
+  0x00, 0x7F, 0xF0, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
+  0xFE, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
+  0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF,
+  0x80, 0x03, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC,
+  0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+  0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x01,
+  0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x0F,
+  0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7F,
+  0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
+  0xFF, 0x00, 0x07, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+  0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+  0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+  0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+  0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+  0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+  0xFF, 0x01, 0xFF, 0x03, 0xFF, 0x03, 0xFE, 0x0F, 0xFE, 0xFF, 0xFE, 0xFF,
+  0xFC, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 0xC0, 0xFE, 0x00, 0xFF, 0x80, 0x07,
+  0xFE, 0x3F, 0xE0, 0x03, 0xFF, 0x0F, 0xF8, 0x01, 0xFF, 0x83, 0xFE, 0x00,
+  0xFF, 0xC0, 0xFF, 0x80, 0x7F, 0xE0, 0x3F, 0xE0, 0x3F, 0xF0, 0x0F, 0xF8,
+  0x1F, 0xF8, 0x03, 0xFE, 0x0F, 0xFC, 0x00, 0xFF, 0x87, 0xFE, 0x00, 0x3F,
+  0xE3, 0xFF, 0x00, 0x0F, 0xF9, 0xFF, 0x80, 0x03, 0xFE, 0xFF, 0xC0, 0x00,
+  0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
+  0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
+  0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF,
+  0xF0, 0x00, 0x3F, 0xEF, 0xFE, 0x00, 0x0F, 0xF9, 0xFF, 0xC0, 0x03, 0xFE,
+  0x3F, 0xF8, 0x00, 0xFF, 0x87, 0xFF, 0x00, 0x3F, 0xE0, 0xFF, 0xE0, 0x0F,
+  0xF8, 0x1F, 0xFC, 0x03, 0xFE, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xF0,
+  0x3F, 0xE0, 0x0F, 0xFE, 0x0F, 0xF8, 0x01, 0xFF, 0xC3, 0xFE, 0x00, 0x3F,
+  0xF8, 0xFF, 0x80, 0x07, 0xFF, 0x3F, 0xE0, 0x00, 0xFF, 0xE0, 0xFF, 0x80,
+  0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80,
+  0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80,
+  0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80,
+  0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80,
+  0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80,
+  0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80,
+  0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00,
+  0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF,
+  0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F,
+  0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x07, 0xFF, 0xFF, 0xF7, 0xF0, 0x3F, 0xBF, 0xFF, 0xDF, 0xC0, 0xFE,
+  0xFF, 0xFF, 0x3F, 0x87, 0xF3, 0xFF, 0xFC, 0xFE, 0x1F, 0xCF, 0xFF, 0xF3,
+  0xF8, 0xFF, 0x3F, 0xFF, 0xC7, 0xF3, 0xF8, 0xFF, 0xFF, 0x1F, 0xCF, 0xE3,
+  0xFF, 0xFC, 0x3F, 0xFF, 0x0F, 0xFF, 0xF0, 0xFF, 0xFC, 0x3F, 0xFF, 0xC1,
+  0xFF, 0xE0, 0xFF, 0xFF, 0x07, 0xFF, 0x83, 0xFF, 0xFC, 0x0F, 0xFC, 0x0F,
+  0xFF, 0xF0, 0x3F, 0xF0, 0x3F, 0xFF, 0xC0, 0x7F, 0x80, 0xFF, 0xFF, 0x01,
+  0xFE, 0x03, 0xFF, 0xFC, 0x07, 0xF8, 0x0F, 0xFF, 0xF0, 0x0F, 0xC0, 0x3F,
+  0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00,
+  0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
+  0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0xC0,
+  0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x80,
+  0x0F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
+  0x7F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFC, 0x03,
+  0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xF7, 0xF8, 0x1F,
+  0xFF, 0xE7, 0xF0, 0x3F, 0xFF, 0xCF, 0xF0, 0x7F, 0xFF, 0x8F, 0xF0, 0xFF,
+  0xFF, 0x1F, 0xE1, 0xFF, 0xFE, 0x1F, 0xE3, 0xFF, 0xFC, 0x3F, 0xC7, 0xFF,
+  0xF8, 0x3F, 0xCF, 0xFF, 0xF0, 0x3F, 0x9F, 0xFF, 0xE0, 0x7F, 0xBF, 0xFF,
+  0xC0, 0x7F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFE,
+  0x01, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xF0,
+  0x03, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x80,
+  0x07, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x07,
+  0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x01,
+  0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC,
+  0x07, 0xFF, 0x83, 0xFF, 0xC0, 0xFF, 0xC0, 0x1F, 0xF8, 0x3F, 0xF0, 0x01,
+  0xFF, 0x87, 0xFC, 0x00, 0x1F, 0xF1, 0xFF, 0x00, 0x01, 0xFF, 0x3F, 0xE0,
+  0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x07, 0xFD, 0xFF, 0x00, 0x00, 0x7F, 0xFF,
+  0xE0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x3F,
+  0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
+  0x1F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
+  0x00, 0x0F, 0xFB, 0xFE, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x7F, 0xCF,
+  0xF8, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x03, 0xFE, 0x1F, 0xF8, 0x00, 0xFF,
+  0xC1, 0xFF, 0x80, 0x3F, 0xF0, 0x3F, 0xFC, 0x1F, 0xFE, 0x03, 0xFF, 0xFF,
+  0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
+  0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
+  0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF,
+  0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFE, 0xFF, 0x80, 0xFF,
+  0xEF, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF,
+  0x80, 0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x03,
+  0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x0F, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF,
+  0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+  0xFC, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
+  0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8,
+  0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
+  0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
+  0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF,
+  0xFC, 0x07, 0xFF, 0x83, 0xFF, 0xC0, 0xFF, 0xC0, 0x1F, 0xF8, 0x3F, 0xF0,
+  0x01, 0xFF, 0x87, 0xFC, 0x00, 0x1F, 0xF1, 0xFF, 0x00, 0x01, 0xFF, 0x3F,
+  0xE0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x07, 0xFD, 0xFF, 0x00, 0x00, 0x7F,
+  0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
+  0x3F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
+  0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF,
+  0xE0, 0x00, 0x0F, 0xFB, 0xFE, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x7F,
+  0xCF, 0xF8, 0x00, 0x0F, 0xF9, 0xFF, 0x80, 0x03, 0xFE, 0x1F, 0xF8, 0x00,
+  0xFF, 0xC1, 0xFF, 0x80, 0x3F, 0xF0, 0x3F, 0xFC, 0x1F, 0xFE, 0x03, 0xFF,
+  0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
+  0x3F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xE0,
+  0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x01,
+  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
+  0x00, 0x1F, 0xE0, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
+  0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF,
+  0xFF, 0xF8, 0x3F, 0xE0, 0x3F, 0xF8, 0x7F, 0xC0, 0x3F, 0xF0, 0xFF, 0x80,
+  0x3F, 0xE1, 0xFF, 0x00, 0x7F, 0xC3, 0xFE, 0x00, 0xFF, 0x87, 0xFC, 0x01,
+  0xFF, 0x0F, 0xF8, 0x03, 0xFE, 0x1F, 0xF0, 0x0F, 0xF8, 0x3F, 0xE0, 0x3F,
+  0xF0, 0x7F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8,
+  0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0,
+  0x1F, 0xF0, 0x7F, 0xF0, 0x3F, 0xE0, 0x3F, 0xF0, 0x7F, 0xC0, 0x7F, 0xE0,
+  0xFF, 0x80, 0x7F, 0xE1, 0xFF, 0x00, 0x7F, 0xC3, 0xFE, 0x00, 0xFF, 0xC7,
+  0xFC, 0x00, 0xFF, 0x8F, 0xF8, 0x01, 0xFF, 0x9F, 0xF0, 0x01, 0xFF, 0x3F,
+  0xE0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0xFF, 0x80, 0x07, 0xFD, 0xFF,
+  0x00, 0x07, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF,
+  0xFE, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F,
+  0xF8, 0x0F, 0xE7, 0xFC, 0x00, 0x1C, 0xFF, 0x00, 0x00, 0x9F, 0xE0, 0x00,
+  0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF,
+  0xF0, 0x00, 0x1F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE,
+  0x03, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xE0, 0x0F,
+  0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF,
+  0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00,
+  0x0F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x01, 0xFF, 0xBF, 0xFF, 0xFF, 0xF7,
+  0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF,
+  0xE0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
+  0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
+  0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
+  0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01,
+  0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F,
+  0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F,
+  0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFE,
+  0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0,
+  0x00, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F,
+  0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF,
+  0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF,
+  0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0,
+  0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
+  0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F,
+  0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF,
+  0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF,
+  0x80, 0x07, 0xFF, 0xFF, 0x00, 0x3F, 0xF7, 0xFC, 0x00, 0xFF, 0x9F, 0xF8,
+  0x07, 0xFE, 0x7F, 0xF0, 0x3F, 0xF0, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
+  0xFE, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xF8,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF7, 0xF8, 0x00,
+  0x01, 0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFE, 0x3F,
+  0xE0, 0x00, 0x7F, 0xC3, 0xFE, 0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0x7F,
+  0xC1, 0xFF, 0x00, 0x0F, 0xF8, 0x1F, 0xF0, 0x00, 0xFF, 0x80, 0xFF, 0x00,
+  0x0F, 0xF0, 0x0F, 0xF8, 0x01, 0xFF, 0x00, 0xFF, 0x80, 0x1F, 0xF0, 0x07,
+  0xF8, 0x01, 0xFE, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x07, 0xFC, 0x03, 0xFE,
+  0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x03, 0xFE, 0x07, 0xFC, 0x00, 0x1F, 0xE0,
+  0x7F, 0x80, 0x01, 0xFF, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x00,
+  0xFF, 0x0F, 0xF0, 0x00, 0x0F, 0xF9, 0xFF, 0x00, 0x00, 0xFF, 0x9F, 0xF0,
+  0x00, 0x07, 0xF9, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
+  0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
+  0x1F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x80,
+  0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x7F,
+  0xE0, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x07, 0xFC,
+  0x00, 0x7F, 0xDF, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xCF, 0xF0, 0x03, 0xFF,
+  0x80, 0x1F, 0xE7, 0xFC, 0x01, 0xFF, 0xC0, 0x1F, 0xF3, 0xFE, 0x00, 0xFF,
+  0xE0, 0x0F, 0xF8, 0xFF, 0x00, 0x7F, 0xF0, 0x07, 0xF8, 0x7F, 0x80, 0x7F,
+  0xFC, 0x03, 0xFC, 0x3F, 0xE0, 0x3F, 0x7E, 0x01, 0xFE, 0x1F, 0xF0, 0x1F,
+  0xBF, 0x01, 0xFF, 0x07, 0xF8, 0x0F, 0xDF, 0x80, 0xFF, 0x83, 0xFC, 0x07,
+  0xEF, 0xE0, 0x7F, 0x81, 0xFE, 0x07, 0xE3, 0xF0, 0x3F, 0xC0, 0xFF, 0x83,
+  0xF1, 0xF8, 0x3F, 0xE0, 0x7F, 0xC1, 0xF8, 0xFC, 0x1F, 0xF0, 0x1F, 0xE0,
+  0xFC, 0x7E, 0x0F, 0xF0, 0x0F, 0xF0, 0xFE, 0x1F, 0x87, 0xF8, 0x07, 0xFC,
+  0x7E, 0x0F, 0xC7, 0xFC, 0x03, 0xFE, 0x3F, 0x07, 0xE3, 0xFE, 0x00, 0xFF,
+  0x1F, 0x83, 0xF1, 0xFE, 0x00, 0x7F, 0x9F, 0xC1, 0xFC, 0xFF, 0x00, 0x3F,
+  0xEF, 0xC0, 0x7E, 0xFF, 0x80, 0x1F, 0xF7, 0xE0, 0x3F, 0x7F, 0xC0, 0x07,
+  0xFB, 0xF0, 0x1F, 0xBF, 0xC0, 0x03, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x01,
+  0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x00,
+  0x3F, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x00, 0x7F, 0xFC, 0x00,
+  0x0F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0x00,
+  0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 0x80,
+  0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xDF,
+  0xF0, 0x00, 0x3F, 0xE3, 0xFE, 0x00, 0x1F, 0xF0, 0xFF, 0xC0, 0x0F, 0xFC,
+  0x1F, 0xF8, 0x07, 0xFE, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0xFF,
+  0x80, 0x1F, 0xF8, 0x7F, 0xE0, 0x03, 0xFE, 0x1F, 0xF0, 0x00, 0x7F, 0xCF,
+  0xF8, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x7F,
+  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00,
+  0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
+  0x03, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x80,
+  0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFC, 0xFF,
+  0x80, 0x03, 0xFF, 0x3F, 0xF0, 0x00, 0xFF, 0x87, 0xFC, 0x00, 0x7F, 0xC0,
+  0xFF, 0x80, 0x3F, 0xF0, 0x3F, 0xF0, 0x0F, 0xF8, 0x07, 0xFC, 0x07, 0xFC,
+  0x00, 0xFF, 0x83, 0xFF, 0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x07, 0xFC, 0x7F,
+  0xC0, 0x00, 0xFF, 0xBF, 0xE0, 0x00, 0x1F, 0xF0, 0xFF, 0xC0, 0x00, 0x7F,
+  0xEF, 0xFC, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x03, 0xFE, 0x1F, 0xF8, 0x00,
+  0xFF, 0xC1, 0xFF, 0x80, 0x3F, 0xF0, 0x1F, 0xF0, 0x07, 0xFC, 0x03, 0xFF,
+  0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x7F, 0xE0, 0x03, 0xFE, 0x0F, 0xF8, 0x00,
+  0x7F, 0xE3, 0xFF, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x7F, 0xDF, 0xF0,
+  0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF,
+  0xE0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x01,
+  0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
+  0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x00,
+  0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF,
+  0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
+  0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
+  0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80,
+  0x00, 0x7F, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
+  0x9F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xE0,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00,
+  0x07, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07,
+  0xFE, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFE,
+  0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x00,
+  0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00,
+  0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF,
+  0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF,
+  0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F,
+  0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F,
+  0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03,
+  0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0,
+  0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF8,
+  0x00, 0x7C, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x01, 0xF0, 0x00,
+  0xF8, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x01, 0xF0,
+  0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03,
+  0xE0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x07, 0xC0,
+  0x03, 0xE0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x07,
+  0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00,
+  0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF,
+  0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F,
+  0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F,
+  0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03,
+  0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0,
+  0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00,
+  0x1F, 0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x3F,
+  0xCF, 0xF0, 0x01, 0xFE, 0x1F, 0xE0, 0x0F, 0xF0, 0x3F, 0xC0, 0x7F, 0x00,
+  0x3F, 0x83, 0xF8, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0xFE, 0xFC, 0x00, 0x00,
+  0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x03, 0xF8, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xE0, 0x0F,
+  0x80, 0x3E, 0x00, 0xF8, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x03, 0xFF,
+  0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x0F, 0x00, 0x7F, 0xE2,
+  0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F,
+  0xF0, 0x00, 0x03, 0xFC, 0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC7, 0xFF,
+  0xFF, 0xF3, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
+  0xE0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x00, 0x7F,
+  0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x1F, 0xFD, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
+  0xFF, 0xCF, 0xFF, 0xEF, 0xF0, 0xFF, 0xE3, 0xFC, 0x0F, 0xE0, 0x00, 0xFF,
+  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x00, 0xFF, 0x1F,
+  0xFC, 0x0F, 0xF3, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0x0F, 0xFC, 0xFF, 0xC0, 0x7F, 0xEF, 0xF8,
+  0x03, 0xFE, 0xFF, 0x80, 0x3F, 0xEF, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x1F,
+  0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF,
+  0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0x03,
+  0xFF, 0xFF, 0x80, 0x3F, 0xEF, 0xFC, 0x07, 0xFE, 0xFF, 0xE0, 0xFF, 0xCF,
+  0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x8F, 0xF7, 0xFF, 0xF0, 0xFF, 0x3F,
+  0xFE, 0x0F, 0xF1, 0xFF, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xF8,
+  0x03, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF1, 0xFF, 0xFF, 0xE7,
+  0xFF, 0xFF, 0xCF, 0xFE, 0x03, 0xBF, 0xF8, 0x01, 0x7F, 0xE0, 0x00, 0xFF,
+  0x80, 0x03, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0,
+  0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x80,
+  0x01, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x27, 0xFF, 0x01,
+  0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC,
+  0x07, 0xFF, 0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x0F, 0xF0, 0x0F, 0xE0, 0xFF, 0x03, 0xFF, 0x8F, 0xF0, 0x7F, 0xFC, 0xFF,
+  0x1F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF,
+  0x07, 0xFF, 0x7F, 0xE0, 0x3F, 0xF7, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x1F,
+  0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
+  0x80, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 0x00,
+  0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0x7F, 0xC0, 0x1F, 0xF7,
+  0xFE, 0x03, 0xFF, 0x7F, 0xF0, 0x7F, 0xF3, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF,
+  0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xEF, 0xF0, 0x3F, 0xF8, 0xFF,
+  0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x07,
+  0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x83, 0xFF, 0x07,
+  0xFC, 0x3F, 0xC0, 0x3F, 0xC7, 0xF8, 0x01, 0xFE, 0x7F, 0x80, 0x0F, 0xE7,
+  0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF8,
+  0x00, 0x00, 0x7F, 0xC0, 0x00, 0x23, 0xFE, 0x00, 0x0E, 0x3F, 0xF0, 0x0F,
+  0xE1, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFE, 0x01,
+  0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x1F, 0xFF, 0x03,
+  0xFF, 0xF0, 0x7F, 0xFF, 0x07, 0xFF, 0xF0, 0xFF, 0x80, 0x0F, 0xF0, 0x00,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE,
+  0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0x0F, 0xF0,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
+  0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0x0F, 0xFF, 0xEF, 0xF1, 0xFF,
+  0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x7F, 0xF0, 0x7F,
+  0xF7, 0xFE, 0x03, 0xFF, 0x7F, 0xC0, 0x1F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
+  0x80, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 0x00,
+  0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
+  0xFC, 0x01, 0xFF, 0x7F, 0xC0, 0x1F, 0xF7, 0xFE, 0x03, 0xFF, 0x7F, 0xF0,
+  0x7F, 0xF3, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF,
+  0x0F, 0xFF, 0xCF, 0xF0, 0x3F, 0xF8, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFE, 0x10, 0x00, 0x3F,
+  0xE1, 0xE0, 0x0F, 0xFC, 0x1F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xF0, 0x1F,
+  0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0x00,
+  0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x3F, 0xC1, 0xFC, 0x0F, 0xF1, 0xFF, 0xC3, 0xFC, 0xFF,
+  0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFB, 0xFF,
+  0xC3, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x03, 0xFF,
+  0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03,
+  0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0,
+  0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF,
+  0xF0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0F,
+  0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F,
+  0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03,
+  0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0,
+  0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0,
+  0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC,
+  0x0F, 0xF0, 0x3F, 0xC1, 0xFF, 0x0F, 0xFB, 0xFF, 0xEF, 0xFF, 0x3F, 0xF8,
+  0xFF, 0xC3, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0xCF, 0xF0, 0x0F, 0xF8, 0xFF, 0x01,
+  0xFF, 0x0F, 0xF0, 0x3F, 0xE0, 0xFF, 0x07, 0xFC, 0x0F, 0xF0, 0xFF, 0x80,
+  0xFF, 0x1F, 0xF0, 0x0F, 0xF3, 0xFE, 0x00, 0xFF, 0x7F, 0xC0, 0x0F, 0xFF,
+  0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0x00,
+  0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFC, 0x00, 0xFF,
+  0x7F, 0xE0, 0x0F, 0xF3, 0xFF, 0x00, 0xFF, 0x1F, 0xF8, 0x0F, 0xF0, 0xFF,
+  0xC0, 0xFF, 0x07, 0xFE, 0x0F, 0xF0, 0x3F, 0xF0, 0xFF, 0x01, 0xFF, 0x8F,
+  0xF0, 0x0F, 0xFC, 0xFF, 0x00, 0x7F, 0xEF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07,
+  0xE0, 0x07, 0xF0, 0x3F, 0xC7, 0xFE, 0x07, 0xFF, 0x0F, 0xF7, 0xFF, 0xE3,
+  0xFF, 0xE3, 0xFF, 0xFF, 0xF9, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0x1F, 0xFF, 0x0F, 0xFF, 0xFF,
+  0x03, 0xFF, 0x81, 0xFF, 0xFF, 0x80, 0x7F, 0xC0, 0x3F, 0xFF, 0xE0, 0x1F,
+  0xF0, 0x0F, 0xFF, 0xF0, 0x07, 0xF8, 0x03, 0xFF, 0xFC, 0x01, 0xFE, 0x00,
+  0xFF, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xFF, 0xC0, 0x1F, 0xE0, 0x0F, 0xFF,
+  0xF0, 0x07, 0xF8, 0x03, 0xFF, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0xFF, 0x00,
+  0x7F, 0x80, 0x3F, 0xFF, 0xC0, 0x1F, 0xE0, 0x0F, 0xFF, 0xF0, 0x07, 0xF8,
+  0x03, 0xFF, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0x7F, 0x80, 0x3F,
+  0xFF, 0xC0, 0x1F, 0xE0, 0x0F, 0xFF, 0xF0, 0x07, 0xF8, 0x03, 0xFF, 0xFC,
+  0x01, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xFF, 0xC0, 0x1F,
+  0xE0, 0x0F, 0xFF, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x00, 0x07, 0xF0, 0x3F,
+  0xC7, 0xFF, 0x0F, 0xF3, 0xFF, 0xE3, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+  0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x80,
+  0x3F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
+  0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0xFF,
+  0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00,
+  0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC,
+  0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFC,
+  0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0xFF,
+  0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFC, 0x3F, 0xF0, 0xFF,
+  0xC7, 0xFE, 0x07, 0xFE, 0x7F, 0xC0, 0x3F, 0xEF, 0xFC, 0x03, 0xFE, 0xFF,
+  0x80, 0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x01,
+  0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
+  0xF8, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xE7, 0xFC, 0x03, 0xFE, 0x7F, 0xE0,
+  0x7F, 0xE3, 0xFF, 0x0F, 0xFC, 0x3F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x07,
+  0xFC, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xF1, 0xFF, 0xC0, 0xFF, 0x3F, 0xFF,
+  0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF,
+  0xE0, 0xFF, 0xCF, 0xFC, 0x07, 0xFE, 0xFF, 0x80, 0x3F, 0xEF, 0xF8, 0x03,
+  0xFE, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
+  0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00,
+  0x1F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x03, 0xFE,
+  0xFF, 0xC0, 0x7F, 0xEF, 0xFE, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
+  0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0x0F, 0xF7, 0xFF, 0xE0, 0xFF, 0x1F, 0xFC,
+  0x0F, 0xF0, 0x7F, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0x0F, 0xFF, 0xEF, 0xF1, 0xFF,
+  0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x7F, 0xF0, 0x7F,
+  0xF7, 0xFE, 0x03, 0xFF, 0x7F, 0xC0, 0x1F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
+  0x80, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 0x00,
+  0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
+  0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x1F, 0xF7, 0xFC, 0x01, 0xFF, 0x7F, 0xE0,
+  0x3F, 0xF3, 0xFF, 0x07, 0xFF, 0x3F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF,
+  0x1F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFE, 0xFF, 0x03, 0xFF, 0x8F, 0xF0, 0x0F,
+  0xE0, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x07,
+  0xFF, 0xE3, 0xFF, 0xFC, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0xFF, 0x80, 0x1F, 0xF0, 0x03, 0xFE, 0x00,
+  0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00,
+  0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01,
+  0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03,
+  0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF, 0xE3,
+  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x9F, 0xF0, 0x1F, 0x3F, 0xC0, 0x02, 0x7F,
+  0x80, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0xF0, 0x07, 0xFF,
+  0xFE, 0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF,
+  0xFE, 0x03, 0xFF, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x0F,
+  0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xFE, 0x01, 0xFF, 0x7F, 0xFF, 0xFE,
+  0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x80, 0xFF, 0xF8, 0x00,
+  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xFF, 0x07, 0xFF,
+  0xF0, 0x7F, 0xFF, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x00, 0x7F, 0xF0, 0xFF,
+  0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0xFF,
+  0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00,
+  0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC,
+  0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF,
+  0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x07,
+  0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xC1, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0x3F, 0xC3, 0xFF, 0x8F, 0xF0,
+  0x3F, 0x80, 0x00, 0xFF, 0x00, 0x07, 0xFB, 0xFC, 0x00, 0x7F, 0x9F, 0xE0,
+  0x03, 0xFC, 0xFF, 0x00, 0x1F, 0xE3, 0xFC, 0x01, 0xFE, 0x1F, 0xE0, 0x0F,
+  0xF0, 0xFF, 0x00, 0x7F, 0x83, 0xFC, 0x07, 0xF8, 0x1F, 0xE0, 0x3F, 0xC0,
+  0x7F, 0x83, 0xFC, 0x03, 0xFC, 0x1F, 0xE0, 0x1F, 0xE0, 0xFF, 0x00, 0x7F,
+  0x8F, 0xF0, 0x03, 0xFC, 0x7F, 0x80, 0x0F, 0xE3, 0xF8, 0x00, 0x7F, 0xBF,
+  0xC0, 0x03, 0xFD, 0xFE, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0x7F, 0xFF, 0x00,
+  0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x7F, 0xFC, 0x00, 0x01,
+  0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x7F, 0x80, 0xFF, 0x01, 0xFE, 0x7F, 0x80, 0xFF, 0x01, 0xFE, 0x7F, 0x81,
+  0xFF, 0x81, 0xFE, 0x7F, 0x81, 0xFF, 0x81, 0xFE, 0x3F, 0xC1, 0xFF, 0x83,
+  0xFC, 0x3F, 0xC1, 0xFF, 0x83, 0xFC, 0x3F, 0xC1, 0xFF, 0x83, 0xFC, 0x3F,
+  0xC3, 0xFF, 0xC3, 0xFC, 0x1F, 0xC3, 0xE7, 0xC7, 0xF8, 0x1F, 0xE3, 0xE7,
+  0xC7, 0xF8, 0x1F, 0xE3, 0xE7, 0xC7, 0xF8, 0x0F, 0xE7, 0xE7, 0xE7, 0xF8,
+  0x0F, 0xE7, 0xC3, 0xEF, 0xF0, 0x0F, 0xF7, 0xC3, 0xEF, 0xF0, 0x0F, 0xF7,
+  0xC3, 0xEF, 0xF0, 0x07, 0xFF, 0xC3, 0xFF, 0xE0, 0x07, 0xFF, 0xC3, 0xFF,
+  0xE0, 0x07, 0xFF, 0x81, 0xFF, 0xE0, 0x07, 0xFF, 0x81, 0xFF, 0xE0, 0x03,
+  0xFF, 0x81, 0xFF, 0xC0, 0x03, 0xFF, 0x81, 0xFF, 0xC0, 0x03, 0xFF, 0x00,
+  0xFF, 0xC0, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x00, 0xFF, 0x80,
+  0xFF, 0x80, 0x0F, 0xFB, 0xFE, 0x00, 0xFF, 0x8F, 0xF8, 0x0F, 0xF8, 0x3F,
+  0xE0, 0xFF, 0x81, 0xFF, 0x07, 0xFC, 0x07, 0xFC, 0x7F, 0xC0, 0x1F, 0xF7,
+  0xFC, 0x00, 0x7F, 0xBF, 0xC0, 0x03, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xE0,
+  0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00,
+  0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x00, 0x01, 0xFF,
+  0xFC, 0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFF, 0x7F, 0xC0, 0x0F, 0xF1, 0xFE,
+  0x00, 0xFF, 0x8F, 0xF8, 0x0F, 0xF8, 0x3F, 0xE0, 0x7F, 0x80, 0xFF, 0x07,
+  0xF8, 0x07, 0xFC, 0x7F, 0xC0, 0x1F, 0xF7, 0xFC, 0x00, 0x7F, 0xC0, 0xFF,
+  0x00, 0x07, 0xFB, 0xFC, 0x00, 0x7F, 0x9F, 0xE0, 0x03, 0xFC, 0xFF, 0x80,
+  0x1F, 0xE3, 0xFC, 0x01, 0xFE, 0x1F, 0xE0, 0x0F, 0xF0, 0x7F, 0x80, 0x7F,
+  0x83, 0xFC, 0x07, 0xF8, 0x0F, 0xE0, 0x3F, 0xC0, 0x7F, 0x81, 0xFC, 0x03,
+  0xFC, 0x1F, 0xE0, 0x0F, 0xF0, 0xFF, 0x00, 0x7F, 0x87, 0xF0, 0x01, 0xFC,
+  0x7F, 0x80, 0x0F, 0xF3, 0xFC, 0x00, 0x3F, 0x9F, 0xC0, 0x01, 0xFF, 0xFE,
+  0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xF8, 0x00,
+  0x07, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07,
+  0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8,
+  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00,
+  0x01, 0xFE, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x7F,
+  0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xFF,
+  0xFE, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
+  0xEF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0,
+  0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00,
+  0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F,
+  0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x3F, 0xFF,
+  0x00, 0xFF, 0xFC, 0x07, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x80, 0x01,
+  0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE,
+  0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x03, 0xFE, 0x00,
+  0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0xFF, 0xF8, 0x03, 0xFF,
+  0x80, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF8,
+  0x00, 0x3F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00,
+  0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F,
+  0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFF,
+  0xC0, 0x3F, 0xFF, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x0F,
+  0xFF, 0x80, 0x3F, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x3F,
+  0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0,
+  0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00,
+  0x7F, 0x80, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x3F,
+  0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xF0, 0x07, 0xFF, 0xC0, 0x3F, 0xFF,
+  0x00, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x80, 0x01,
+  0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE,
+  0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x03, 0xFE, 0x00,
+  0x1F, 0xF8, 0x0F, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0xFF, 0xF8, 0x03, 0xFF,
+  0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
+  0x47, 0xFF, 0x80, 0x0E, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xDC, 0x00, 0x7F, 0xF8, 0xC0, 0x00,
+  0x7F, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+const GFXglyph DejaVuSans_Bold24pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  16,    0,    0 },   // 0x20 ' '
+  {     1,   8,  34,  21,    7,  -33 },   // 0x21 '!'
+  {    35,  15,  13,  24,    4,  -33 },   // 0x22 '"'
+  {    60,  33,  34,  39,    3,  -33 },   // 0x23 '#'
+  {   201,  26,  43,  33,    4,  -35 },   // 0x24 '$'
+  {   341,  44,  36,  47,    2,  -34 },   // 0x25 '%'
+  {   539,  36,  36,  41,    2,  -34 },   // 0x26 '&'
+  {   701,   5,  13,  14,    4,  -33 },   // 0x27 '''
+  {   710,  14,  42,  21,    4,  -35 },   // 0x28 '('
+  {   784,  14,  42,  21,    4,  -35 },   // 0x29 ')'
+  {   858,  22,  22,  25,    1,  -34 },   // 0x2A '*'
+  {   919,  29,  29,  39,    5,  -28 },   // 0x2B '+'
+  {  1025,  10,  16,  18,    3,   -8 },   // 0x2C ','
+  {  1045,  14,   7,  20,    3,  -16 },   // 0x2D '-'
+  {  1058,   8,   9,  18,    5,   -8 },   // 0x2E '.'
+  {  1067,  17,  39,  17,    0,  -33 },   // 0x2F '/'
+  {  1150,  28,  36,  33,    2,  -34 },   // 0x30 '0'
+  {  1276,  24,  34,  33,    5,  -33 },   // 0x31 '1'
+  {  1378,  25,  35,  33,    4,  -34 },   // 0x32 '2'
+  {  1488,  26,  36,  33,    3,  -34 },   // 0x33 '3'
+  {  1605,  29,  34,  33,    2,  -33 },   // 0x34 '4'
+  {  1729,  26,  35,  33,    4,  -33 },   // 0x35 '5'
+  {  1843,  27,  36,  33,    3,  -34 },   // 0x36 '6'
+  {  1965,  26,  34,  33,    3,  -33 },   // 0x37 '7'
+  {  2076,  27,  36,  33,    3,  -34 },   // 0x38 '8'
+  {  2198,  27,  36,  33,    2,  -34 },   // 0x39 '9'
+  {  2320,   8,  26,  19,    5,  -25 },   // 0x3A ':'
+  {  2346,  10,  33,  19,    3,  -25 },   // 0x3B ';'
+  {  2388,  29,  27,  39,    5,  -27 },   // 0x3C '<'
+  {  2486,  29,  15,  39,    5,  -21 },   // 0x3D '='
+  {  2541,  29,  27,  39,    5,  -27 },   // 0x3E '>'
+  {  2639,  21,  34,  27,    3,  -33 },   // 0x3F '?'
+  {  2729,  41,  41,  47,    3,  -32 },   // 0x40 '@'
+  {  2940,  36,  34,  36,    0,  -33 },   // 0x41 'A'
+  {  3093,  28,  34,  36,    4,  -33 },   // 0x42 'B'
+  {  3212,  29,  36,  35,    2,  -34 },   // 0x43 'C'
+  {  3343,  32,  34,  39,    4,  -33 },   // 0x44 'D'
+  {  3479,  24,  34,  32,    4,  -33 },   // 0x45 'E'
+  {  3581,  24,  34,  32,    4,  -33 },   // 0x46 'F'
+  {  3683,  33,  36,  39,    2,  -34 },   // 0x47 'G'
+  {  3832,  31,  34,  39,    4,  -33 },   // 0x48 'H'
+  {  3964,   9,  34,  17,    4,  -33 },   // 0x49 'I'
+  {  4003,  16,  43,  17,   -3,  -33 },   // 0x4A 'J'
+  {  4089,  34,  34,  36,    4,  -33 },   // 0x4B 'K'
+  {  4234,  24,  34,  30,    4,  -33 },   // 0x4C 'L'
+  {  4336,  38,  34,  47,    4,  -33 },   // 0x4D 'M'
+  {  4498,  31,  34,  39,    4,  -33 },   // 0x4E 'N'
+  {  4630,  35,  36,  40,    2,  -34 },   // 0x4F 'O'
+  {  4788,  28,  34,  34,    4,  -33 },   // 0x50 'P'
+  {  4907,  35,  42,  40,    2,  -34 },   // 0x51 'Q'
+  {  5091,  31,  34,  36,    4,  -33 },   // 0x52 'R'
+  {  5223,  27,  36,  34,    3,  -34 },   // 0x53 'S'
+  {  5345,  31,  34,  32,    1,  -33 },   // 0x54 'T'
+  {  5477,  30,  35,  38,    4,  -33 },   // 0x55 'U'
+  {  5609,  36,  34,  36,    0,  -33 },   // 0x56 'V'
+  {  5762,  49,  34,  52,    1,  -33 },   // 0x57 'W'
+  {  5971,  34,  34,  36,    1,  -33 },   // 0x58 'X'
+  {  6116,  35,  34,  34,    0,  -33 },   // 0x59 'Y'
+  {  6265,  30,  34,  34,    2,  -33 },   // 0x5A 'Z'
+  {  6393,  14,  42,  21,    4,  -35 },   // 0x5B '['
+  {  6467,  17,  39,  17,    0,  -33 },   // 0x5C '\'
+  {  6550,  14,  42,  21,    4,  -35 },   // 0x5D ']'
+  {  6624,  30,  13,  39,    5,  -33 },   // 0x5E '^'
+  {  6673,  24,   4,  24,    0,    8 },   // 0x5F '_'
+  {  6685,  13,   9,  24,    2,  -37 },   // 0x60 '`'
+  {  6700,  26,  28,  32,    2,  -26 },   // 0x61 'a'
+  {  6791,  28,  37,  34,    4,  -35 },   // 0x62 'b'
+  {  6921,  23,  28,  28,    2,  -26 },   // 0x63 'c'
+  {  7002,  28,  37,  34,    2,  -35 },   // 0x64 'd'
+  {  7132,  28,  28,  32,    2,  -26 },   // 0x65 'e'
+  {  7230,  20,  36,  20,    1,  -35 },   // 0x66 'f'
+  {  7320,  28,  37,  34,    2,  -26 },   // 0x67 'g'
+  {  7450,  26,  36,  33,    4,  -35 },   // 0x68 'h'
+  {  7567,   8,  36,  16,    4,  -35 },   // 0x69 'i'
+  {  7603,  14,  46,  16,   -2,  -35 },   // 0x6A 'j'
+  {  7684,  28,  36,  31,    4,  -35 },   // 0x6B 'k'
+  {  7810,   8,  36,  16,    4,  -35 },   // 0x6C 'l'
+  {  7846,  42,  27,  49,    4,  -26 },   // 0x6D 'm'
+  {  7988,  26,  27,  33,    4,  -26 },   // 0x6E 'n'
+  {  8076,  28,  28,  32,    2,  -26 },   // 0x6F 'o'
+  {  8174,  28,  37,  34,    4,  -26 },   // 0x70 'p'
+  {  8304,  28,  37,  34,    2,  -26 },   // 0x71 'q'
+  {  8434,  19,  27,  23,    4,  -26 },   // 0x72 'r'
+  {  8499,  23,  28,  28,    2,  -26 },   // 0x73 's'
+  {  8580,  20,  33,  22,    1,  -32 },   // 0x74 't'
+  {  8663,  26,  27,  33,    4,  -25 },   // 0x75 'u'
+  {  8751,  29,  26,  31,    1,  -25 },   // 0x76 'v'
+  {  8846,  40,  26,  43,    2,  -25 },   // 0x77 'w'
+  {  8976,  29,  26,  30,    1,  -25 },   // 0x78 'x'
+  {  9071,  29,  36,  31,    1,  -25 },   // 0x79 'y'
+  {  9202,  23,  26,  27,    2,  -25 },   // 0x7A 'z'
+  {  9277,  22,  43,  33,    6,  -35 },   // 0x7B '{'
+  {  9396,   5,  47,  17,    6,  -35 },   // 0x7C '|'
+  {  9426,  22,  43,  33,    6,  -35 },   // 0x7D '}'
+  {  9545,  29,  10,  39,    5,  -19 } }; // 0x7E '~'
+
+const GFXfont DejaVuSans_Bold24pt7b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Bold24pt7bBitmaps,
+  (GFXglyph *)DejaVuSans_Bold24pt7bGlyphs,
+  0x20, 0x7E, 55 };
+
+// Approx. 10254 bytes
@@ -0,0 +1,230 @@
+// DejaVuSans-Bold.ttf at 9pt, converted with Adafruit GFX fontconvert (7-bit, 141 dpi).
+// Fixed font for tools/golden_check.cpp; DejaVu fonts license in LICENSE.
+#pragma once
+#include <Adafruit_GFX.h>
+
+const uint8_t DejaVuSans_Bold9pt7bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xE3, 0xFE, 0xCF, 0x3C, 0xF3, 0xCC, 0x06, 0x60,
+  0x33, 0x03, 0x18, 0x18, 0xC7, 0xFF, 0xBF, 0xFC, 0x63, 0x03, 0x18, 0xFF,
+  0xF7, 0xFF, 0x8C, 0x60, 0x66, 0x03, 0x30, 0x00, 0x08, 0x02, 0x03, 0xF1,
+  0xFE, 0xE8, 0xBA, 0x0F, 0x83, 0xFC, 0x3F, 0x83, 0xF0, 0x9E, 0x27, 0xFF,
+  0x9F, 0xC0, 0x80, 0x20, 0x08, 0x00, 0x7C, 0x1C, 0x63, 0x0C, 0x31, 0x8C,
+  0x18, 0xCE, 0x0C, 0x66, 0x06, 0x36, 0x01, 0xF7, 0x7C, 0x03, 0x63, 0x03,
+  0x31, 0x83, 0x98, 0xC1, 0x8C, 0x61, 0x82, 0x21, 0xC1, 0xF0, 0x0F, 0x80,
+  0xFF, 0x03, 0x84, 0x0E, 0x00, 0x1C, 0x00, 0xF8, 0xE7, 0xF3, 0xB9, 0xEC,
+  0xE3, 0xF3, 0x87, 0x8F, 0x0E, 0x1F, 0xFC, 0x1F, 0x78, 0xFF, 0xC0, 0x39,
+  0x9C, 0xE6, 0x73, 0x9C, 0xE7, 0x38, 0xC7, 0x38, 0xC7, 0xE3, 0x1C, 0xE3,
+  0x1C, 0xE7, 0x39, 0xCE, 0x67, 0x39, 0x9C, 0x0C, 0x33, 0x3F, 0xFC, 0xFC,
+  0x3F, 0x3F, 0xFC, 0xCC, 0x30, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
+  0x0F, 0xFF, 0xFF, 0xF0, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x77,
+  0x77, 0xEC, 0xFF, 0xFF, 0xC0, 0xFF, 0x80, 0x06, 0x1C, 0x30, 0x61, 0xC3,
+  0x06, 0x1C, 0x30, 0x61, 0xC3, 0x06, 0x1C, 0x30, 0x00, 0x1F, 0x07, 0xF1,
+  0xC7, 0x70, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1D, 0xC7,
+  0x1F, 0xC1, 0xF0, 0x7C, 0x7E, 0x37, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38,
+  0x1C, 0x0E, 0x07, 0x1F, 0xFF, 0xF8, 0x7F, 0x3F, 0xEC, 0x3E, 0x07, 0x01,
+  0xC0, 0x70, 0x3C, 0x1E, 0x1F, 0x0F, 0x87, 0xC3, 0xFF, 0xFF, 0xC0, 0x7F,
+  0x3F, 0xE8, 0x3C, 0x07, 0x03, 0xCF, 0xC3, 0xF8, 0x0F, 0x01, 0xC0, 0x78,
+  0x3F, 0xFE, 0x7E, 0x00, 0x07, 0x81, 0xF0, 0x7E, 0x0D, 0xC3, 0x38, 0xE7,
+  0x18, 0xE6, 0x1C, 0xFF, 0xFF, 0xFC, 0x0E, 0x01, 0xC0, 0x38, 0x7F, 0x9F,
+  0xE7, 0x01, 0xC0, 0x7F, 0x1F, 0xE4, 0x3C, 0x07, 0x01, 0xC0, 0x78, 0x3F,
+  0xFE, 0x7E, 0x00, 0x1F, 0x0F, 0xE7, 0x09, 0x80, 0xFF, 0x3F, 0xEF, 0x3F,
+  0x87, 0xE1, 0xF8, 0x77, 0x3D, 0xFE, 0x1F, 0x00, 0xFF, 0xFF, 0xF0, 0x3C,
+  0x0E, 0x07, 0x81, 0xC0, 0x70, 0x38, 0x0E, 0x07, 0x01, 0xC0, 0xF0, 0x38,
+  0x00, 0x3F, 0x1F, 0xEE, 0x1F, 0x87, 0xE1, 0xDF, 0xE7, 0xFB, 0xCF, 0xE1,
+  0xF8, 0x7F, 0x3D, 0xFE, 0x3F, 0x00, 0x3E, 0x1F, 0xEF, 0x3B, 0x87, 0xE1,
+  0xF8, 0x7F, 0x3D, 0xFF, 0x3F, 0xC0, 0x64, 0x39, 0xFC, 0x3E, 0x00, 0xFF,
+  0x80, 0x07, 0xFC, 0x77, 0x70, 0x00, 0x07, 0x77, 0x7E, 0xC0, 0x00, 0x20,
+  0x3C, 0x3F, 0x3F, 0x0F, 0x01, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xE0, 0x04,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x80, 0x1E, 0x01,
+  0xF8, 0x07, 0xE0, 0x1E, 0x03, 0xC3, 0xF3, 0xF0, 0xF0, 0x10, 0x00, 0x7C,
+  0xFE, 0x87, 0x07, 0x07, 0x0E, 0x1C, 0x38, 0x38, 0x00, 0x38, 0x38, 0x38,
+  0x07, 0xE0, 0x1F, 0xF8, 0x3C, 0x1C, 0x70, 0x0E, 0x63, 0xB7, 0xE7, 0xF3,
+  0xCE, 0x73, 0xCC, 0x33, 0xCC, 0x33, 0xCE, 0x76, 0xE7, 0xFE, 0x63, 0xB8,
+  0x70, 0x08, 0x3C, 0x38, 0x1F, 0xF0, 0x07, 0xC0, 0x07, 0x80, 0x1E, 0x00,
+  0xFC, 0x03, 0x30, 0x1C, 0xE0, 0x73, 0x81, 0x86, 0x0E, 0x1C, 0x3F, 0xF1,
+  0xFF, 0xE7, 0x03, 0x9C, 0x0E, 0xE0, 0x1C, 0xFF, 0x1F, 0xFB, 0x87, 0x70,
+  0xEE, 0x1D, 0xFF, 0x3F, 0xF7, 0x0F, 0xE0, 0xFC, 0x1F, 0x87, 0xFF, 0xEF,
+  0xF8, 0x0F, 0xC7, 0xFD, 0xE0, 0xB8, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00,
+  0xE0, 0x0E, 0x01, 0xE0, 0x9F, 0xF0, 0xFC, 0xFF, 0x0F, 0xFC, 0xE1, 0xEE,
+  0x0E, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x0E, 0xE1, 0xEF,
+  0xFC, 0xFF, 0x00, 0xFF, 0xFF, 0xF8, 0x1C, 0x0E, 0x07, 0xFB, 0xFD, 0xC0,
+  0xE0, 0x70, 0x38, 0x1F, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0x1C, 0x0E, 0x07,
+  0xFF, 0xFF, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x00, 0x0F, 0xE1, 0xFF,
+  0x9E, 0x04, 0xE0, 0x0E, 0x00, 0x70, 0x03, 0x83, 0xFC, 0x1F, 0xE0, 0x3B,
+  0x81, 0xDE, 0x0E, 0x7F, 0xF0, 0xFE, 0x00, 0xE0, 0x7E, 0x07, 0xE0, 0x7E,
+  0x07, 0xE0, 0x7F, 0xFF, 0xFF, 0xFE, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E,
+  0x07, 0xE0, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1C, 0x71, 0xC7, 0x1C,
+  0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x73, 0xFE, 0xF0, 0xE1, 0xE7, 0x1E,
+  0x39, 0xE1, 0xDE, 0x0F, 0xE0, 0x7E, 0x03, 0xF0, 0x1F, 0xC0, 0xEF, 0x07,
+  0x3C, 0x38, 0xF1, 0xC3, 0xCE, 0x0F, 0x00, 0xE0, 0x70, 0x38, 0x1C, 0x0E,
+  0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1F, 0xFF, 0xF8, 0xF0, 0x1F,
+  0xE0, 0x3F, 0xE0, 0xFF, 0xC1, 0xFE, 0xC6, 0xFD, 0x8D, 0xFB, 0xBB, 0xF3,
+  0x67, 0xE7, 0xCF, 0xC7, 0x1F, 0x8E, 0x3F, 0x00, 0x7E, 0x00, 0xE0, 0xF0,
+  0x7F, 0x07, 0xF8, 0x7F, 0x87, 0xEC, 0x7E, 0xE7, 0xE6, 0x7E, 0x77, 0xE3,
+  0x7E, 0x3F, 0xE1, 0xFE, 0x0F, 0xE0, 0xF0, 0x0F, 0x81, 0xFF, 0x1E, 0x3C,
+  0xE0, 0xEE, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x3B, 0x83, 0x9E,
+  0x3C, 0x7F, 0xC0, 0xF8, 0x00, 0xFF, 0x9F, 0xFB, 0x87, 0xF0, 0x7E, 0x0F,
+  0xC1, 0xF8, 0x7F, 0xFE, 0xFF, 0x9C, 0x03, 0x80, 0x70, 0x0E, 0x00, 0x0F,
+  0x81, 0xFF, 0x1E, 0x3C, 0xE0, 0xEE, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x07,
+  0xE0, 0x3B, 0x83, 0xDE, 0x3C, 0x7F, 0xC0, 0xFC, 0x00, 0xE0, 0x03, 0x80,
+  0x0E, 0xFF, 0x0F, 0xF8, 0xE1, 0xCE, 0x1C, 0xE1, 0xCE, 0x3C, 0xFF, 0x8F,
+  0xF8, 0xE3, 0x8E, 0x1C, 0xE1, 0xEE, 0x0E, 0xE0, 0xF0, 0x3F, 0x9F, 0xEE,
+  0x0B, 0x80, 0xF0, 0x3F, 0x87, 0xF8, 0x3F, 0x03, 0xC0, 0x78, 0x1F, 0xFE,
+  0x7F, 0x00, 0xFF, 0xFF, 0xFC, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80,
+  0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0xE0, 0x7E, 0x07, 0xE0,
+  0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0x70,
+  0xE7, 0xFE, 0x1F, 0x80, 0xE0, 0x1D, 0xC0, 0xE7, 0x03, 0x9E, 0x1E, 0x38,
+  0x70, 0xE1, 0xC3, 0xCF, 0x07, 0x38, 0x1C, 0xE0, 0x3F, 0x00, 0xFC, 0x03,
+  0xF0, 0x07, 0x80, 0xE0, 0xE0, 0xFC, 0x3E, 0x1D, 0xC6, 0xC7, 0x38, 0xD8,
+  0xE7, 0x1B, 0x1C, 0xE3, 0x63, 0x8E, 0xC6, 0xE1, 0xD8, 0xDC, 0x3B, 0x1B,
+  0x87, 0x63, 0x70, 0x78, 0x3C, 0x0F, 0x07, 0x81, 0xE0, 0xF0, 0xF0, 0x7B,
+  0xC7, 0x8E, 0x38, 0x7B, 0xC1, 0xFC, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x1F,
+  0xC1, 0xEF, 0x0E, 0x38, 0xF1, 0xEF, 0x07, 0x80, 0xF0, 0x7B, 0xC7, 0x8E,
+  0x38, 0x7B, 0xC1, 0xFC, 0x07, 0xC0, 0x3E, 0x00, 0xE0, 0x07, 0x00, 0x38,
+  0x01, 0xC0, 0x0E, 0x00, 0x70, 0x00, 0xFF, 0xFF, 0xFC, 0x07, 0x81, 0xE0,
+  0x78, 0x1E, 0x03, 0x80, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0x7F, 0xFF, 0xFE,
+  0xFF, 0xF9, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0xFF, 0xC1, 0xC1,
+  0x83, 0x07, 0x06, 0x0C, 0x1C, 0x18, 0x30, 0x70, 0x60, 0xC1, 0xC1, 0x80,
+  0xFF, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9F, 0xFF, 0x0E, 0x03,
+  0xE0, 0xEE, 0x38, 0xEE, 0x0E, 0xFF, 0xFF, 0xC0, 0x61, 0x86, 0x3F, 0x1F,
+  0xE4, 0x1C, 0x07, 0x3F, 0xFF, 0xFE, 0x1F, 0x8F, 0xFF, 0xDF, 0x70, 0xE0,
+  0x1C, 0x03, 0x80, 0x70, 0x0E, 0x79, 0xFF, 0xBC, 0x77, 0x07, 0xE0, 0xFC,
+  0x1F, 0x83, 0xF8, 0xEF, 0xFD, 0xCF, 0x00, 0x1F, 0x3F, 0xDC, 0x3C, 0x0E,
+  0x07, 0x03, 0x80, 0xE1, 0x7F, 0x8F, 0x80, 0x00, 0xE0, 0x1C, 0x03, 0x80,
+  0x73, 0xCE, 0xFF, 0xDC, 0x7F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xB8, 0xF7,
+  0xFE, 0x79, 0xC0, 0x1F, 0x0F, 0xF9, 0xC7, 0x70, 0x7F, 0xFF, 0xFF, 0xF8,
+  0x03, 0x81, 0x7F, 0xE3, 0xF8, 0x1F, 0x3F, 0x38, 0x38, 0xFF, 0xFF, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3C, 0xEF, 0xFD, 0xC7, 0xF0,
+  0x7E, 0x0F, 0xC1, 0xF8, 0x3B, 0x8F, 0x7F, 0xE7, 0x9C, 0x03, 0xA0, 0xE7,
+  0xFC, 0x7E, 0x00, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE7, 0xBF, 0xEF, 0x1F,
+  0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x70, 0xFF, 0x8F, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x39, 0xCE, 0x03, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C,
+  0xE7, 0xF7, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x1D, 0xC7, 0x39,
+  0xC7, 0x70, 0xFC, 0x1F, 0x83, 0xB8, 0x73, 0x8E, 0x39, 0xC3, 0x80, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xEF, 0x3D, 0xFE, 0xFF, 0xCF, 0x3F, 0x1C,
+  0x7E, 0x38, 0xFC, 0x71, 0xF8, 0xE3, 0xF1, 0xC7, 0xE3, 0x8F, 0xC7, 0x1C,
+  0xE7, 0xBF, 0xEF, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8,
+  0x70, 0x1F, 0x0F, 0xF9, 0xC7, 0x70, 0x7E, 0x0F, 0xC1, 0xF8, 0x3B, 0x8E,
+  0x7F, 0xC3, 0xE0, 0xE7, 0x9F, 0xFB, 0xC7, 0x70, 0x7E, 0x0F, 0xC1, 0xF8,
+  0x3F, 0x8E, 0xFF, 0xDC, 0xF3, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x00, 0x3C,
+  0xEF, 0xFD, 0xC7, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3B, 0x8F, 0x7F, 0xE7,
+  0x9C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0xEF, 0xFF, 0xC7, 0x0E, 0x1C,
+  0x38, 0x70, 0xE1, 0xC0, 0x3F, 0x7F, 0xF8, 0x3C, 0x0F, 0xE1, 0xFC, 0x0F,
+  0x07, 0xFF, 0xBF, 0x00, 0x38, 0x38, 0x38, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x3F, 0x1F, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8,
+  0x7E, 0x1F, 0x8F, 0x7F, 0xCE, 0x70, 0xE0, 0xFC, 0x3D, 0xC7, 0x38, 0xE3,
+  0xB8, 0x77, 0x06, 0xC0, 0xF8, 0x0E, 0x01, 0xC0, 0xE3, 0x8F, 0xC7, 0x1D,
+  0xCE, 0x73, 0xB6, 0xE7, 0x6D, 0xC6, 0xDB, 0x0F, 0xBE, 0x1E, 0x7C, 0x1C,
+  0x70, 0x38, 0xE0, 0xF1, 0xEE, 0x38, 0xEE, 0x1D, 0xC1, 0xF0, 0x3E, 0x0E,
+  0xE1, 0xDC, 0x71, 0xDE, 0x3C, 0xE0, 0xEE, 0x39, 0xC7, 0x38, 0xE3, 0xB8,
+  0x77, 0x06, 0xC0, 0xF8, 0x0F, 0x01, 0xC0, 0x38, 0x07, 0x03, 0xC0, 0x70,
+  0x00, 0xFF, 0xFF, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF,
+  0xC0, 0x0F, 0x8F, 0xC7, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x78, 0xF8, 0x7C,
+  0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x3F, 0x0F, 0x80, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0xF8, 0x7E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x3C, 0x0F,
+  0x87, 0xC7, 0x03, 0x81, 0xC0, 0xE0, 0x71, 0xF8, 0xF8, 0x00, 0x7C, 0x3F,
+  0xFE, 0x1F, 0x00 };
+
+const GFXglyph DejaVuSans_Bold9pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
+  {     1,   3,  13,   8,    3,  -12 },   // 0x21 '!'
+  {     6,   6,   5,   9,    2,  -12 },   // 0x22 '"'
+  {    10,  13,  13,  15,    1,  -12 },   // 0x23 '#'
+  {    32,  10,  17,  13,    1,  -13 },   // 0x24 '$'
+  {    54,  17,  13,  18,    1,  -12 },   // 0x25 '%'
+  {    82,  14,  13,  16,    1,  -12 },   // 0x26 '&'
+  {   105,   2,   5,   6,    2,  -12 },   // 0x27 '''
+  {   107,   5,  16,   8,    2,  -13 },   // 0x28 '('
+  {   117,   5,  16,   8,    2,  -13 },   // 0x29 ')'
+  {   127,  10,   8,   9,    0,  -12 },   // 0x2A '*'
+  {   137,  12,  12,  15,    2,  -11 },   // 0x2B '+'
+  {   155,   4,   6,   7,    1,   -2 },   // 0x2C ','
+  {   158,   6,   3,   7,    1,   -6 },   // 0x2D '-'
+  {   161,   3,   3,   7,    2,   -2 },   // 0x2E '.'
+  {   163,   7,  15,   7,    0,  -12 },   // 0x2F '/'
+  {   177,  11,  13,  13,    1,  -12 },   // 0x30 '0'
+  {   195,   9,  13,  13,    2,  -12 },   // 0x31 '1'
+  {   210,  10,  13,  13,    1,  -12 },   // 0x32 '2'
+  {   227,  10,  13,  13,    1,  -12 },   // 0x33 '3'
+  {   244,  11,  13,  13,    1,  -12 },   // 0x34 '4'
+  {   262,  10,  13,  13,    1,  -12 },   // 0x35 '5'
+  {   279,  10,  13,  13,    1,  -12 },   // 0x36 '6'
+  {   296,  10,  13,  13,    1,  -12 },   // 0x37 '7'
+  {   313,  10,  13,  13,    1,  -12 },   // 0x38 '8'
+  {   330,  10,  13,  13,    1,  -12 },   // 0x39 '9'
+  {   347,   3,  10,   7,    2,   -9 },   // 0x3A ':'
+  {   351,   4,  13,   7,    1,   -9 },   // 0x3B ';'
+  {   358,  11,  10,  15,    2,  -10 },   // 0x3C '<'
+  {   372,  11,   6,  15,    2,   -8 },   // 0x3D '='
+  {   381,  11,  10,  15,    2,  -10 },   // 0x3E '>'
+  {   395,   8,  13,  10,    1,  -12 },   // 0x3F '?'
+  {   408,  16,  16,  18,    1,  -12 },   // 0x40 '@'
+  {   440,  14,  13,  14,    0,  -12 },   // 0x41 'A'
+  {   463,  11,  13,  14,    2,  -12 },   // 0x42 'B'
+  {   481,  11,  13,  13,    1,  -12 },   // 0x43 'C'
+  {   499,  12,  13,  15,    2,  -12 },   // 0x44 'D'
+  {   519,   9,  13,  12,    2,  -12 },   // 0x45 'E'
+  {   534,   9,  13,  12,    2,  -12 },   // 0x46 'F'
+  {   549,  13,  13,  15,    1,  -12 },   // 0x47 'G'
+  {   571,  12,  13,  16,    2,  -12 },   // 0x48 'H'
+  {   591,   3,  13,   7,    2,  -12 },   // 0x49 'I'
+  {   596,   6,  17,   7,   -1,  -12 },   // 0x4A 'J'
+  {   609,  13,  13,  14,    2,  -12 },   // 0x4B 'K'
+  {   631,   9,  13,  11,    2,  -12 },   // 0x4C 'L'
+  {   646,  15,  13,  18,    2,  -12 },   // 0x4D 'M'
+  {   671,  12,  13,  15,    2,  -12 },   // 0x4E 'N'
+  {   691,  13,  13,  15,    1,  -12 },   // 0x4F 'O'
+  {   713,  11,  13,  13,    2,  -12 },   // 0x50 'P'
+  {   731,  13,  16,  15,    1,  -12 },   // 0x51 'Q'
+  {   757,  12,  13,  14,    2,  -12 },   // 0x52 'R'
+  {   777,  10,  13,  13,    1,  -12 },   // 0x53 'S'
+  {   794,  11,  13,  12,    0,  -12 },   // 0x54 'T'
+  {   812,  12,  13,  16,    2,  -12 },   // 0x55 'U'
+  {   832,  14,  13,  14,    0,  -12 },   // 0x56 'V'
+  {   855,  19,  13,  20,    1,  -12 },   // 0x57 'W'
+  {   886,  13,  13,  14,    0,  -12 },   // 0x58 'X'
+  {   908,  13,  13,  13,    0,  -12 },   // 0x59 'Y'
+  {   930,  11,  13,  13,    1,  -12 },   // 0x5A 'Z'
+  {   948,   5,  16,   8,    2,  -13 },   // 0x5B '['
+  {   958,   7,  15,   7,    0,  -12 },   // 0x5C '\'
+  {   972,   5,  16,   8,    2,  -13 },   // 0x5D ']'
+  {   982,  11,   5,  15,    2,  -12 },   // 0x5E '^'
+  {   989,   9,   2,   9,    0,    3 },   // 0x5F '_'
+  {   992,   5,   3,   9,    1,  -13 },   // 0x60 '`'
+  {   994,  10,  10,  12,    1,   -9 },   // 0x61 'a'
+  {  1007,  11,  14,  13,    2,  -13 },   // 0x62 'b'
+  {  1027,   9,  10,  11,    1,   -9 },   // 0x63 'c'
+  {  1039,  11,  14,  13,    1,  -13 },   // 0x64 'd'
+  {  1059,  11,  10,  12,    1,   -9 },   // 0x65 'e'
+  {  1073,   8,  14,   8,    0,  -13 },   // 0x66 'f'
+  {  1087,  11,  14,  13,    1,   -9 },   // 0x67 'g'
+  {  1107,  10,  14,  13,    2,  -13 },   // 0x68 'h'
+  {  1125,   3,  14,   6,    2,  -13 },   // 0x69 'i'
+  {  1131,   5,  18,   6,    0,  -13 },   // 0x6A 'j'
+  {  1143,  11,  14,  12,    2,  -13 },   // 0x6B 'k'
+  {  1163,   3,  14,   6,    2,  -13 },   // 0x6C 'l'
+  {  1169,  15,  10,  18,    2,   -9 },   // 0x6D 'm'
+  {  1188,  10,  10,  13,    2,   -9 },   // 0x6E 'n'
+  {  1201,  11,  10,  12,    1,   -9 },   // 0x6F 'o'
+  {  1215,  11,  14,  13,    2,   -9 },   // 0x70 'p'
+  {  1235,  11,  14,  13,    1,   -9 },   // 0x71 'q'
+  {  1255,   7,  10,   9,    2,   -9 },   // 0x72 'r'
+  {  1264,   9,  10,  11,    1,   -9 },   // 0x73 's'
+  {  1276,   8,  13,   9,    1,  -12 },   // 0x74 't'
+  {  1289,  10,  10,  13,    2,   -9 },   // 0x75 'u'
+  {  1302,  11,  10,  12,    1,   -9 },   // 0x76 'v'
+  {  1316,  15,  10,  16,    1,   -9 },   // 0x77 'w'
+  {  1335,  11,  10,  12,    1,   -9 },   // 0x78 'x'
+  {  1349,  11,  14,  12,    1,   -9 },   // 0x79 'y'
+  {  1369,   9,  10,  10,    1,   -9 },   // 0x7A 'z'
+  {  1381,   9,  17,  13,    2,  -13 },   // 0x7B '{'
+  {  1401,   2,  18,   7,    2,  -13 },   // 0x7C '|'
+  {  1406,   9,  17,  13,    2,  -13 },   // 0x7D '}'
+  {  1426,  11,   3,  15,    2,   -6 } }; // 0x7E '~'
+
+const GFXfont DejaVuSans_Bold9pt7b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Bold9pt7bBitmaps,
+  (GFXglyph *)DejaVuSans_Bold9pt7bGlyphs,
+  0x20, 0x7E, 21 };
+
+// Approx. 2103 bytes
@@ -0,0 +1,394 @@
+/**
+ * @file golden_check.cpp
+ * @brief Host check: every screen the badge draws against stored golden images.
+ *        Each case is recorded with the same screens.cpp functions as
+ *        updateDisplay(), replayed into a full 122x250 frame and compared with
+ *        tools/golden/<case>.pbm (binary PBM, 250x122 as seen on the badge).
+ *        Render time (record + replay) is compared with tools/golden/render_us.txt;
+ *        a case more than TIME_FACTOR times slower (and TIME_SLACK_US over) fails.
+ *        A mismatching frame is written to _golden_actual/<case>.actual.pbm.
+ *        --update rewrites the goldens and timings (do that on the machine
+ *        the timings are meant for, after checking the images).
+ *        Text is drawn with the fixed DejaVu Sans bitmaps in tools/golden/fonts
+ *        (same sizes as the firmware's FreeSans set), so the check does not
+ *        depend on the Adafruit GFX library version installed.
+ *        Then data:patch: edits of an info screen: every pixel that differs
+ *        between the frames before and after has to be inside the area
+ *        infoLayoutChangedArea() gives the partial refresh. Last, content with
+ *        more fields than INFO_LAYOUT_MAX_LINES has to come out truncated.
+ *        Build and run:
+ *
+ *          g++ -std=c++11 -Itools/host -Isrc \
+ *              tools/golden_check.cpp src/screens.cpp src/display_list.cpp src/glyph_blit.cpp \
+ *              src/text_layout.cpp src/qr_encoder.cpp src/contact_card.cpp src/info_patch.cpp -o golden_check && ./golden_check [--update]
+ */
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <chrono>
+
+#include <Adafruit_GFX.h>
+
+#include "golden/fonts/DejaVuSans9pt7b.h"
+#include "golden/fonts/DejaVuSans12pt7b.h"
+#include "golden/fonts/DejaVuSans18pt7b.h"
+#include "golden/fonts/DejaVuSans24pt7b.h"
+#include "golden/fonts/DejaVuSans_Bold9pt7b.h"
+#include "golden/fonts/DejaVuSans_Bold12pt7b.h"
+#include "golden/fonts/DejaVuSans_Bold18pt7b.h"
+#include "golden/fonts/DejaVuSans_Bold24pt7b.h"
+
+#include "contact_card.h"
+#include "display_list.h"
+#include "glyph_blit.h"
+#include "info_patch.h"
+#include "qr_encoder.h"
+#include "screens.h"
+#include "text_layout.h"
+
+static const ScreenFonts FONTS = {
+    {{&DejaVuSans9pt7b, &DejaVuSans12pt7b, &DejaVuSans18pt7b, &DejaVuSans24pt7b},
+     {&DejaVuSans_Bold9pt7b, &DejaVuSans_Bold12pt7b, &DejaVuSans_Bold18pt7b, &DejaVuSans_Bold24pt7b}},
+    &DejaVuSans12pt7b,
+    &DejaVuSans9pt7b};
+
+// Firmware settings (main.cpp, board_traits.h for the T5 2.13")
+static const uint16_t MAX_INFO_CHARS = 250;
+static const uint16_t MAX_QR_CHARS = 90;
+static const uint8_t MAX_QR_VERSION = 7;
+static const uint8_t QR_QUIET_ZONE = 4;
+static const uint16_t NATIVE_STRIDE = 128 / 8;
+static const int16_t NATIVE_W = 122, NATIVE_H = 250;
+static const uint8_t ROTATION = 1;
+static const int16_t AREA_W = NATIVE_H, AREA_H = NATIVE_W;
+static const size_t FRAME_BYTES = NATIVE_STRIDE * NATIVE_H;
+
+static const char *GOLDEN_DIR = "tools/golden";
+static const char *ACTUAL_DIR = "_golden_actual"; // Mismatching frames (ignored by git)
+static const double TIME_FACTOR = 2.0;
+static const double TIME_SLACK_US = 20.0;
+static const int TIME_RUNS = 200;
+
+enum CaseMode
+{
+    CASE_INFO,
+    CASE_QR,
+    CASE_BLANK,
+    CASE_CONTACT, // data is the personal info the card is built from
+    CASE_SPLIT    // data is the personal info, shown next to its contact card
+};
+
+struct GoldenCase
+{
+    const char *name;
+    CaseMode mode;
+    const char *data;
+};
+
+// More fields than INFO_LAYOUT_MAX_LINES: the last ones are dropped
+static const char *MANY_FIELDS = "Jane Doe\nFirmware Engineer\nBooth 12\nHall B\nDay 1\nDay 2\nTalk 14:00\n"
+                                 "Room 3\n@janedoe\njane.doe@example.com\n+1 555 0100\nexample.com";
+
+static char maxInfo[MAX_INFO_CHARS + 1];
+static char maxQr[MAX_QR_CHARS + 1];
+static char tooLongQr[MAX_QR_CHARS + 2];
+
+static void fillPayloads()
+{
+    // Longest accepted payloads: a name plus fields that have to wrap
+    const char *fields = "Maximilian Alexander Featherstonehaugh\nPrincipal Embedded Systems Architect\n"
+                         "maximilian.featherstonehaugh@subsidiary.example-corporation.com\n+44 20 7946 0958\n";
+    for (uint16_t i = 0; i < MAX_INFO_CHARS; i++)
+        maxInfo[i] = fields[i % strlen(fields)];
+    maxInfo[MAX_INFO_CHARS] = '\0';
+    const char *url = "https://example.com/badge/";
+    for (uint16_t i = 0; i < MAX_QR_CHARS + 1; i++)
+        tooLongQr[i] = i < strlen(url) ? url[i] : (char)('a' + i % 26);
+    tooLongQr[MAX_QR_CHARS + 1] = '\0';
+    memcpy(maxQr, tooLongQr, MAX_QR_CHARS);
+    maxQr[MAX_QR_CHARS] = '\0';
+}
+
+// Records a case the way updateDisplay() does for the mode
+static void recordCase(const GoldenCase &c, DisplayList &list, InfoLayout &layout, QrCode &qrCode)
+{
+    list.clear();
+    switch (c.mode)
+    {
+    case CASE_INFO:
+        computeInfoLayout(c.data, MAX_INFO_CHARS, FONTS.info, AREA_W, AREA_H, layout);
+        recordInfoScreen(list, layout, c.data, FONTS, AREA_W, AREA_H);
+        break;
+    case CASE_QR:
+    {
+        QrScreenStatus status = QR_SCREEN_OK;
+        if (c.data[0] == '\0')
+            status = QR_SCREEN_NO_DATA;
+        else if (strlen(c.data) > MAX_QR_CHARS || !qrEncodeText(qrCode, c.data, MAX_QR_VERSION, QR_ECC_LOW))
+            status = QR_SCREEN_FAILED;
+        // Largest module size with the quiet zone on the short side, like qrScaleFor()
+        uint8_t scale = status == QR_SCREEN_OK ? AREA_H / (qrCode.size + 2 * QR_QUIET_ZONE) : 0;
+        recordQrScreen(list, status, status == QR_SCREEN_OK ? &qrCode : nullptr, scale, FONTS, AREA_W, AREA_H);
+        break;
+    }
+    case CASE_CONTACT:
+    case CASE_SPLIT:
+    {
+        static char card[2 * MAX_INFO_CHARS + 32];
+        bool ok = encodeContactCard(qrCode, c.data, MAX_INFO_CHARS, MAX_QR_VERSION, card, sizeof(card));
+        uint8_t scale = ok ? AREA_H / (qrCode.size + 2 * QR_QUIET_ZONE) : 0;
+        if (c.mode == CASE_SPLIT)
+        {
+            // Text right of the AREA_H square, like ensureSplitLayout()
+            computeInfoLayout(c.data, MAX_INFO_CHARS, FONTS.info, AREA_W - AREA_H, AREA_H, layout);
+            recordSplitScreen(list, layout, c.data, ok ? &qrCode : nullptr, scale, FONTS, AREA_W, AREA_H);
+        }
+        else
+            recordQrScreen(list, ok ? QR_SCREEN_OK : QR_SCREEN_FAILED, ok ? &qrCode : nullptr, scale, FONTS,
+                           AREA_W, AREA_H);
+        break;
+    }
+    case CASE_BLANK:
+        break;
+    }
+}
+
+static bool logicalBlack(const uint8_t *frame, int16_t x, int16_t y)
+{
+    // Rotation 1: logical (x, y) is native (NATIVE_W - 1 - y, x)
+    int16_t nx = NATIVE_W - 1 - y, ny = x;
+    return !(frame[ny * NATIVE_STRIDE + nx / 8] & (0x80 >> (nx % 8)));
+}
+
+static bool writePbm(const char *path, const uint8_t *frame)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f)
+        return false;
+    fprintf(f, "P4\n%d %d\n", AREA_W, AREA_H);
+    for (int16_t y = 0; y < AREA_H; y++)
+    {
+        uint8_t row[(AREA_W + 7) / 8] = {0};
+        for (int16_t x = 0; x < AREA_W; x++)
+            if (logicalBlack(frame, x, y))
+                row[x / 8] |= 0x80 >> (x % 8);
+        fwrite(row, 1, sizeof(row), f);
+    }
+    return fclose(f) == 0;
+}
+
+// Differing pixels against a golden PBM, or -1 if it is missing / malformed
+static long comparePbm(const char *path, const uint8_t *frame)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return -1;
+    int w = 0, h = 0;
+    long diff = -1;
+    if (fscanf(f, "P4 %d %d", &w, &h) == 2 && w == AREA_W && h == AREA_H && fgetc(f) != EOF)
+    {
+        diff = 0;
+        for (int16_t y = 0; y < AREA_H && diff >= 0; y++)
+        {
+            uint8_t row[(AREA_W + 7) / 8];
+            if (fread(row, 1, sizeof(row), f) != sizeof(row))
+            {
+                diff = -1;
+                break;
+            }
+            for (int16_t x = 0; x < AREA_W; x++)
+                diff += (bool)(row[x / 8] & (0x80 >> (x % 8))) != logicalBlack(frame, x, y);
+        }
+    }
+    fclose(f);
+    return diff;
+}
+
+static double baselineUs(const char *name)
+{
+    char path[256];
+    snprintf(path, sizeof(path), "%s/render_us.txt", GOLDEN_DIR);
+    FILE *f = fopen(path, "r");
+    if (!f)
+        return -1;
+    char caseName[64];
+    double us;
+    double found = -1;
+    while (fscanf(f, "%63s %lf", caseName, &us) == 2)
+        if (strcmp(caseName, name) == 0)
+            found = us;
+    fclose(f);
+    return found;
+}
+
+// Renders `info` as the INFO screen into `frame`
+static void renderInfo(const char *info, InfoLayout &layout, DisplayList &list, uint8_t *frame)
+{
+    PackedFrame packed = packedFrame(frame, NATIVE_STRIDE, NATIVE_W, NATIVE_H, ROTATION);
+    computeInfoLayout(info, MAX_INFO_CHARS, FONTS.info, AREA_W, AREA_H, layout);
+    list.clear();
+    recordInfoScreen(list, layout, info, FONTS, AREA_W, AREA_H);
+    frameFill(packed, false);
+    list.replay(packed);
+}
+
+// Patches of an info screen: the changed area has to cover every changed pixel
+static unsigned checkPatches()
+{
+    const char *info = "Jane Doe\nFirmware Engineer\njane.doe@example.com\n+1 555 0100";
+    const char *patches[] = {
+        "field:3=+1 555 0199",          // Same size: one line
+        "field:2=jd@example.com",       // Shorter line, recentered
+        "field:1=Engineer",             // Shorter title: sizes can step up, all lines move
+        "field:0=Jane",                 // Name
+        "field:2=jane.doe@example.com", // Same text: nothing to refresh
+        "field:4=Booth 12",             // Appended field
+        "bytes:0,4=John",               // Byte range inside the name
+    };
+    static uint8_t before[FRAME_BYTES], after[FRAME_BYTES];
+    static DisplayList list;
+    static InfoLayout beforeLayout, afterLayout;
+    static char patched[MAX_INFO_CHARS + 1];
+    unsigned failures = 0;
+    renderInfo(info, beforeLayout, list, before);
+    printf("\n%-32s %7s %10s %8s  %s\n", "patch", "lines", "area", "pixels", "result");
+    for (const char *spec : patches)
+    {
+        InfoPatch patch;
+        int32_t length = parseInfoPatch(spec, patch) ? applyInfoPatch(info, strlen(info), patch, patched, MAX_INFO_CHARS)
+                                                     : -1;
+        if (length < 0)
+        {
+            printf("%-32s PATCH FAILED\n", spec);
+            failures++;
+            continue;
+        }
+        renderInfo(patched, afterLayout, list, after);
+        int16_t x, y, w, h;
+        uint8_t changed = infoLayoutChangedArea(beforeLayout, info, afterLayout, patched, FONTS.info, x, y, w, h);
+        long differing = 0, outside = 0;
+        for (int16_t py = 0; py < AREA_H; py++)
+            for (int16_t px = 0; px < AREA_W; px++)
+                if (logicalBlack(before, px, py) != logicalBlack(after, px, py))
+                {
+                    differing++;
+                    if (px < x || px >= x + w || py < y || py >= y + h)
+                        outside++;
+                }
+        char lines[16], area[16];
+        snprintf(lines, sizeof(lines), "%u/%u", changed, afterLayout.lineCount);
+        snprintf(area, sizeof(area), "%dx%d", w, h);
+        printf("%-32s %7s %10s %8ld  %s\n", spec, lines, area, differing, outside == 0 ? "ok" : "PIXELS OUTSIDE");
+        if (outside != 0)
+            failures++;
+    }
+    return failures;
+}
+
+// Dropped fields have to be reported, also when the lines left would fit the area
+static unsigned checkTruncation()
+{
+    static InfoLayout screen, tall;
+    computeInfoLayout(MANY_FIELDS, MAX_INFO_CHARS, FONTS.info, AREA_W, AREA_H, screen);
+    computeInfoLayout(MANY_FIELDS, MAX_INFO_CHARS, FONTS.info, AREA_W, 8 * AREA_H, tall);
+    bool ok = screen.truncated && tall.truncated && tall.lineCount == INFO_LAYOUT_MAX_LINES;
+    printf("\n%-32s %u/%u lines  %s\n", "fields past the line limit", screen.lineCount, tall.lineCount,
+           ok ? "ok" : "NOT MARKED TRUNCATED");
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+    bool update = argc > 1 && strcmp(argv[1], "--update") == 0;
+    fillPayloads();
+    const GoldenCase cases[] = {
+        {"info_default", CASE_INFO, "No Info Received Yet.\nUse BLE to send data."},
+        {"info_multiline", CASE_INFO, "Jane Doe\nFirmware Engineer\njane.doe@example.com\n+1 555 0100"},
+        {"info_single", CASE_INFO, "Jane Doe"},
+        {"info_max_length", CASE_INFO, maxInfo},
+        {"info_empty", CASE_INFO, ""},
+        {"info_many_fields", CASE_INFO, MANY_FIELDS},
+        {"qr_url", CASE_QR, "https://example.com/badge"},
+        {"qr_phone", CASE_QR, "TEL:+15550100"},
+        {"qr_max_length", CASE_QR, maxQr},
+        {"qr_no_data", CASE_QR, ""},
+        {"qr_failed", CASE_QR, tooLongQr},
+        {"contact", CASE_CONTACT, "Jane Doe\nFirmware Engineer\njane.doe@example.com\n+1 555 0100"},
+        {"contact_no_name", CASE_CONTACT, ""},
+        {"split", CASE_SPLIT, "Jane Doe\nFirmware Engineer\njane.doe@example.com\n+1 555 0100"},
+        {"split_long", CASE_SPLIT, maxInfo},
+        {"blank", CASE_BLANK, ""},
+    };
+
+    static uint8_t frame[FRAME_BYTES];
+    static QrCode qrCode;
+    static DisplayList list;
+    static InfoLayout layout;
+    FILE *timings = nullptr;
+    if (update)
+    {
+        mkdir(GOLDEN_DIR, 0755);
+        char path[256];
+        snprintf(path, sizeof(path), "%s/render_us.txt", GOLDEN_DIR);
+        timings = fopen(path, "w");
+    }
+
+    unsigned failures = 0;
+    printf("%-16s %4s %9s %9s  %s\n", "case", "ops", "us", "golden us", "result");
+    for (const GoldenCase &c : cases)
+    {
+        // Timed: record (including layout / QR encoding) + replay into a blank frame
+        PackedFrame packed = packedFrame(frame, NATIVE_STRIDE, NATIVE_W, NATIVE_H, ROTATION);
+        auto t0 = std::chrono::steady_clock::now();
+        for (int run = 0; run < TIME_RUNS; run++)
+        {
+            recordCase(c, list, layout, qrCode);
+            frameFill(packed, false);
+            list.replay(packed);
+        }
+        double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / TIME_RUNS;
+
+        char path[256];
+        snprintf(path, sizeof(path), "%s/%s.pbm", GOLDEN_DIR, c.name);
+        const char *result = "ok";
+        double golden = baselineUs(c.name);
+        if (update)
+        {
+            result = "updated";
+            if (!writePbm(path, frame))
+            {
+                result = "WRITE FAILED";
+                failures++;
+            }
+            if (timings)
+                fprintf(timings, "%s %.1f\n", c.name, us);
+        }
+        else
+        {
+            long diff = comparePbm(path, frame);
+            char actual[256];
+            if (diff != 0)
+            {
+                mkdir(ACTUAL_DIR, 0755);
+                snprintf(actual, sizeof(actual), "%s/%s.actual.pbm", ACTUAL_DIR, c.name);
+                writePbm(actual, frame);
+                result = diff < 0 ? "NO GOLDEN (run with --update)" : "IMAGE MISMATCH";
+                failures++;
+                if (diff > 0)
+                    printf("%-16s %ld pixels differ, see %s\n", c.name, diff, actual);
+            }
+            else if (golden > 0 && us > golden * TIME_FACTOR && us > golden + TIME_SLACK_US)
+            {
+                result = "SLOWER";
+                failures++;
+            }
+        }
+        printf("%-16s %4u %9.1f %9.1f  %s\n", c.name, list.size(), us, golden, result);
+    }
+    if (timings)
+        fclose(timings);
+    failures += checkPatches();
+    failures += checkTruncation();
+    printf("%u failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,14 @@
+/**
+ * @file Adafruit_GFX.h
+ * @brief Host shim: lets the Adafruit GFX font headers in Fonts/ compile
+ *        in the host tools without the Arduino core. Only the font structs
+ *        are provided (gfxfont.h). Put tools/host first on the include path.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <gfxfont.h>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
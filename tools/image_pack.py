@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+"""Image packer for the badge's IMAGE screen.
+
+Turns a 1bpp PBM (P4, as seen on the badge: 250x122 landscape for the 2.13"
+panel) into what src/image_stream.cpp expects: the frame in the panel's
+native layout (rotation 1, rows of STRIDE bytes, MSB first, set = white),
+raw, PackBits (--rle) or LZSS (--lz, see lz_pack.py) compressed, plus the
+CRC-32 of the native frame.
+
+A grayscale PGM (P5, 8-bit, any size) is sent as gray pixels instead, for
+src/image_dither.cpp to scale and dither on the badge: the image is turned
+to the native orientation (rows of the 122 px side) and the CRC-32 covers
+the gray bytes. --ordered picks Bayer dithering over Floyd-Steinberg.
+
+Prints the BLE sequence the app has to send:
+
+  data characteristic:  image:begin:raw | image:begin:rle | image:begin:lz
+                        (gray: image:begin:raw:gray:<w>x<h>[:ordered])
+  image characteristic: <offset, uint32 little endian><up to 240 bytes>, ...
+  data characteristic:  image:end:<crc32 hex>
+
+  python3 tools/image_pack.py logo.pbm --rle -o logo.bin
+  python3 tools/image_pack.py photo.pgm --ordered
+
+tools/golden_check.cpp writes its frames as PBMs of the same size, so any
+screen can be packed as a test image. Only the standard library is needed.
+"""
+
+import argparse
+import sys
+import zlib
+
+from lz_pack import compress as lz_compress
+
+# GDEY0213B74 (board_traits.h): 122 visible of 128 columns, 250 rows, rotation 1
+NATIVE_COLUMNS = 128
+NATIVE_VISIBLE = 122
+NATIVE_ROWS = 250
+CHUNK_MAX = 240  # IMAGE_CHUNK_MAX
+
+
+def read_header(data, count):
+    fields = []
+    pos = 0
+    while len(fields) < count:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            pos = data.index(b"\n", pos) + 1
+            continue
+        start = pos
+        while not data[pos:pos + 1].isspace():
+            pos += 1
+        fields.append(data[start:pos])
+    return fields, pos + 1
+
+
+def read_pbm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    fields, pos = read_header(data, 3)
+    if fields[0] != b"P4":
+        raise ValueError("%s: not a binary PBM (P4)" % path)
+    width, height = int(fields[1]), int(fields[2])
+    pixels = data[pos:]
+    row_bytes = (width + 7) // 8
+    if len(pixels) < row_bytes * height:
+        raise ValueError("%s: truncated" % path)
+
+    def black(x, y):
+        return bool(pixels[y * row_bytes + x // 8] & (0x80 >> (x % 8)))
+
+    return width, height, black
+
+
+def read_pgm(path):
+    """8-bit PGM turned to the native orientation: returns width, height, bytes."""
+    with open(path, "rb") as f:
+        data = f.read()
+    fields, pos = read_header(data, 4)
+    if fields[0] != b"P5" or int(fields[3]) != 255:
+        raise ValueError("%s: not an 8-bit binary PGM (P5)" % path)
+    width, height = int(fields[1]), int(fields[2])
+    pixels = data[pos:pos + width * height]
+    if len(pixels) < width * height:
+        raise ValueError("%s: truncated" % path)
+    # Same turn as native_frame(): native row ny is logical column ny, bottom to top
+    native = bytearray(width * height)
+    for ny in range(width):
+        for nx in range(height):
+            native[ny * height + nx] = pixels[(height - 1 - nx) * width + ny]
+    return height, width, bytes(native)
+
+
+def native_frame(width, height, black):
+    """Rotation 1: logical (x, y) is native (NATIVE_VISIBLE - 1 - y, x)."""
+    if (width, height) != (NATIVE_ROWS, NATIVE_VISIBLE):
+        raise ValueError("image is %dx%d, the panel shows %dx%d" % (width, height, NATIVE_ROWS, NATIVE_VISIBLE))
+    stride = NATIVE_COLUMNS // 8
+    frame = bytearray(b"\xff" * (stride * NATIVE_ROWS))
+    for ny in range(NATIVE_ROWS):
+        for nx in range(NATIVE_VISIBLE):
+            if black(ny, NATIVE_VISIBLE - 1 - nx):
+                frame[ny * stride + nx // 8] &= ~(0x80 >> (nx % 8)) & 0xFF
+    return bytes(frame)
+
+
+def packbits(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 3:
+            out += bytes((257 - run, data[i]))
+            i += run
+            continue
+        start = i
+        while i < len(data) and i - start < 128:
+            if i + 2 < len(data) and data[i] == data[i + 1] == data[i + 2]:
+                break
+            i += 1
+        out.append(i - start - 1)
+        out += data[start:i]
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack a PBM for the badge IMAGE screen.")
+    parser.add_argument("source", help="P4 PBM, %dx%d, or 8-bit P5 PGM of any size" % (NATIVE_ROWS, NATIVE_VISIBLE))
+    parser.add_argument("--rle", action="store_true", help="PackBits compress the stream")
+    parser.add_argument("--lz", action="store_true", help="LZSS compress the stream")
+    parser.add_argument("--ordered", action="store_true", help="gray: ordered instead of Floyd-Steinberg dithering")
+    parser.add_argument("-o", "--output", help="write the stream to send here")
+    args = parser.parse_args()
+
+    with open(args.source, "rb") as f:
+        gray = f.read(2) == b"P5"
+    if args.rle and args.lz:
+        parser.error("--rle and --lz are exclusive")
+    begin = "rle" if args.rle else "lz" if args.lz else "raw"
+    if gray:
+        width, height, frame = read_pgm(args.source)
+        begin += ":gray:%dx%d%s" % (width, height, ":ordered" if args.ordered else "")
+    else:
+        frame = native_frame(*read_pbm(args.source))
+    stream = packbits(frame) if args.rle else lz_compress(frame) if args.lz else frame
+    crc = zlib.crc32(frame) & 0xFFFFFFFF
+    if args.output:
+        with open(args.output, "wb") as f:
+            f.write(stream)
+    chunks = (len(stream) + CHUNK_MAX - 1) // CHUNK_MAX
+    print("image_pack: %s %d bytes, stream %d bytes (%s), %d chunks of %d, crc32 %08x" % (
+        "gray" if gray else "frame", len(frame), len(stream), begin.split(":")[0], chunks, CHUNK_MAX, crc))
+    print("  image:begin:%s" % begin)
+    print("  ... %d image characteristic writes ..." % chunks)
+    print("  image:end:%08x" % crc)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,127 @@
+/**
+ * @file layout_bench.cpp
+ * @brief Host benchmark: text metric calls per info screen refresh, measured
+ *        with textMetricCalls() on both paths over the same sequence of
+ *        refreshes (contents shown for several refreshes each, as mode
+ *        switches and wakes redraw them):
+ *          old     the pre-cache drawInfoScreen(): on every page, measure "Aj"
+ *                  and every '\n' field (getTextBounds() per line)
+ *          cached  ensureInfoLayout(): computeInfoLayout() only when
+ *                  infoLayoutMatches() fails, pages draw from the record
+ *        for a full-height buffer and a 4-page buffer. Uses the real Adafruit
+ *        GFX fonts from the PlatformIO library folder. Build and run on the host:
+ *
+ *          g++ -std=c++11 -Itools/host -Isrc -I".pio/libdeps/t5_213/Adafruit GFX Library" \
+ *              tools/layout_bench.cpp src/text_layout.cpp -o layout_bench && ./layout_bench
+ */
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include <Adafruit_GFX.h>
+#include <Fonts/FreeSans9pt7b.h>
+#include <Fonts/FreeSans12pt7b.h>
+#include <Fonts/FreeSans18pt7b.h>
+#include <Fonts/FreeSans24pt7b.h>
+#include <Fonts/FreeSansBold9pt7b.h>
+#include <Fonts/FreeSansBold12pt7b.h>
+#include <Fonts/FreeSansBold18pt7b.h>
+#include <Fonts/FreeSansBold24pt7b.h>
+
+#include "text_layout.h"
+
+static const InfoFontSet FONTS = {
+    {&FreeSans9pt7b, &FreeSans12pt7b, &FreeSans18pt7b, &FreeSans24pt7b},
+    {&FreeSansBold9pt7b, &FreeSansBold12pt7b, &FreeSansBold18pt7b, &FreeSansBold24pt7b}};
+static const uint16_t MAX_CHARS = 250; // MAX_INFO_INPUT_STRING_LENGTH
+static const int16_t AREA_W = 250, AREA_H = 122;
+
+// Old path, one page: "Aj" for the line height, then each field centered
+// with drawCenteredText(), which measured it again (one 12 pt font, max 10 lines)
+static void oldInfoPage(const char *text)
+{
+    char buffer[MAX_CHARS + 1];
+    strncpy(buffer, text, MAX_CHARS);
+    buffer[MAX_CHARS] = '\0';
+    int16_t x1, y1;
+    uint16_t w, h;
+    measureText(&FreeSans12pt7b, "Aj", 2, &x1, &y1, &w, &h);
+    int lines = 0;
+    for (char *line = strtok(buffer, "\n"); line != nullptr && lines < 10; line = strtok(nullptr, "\n"), lines++)
+        measureText(&FreeSans12pt7b, line, strlen(line), &x1, &y1, &w, &h);
+}
+
+struct Step
+{
+    const char *text;
+    int refreshes; // Shown for this many refreshes before the next content
+};
+
+int main()
+{
+    const char *samples[] = {
+        "Default Name\nDefault Title\n",
+        "Jane Doe\nFirmware Engineer\njane.doe@example.com\n+1 555 0100",
+        "A\nB\nC\nD\nE\nF\nG\nH\nI\nJ\nK\nL",
+        "Maximilian Alexander Featherstonehaugh\nPrincipal Embedded Systems Architect\n"
+        "maximilian.featherstonehaugh@subsidiary.example-corporation.com",
+    };
+    const Step sequence[] = {{samples[0], 3}, {samples[1], 8}, {samples[2], 2}, {samples[3], 5}, {samples[1], 6}};
+    const uint16_t PAGE_COUNTS[] = {1, 4}; // Full-height buffer vs. a paged buffer
+
+    int refreshes = 0;
+    for (const Step &step : sequence)
+        refreshes += step.refreshes;
+    // Ascent / height of each font are measured once per boot and kept (fontMetrics() in text_layout.cpp)
+    InfoLayout warmUp;
+    uint32_t before = textMetricCalls();
+    computeInfoLayout(samples[3], MAX_CHARS, FONTS, AREA_W, AREA_H, warmUp);
+    printf("%d refreshes, %u content changes; font metrics once per boot: %lu calls\n\n", refreshes,
+           (unsigned)(sizeof(sequence) / sizeof(sequence[0])), (unsigned long)(textMetricCalls() - before));
+    printf("%5s | %18s %10s | %18s %7s %10s\n", "pages", "old calls/refresh", "us/refresh", "cached calls/refr.",
+           "layouts", "us/refresh");
+    for (uint16_t pages : PAGE_COUNTS)
+    {
+        before = textMetricCalls();
+        auto start = std::chrono::steady_clock::now();
+        for (const Step &step : sequence)
+            for (int r = 0; r < step.refreshes; r++)
+                for (uint16_t p = 0; p < pages; p++)
+                    oldInfoPage(step.text);
+        double oldUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        uint32_t oldCalls = textMetricCalls() - before;
+
+        InfoLayout layout = {}; // No NVS record yet
+        unsigned layouts = 0;
+        before = textMetricCalls();
+        start = std::chrono::steady_clock::now();
+        for (const Step &step : sequence)
+            for (int r = 0; r < step.refreshes; r++)
+                if (!infoLayoutMatches(layout, step.text, MAX_CHARS, AREA_W, AREA_H))
+                {
+                    computeInfoLayout(step.text, MAX_CHARS, FONTS, AREA_W, AREA_H, layout);
+                    layouts++;
+                }
+        // Pages only read the record: no metric calls however many there are
+        double cachedUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        uint32_t cachedCalls = textMetricCalls() - before;
+
+        printf("%5u | %18.2f %10.2f | %18.2f %7u %10.2f\n", pages, (double)oldCalls / refreshes, oldUs / refreshes,
+               (double)cachedCalls / refreshes, layouts, cachedUs / refreshes);
+    }
+
+    printf("\nLayouts:\n");
+    for (const char *sample : samples)
+    {
+        InfoLayout layout;
+        computeInfoLayout(sample, MAX_CHARS, FONTS, AREA_W, AREA_H, layout);
+        for (uint8_t i = 0; i < layout.lineCount; i++)
+        {
+            const InfoLine &line = layout.lines[i];
+            printf("  font %u x %4d y %4d '%.*s'\n", line.fontIndex, line.x, line.baselineY, line.length,
+                   sample + line.start);
+        }
+        printf("\n");
+    }
+    return 0;
+}
@@ -0,0 +1,293 @@
+/**
+ * @file lz_bench.cpp
+ * @brief Host benchmark: bytes on air and transfer time of typical BLE
+ *        payloads plain, PackBits (images) and LZSS compressed. The encoder
+ *        below is tools/lz_pack.py's greedy encoder in C++; every result is
+ *        decoded back with lz_stream.cpp, split into chunks at random
+ *        points, and images also go through ImageStream (image:begin:lz)
+ *        with their CRC. Time is a model, not a measurement: every write
+ *        with response costs two connection intervals (request, response)
+ *        at 15 ms, with 240 (ATT MTU 247) or 16 (MTU 23) image bytes per
+ *        write and 244 or 20 bytes per data write. Payloads: data:personal:
+ *        and data:qr: commands, a MeCard, 1bpp frames (dithered ramp, a QR,
+ *        a blank one) and a 122x250 gray upload. Build and run:
+ *
+ *          g++ -std=c++11 -O2 -Isrc tools/lz_bench.cpp src/lz_stream.cpp src/image_stream.cpp \
+ *              src/image_dither.cpp src/qr_encoder.cpp -o lz_bench && ./lz_bench
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+#include "image_stream.h"
+#include "lz_stream.h"
+#include "qr_encoder.h"
+
+typedef std::vector<uint8_t> Bytes;
+
+static const uint16_t NATIVE_W = 122;
+static const uint16_t NATIVE_H = 250;
+static const uint16_t NATIVE_STRIDE = 16;
+static const size_t FRAME_BYTES = NATIVE_STRIDE * NATIVE_H;
+static const double INTERVAL_MS = 15;
+static const uint8_t MIN_MATCH = 2;
+
+// Same as lz_pack.py's compress()
+static Bytes lzCompress(const Bytes &data)
+{
+    Bytes out;
+    uint32_t acc = 0;
+    uint8_t accBits = 0;
+    auto put = [&](uint32_t value, uint8_t count) {
+        acc = (acc << count) | value;
+        accBits += count;
+        while (accBits >= 8)
+        {
+            accBits -= 8;
+            out.push_back((uint8_t)(acc >> accBits));
+        }
+        acc &= (1UL << accBits) - 1;
+    };
+    size_t i = 0;
+    while (i < data.size())
+    {
+        size_t bestLength = 0, bestOffset = 0;
+        size_t limit = data.size() - i < LZ_MAX_MATCH ? data.size() - i : LZ_MAX_MATCH;
+        for (size_t offset = 1; offset <= LZ_WINDOW_SIZE && offset <= i; offset++)
+        {
+            size_t length = 0;
+            while (length < limit && data[i - offset + length] == data[i + length])
+                length++;
+            if (length > bestLength)
+            {
+                bestLength = length;
+                bestOffset = offset;
+                if (length == limit)
+                    break;
+            }
+        }
+        if (bestLength >= MIN_MATCH)
+        {
+            put(0, 1);
+            put(bestOffset - 1, LZ_WINDOW_BITS);
+            put(bestLength - 1, LZ_LOOKAHEAD_BITS);
+            i += bestLength;
+        }
+        else
+        {
+            put(1, 1);
+            put(data[i], 8);
+            i++;
+        }
+    }
+    if (accBits)
+        put(0, 8 - accBits);
+    return out;
+}
+
+// Same as image_pack.py's packbits()
+static Bytes packBits(const Bytes &data)
+{
+    Bytes out;
+    size_t i = 0;
+    while (i < data.size())
+    {
+        size_t run = 1;
+        while (i + run < data.size() && run < 128 && data[i + run] == data[i])
+            run++;
+        if (run >= 3)
+        {
+            out.push_back((uint8_t)(257 - run));
+            out.push_back(data[i]);
+            i += run;
+            continue;
+        }
+        size_t start = i;
+        while (i < data.size() && i - start < 128)
+        {
+            if (i + 2 < data.size() && data[i] == data[i + 1] && data[i] == data[i + 2])
+                break;
+            i++;
+        }
+        out.push_back((uint8_t)(i - start - 1));
+        out.insert(out.end(), data.begin() + start, data.begin() + i);
+    }
+    return out;
+}
+
+// Decodes in chunks split at random points
+static bool lzRoundTrip(const Bytes &packed, const Bytes &expected)
+{
+    LzDecoder decoder;
+    decoder.begin();
+    Bytes out;
+    uint8_t item[LZ_MAX_MATCH];
+    uint8_t count;
+    size_t pos = 0;
+    while (pos < packed.size())
+    {
+        size_t chunk = 1 + rand() % 64;
+        for (size_t end = pos + chunk; pos < end && pos < packed.size(); pos++)
+        {
+            if (!decoder.decode(packed[pos], item, count))
+                return false;
+            out.insert(out.end(), item, item + count);
+        }
+    }
+    return decoder.idle() && out == expected;
+}
+
+struct FrameSink : ImageSink
+{
+    uint8_t frame[FRAME_BYTES];
+    bool writeRows(uint16_t y, const uint8_t *rows, uint16_t count) override
+    {
+        memcpy(frame + (size_t)y * NATIVE_STRIDE, rows, (size_t)count * NATIVE_STRIDE);
+        return true;
+    }
+};
+
+// image:begin:lz[:gray] through ImageStream, 240 byte chunks, 7 row bands
+static bool imageRoundTrip(const Bytes &packed, const Bytes &source, bool gray, const uint8_t *frame)
+{
+    static uint8_t band[NATIVE_STRIDE * 7];
+    static FrameSink sink;
+    GrayDither dither;
+    ImageStream stream;
+    if (gray)
+        dither.begin(DITHER_FLOYD_STEINBERG, NATIVE_W, NATIVE_H, NATIVE_W, NATIVE_H);
+    stream.begin(IMAGE_LZ, NATIVE_STRIDE, NATIVE_H, band, 7, &sink, gray ? &dither : nullptr);
+    for (size_t offset = 0; offset < packed.size(); offset += IMAGE_CHUNK_MAX)
+    {
+        size_t length = packed.size() - offset < IMAGE_CHUNK_MAX ? packed.size() - offset : IMAGE_CHUNK_MAX;
+        if (!stream.feed(offset, packed.data() + offset, length))
+            return false;
+    }
+    return stream.finish(imageCrc32(source.data(), source.size())) &&
+           (frame == nullptr || memcmp(sink.frame, frame, FRAME_BYTES) == 0);
+}
+
+static double transferMs(size_t bytes, size_t perWrite)
+{
+    return ((bytes + perWrite - 1) / perWrite) * 2 * INTERVAL_MS;
+}
+
+static Bytes text(const char *value)
+{
+    return Bytes(value, value + strlen(value));
+}
+
+// Frames and gray images in native orientation
+static Bytes ditheredFrame(DitherMethod method, Bytes &gray)
+{
+    gray.assign(NATIVE_W * NATIVE_H, 0);
+    for (uint16_t y = 0; y < NATIVE_H; y++)
+        for (uint16_t x = 0; x < NATIVE_W; x++)
+        {
+            double r = hypot(x - NATIVE_W / 2.0, y - NATIVE_H / 2.0);
+            double value = y * 255.0 / NATIVE_H;
+            gray[y * NATIVE_W + x] = (uint8_t)(r < 40 ? 255 - value : value);
+        }
+    Bytes frame(FRAME_BYTES, 0xFF);
+    GrayDither dither;
+    dither.begin(method, NATIVE_W, NATIVE_H, NATIVE_W, NATIVE_H);
+    uint16_t y = 0;
+    for (uint8_t value : gray)
+        if (dither.add(value))
+            while (dither.nextRow(frame.data() + y * NATIVE_STRIDE, NATIVE_STRIDE))
+                y++;
+    return frame;
+}
+
+static Bytes qrFrame(const char *payload)
+{
+    Bytes frame(FRAME_BYTES, 0xFF);
+    QrCode code;
+    if (!qrEncodeText(code, payload, 7, QR_ECC_MEDIUM))
+        return frame;
+    uint8_t scale = NATIVE_W / (code.size + 8);
+    uint16_t left = (NATIVE_W - code.size * scale) / 2, top = (NATIVE_H - code.size * scale) / 2;
+    for (uint16_t my = 0; my < code.size; my++)
+        for (uint16_t mx = 0; mx < code.size; mx++)
+            if (qrModule(code, mx, my))
+                for (uint16_t y = top + my * scale; y < top + (my + 1) * scale; y++)
+                    for (uint16_t x = left + mx * scale; x < left + (mx + 1) * scale; x++)
+                        frame[y * NATIVE_STRIDE + x / 8] &= ~(0x80 >> (x % 8));
+    return frame;
+}
+
+int main()
+{
+    srand(1);
+    int failures = 0;
+    struct Case
+    {
+        const char *name;
+        Bytes data;
+        bool image;
+        bool gray;
+        Bytes source; // Image: what the CRC covers
+    };
+    std::vector<Case> cases;
+    cases.push_back({"personal: short", text("data:personal:Jane Doe\nEngineer"), false, false, {}});
+    cases.push_back({"personal: contact",
+                     text("data:personal:Jane Doe\nSenior Engineer\n+44 20 7946 0000\njane.doe@example.com\n"
+                          "https://example.com/jane"),
+                     false, false, {}});
+    cases.push_back({"personal: 250 chars",
+                     text("data:personal:Dr. Jane Alexandra Doe-Smith\nSenior Firmware Engineer, Embedded Systems\n"
+                          "Example Corporation Ltd.\n+44 20 7946 0000\n+44 7700 900 123\njane.doe-smith@example.com\n"
+                          "https://example.com/people/jane-doe-smith\nAsk me about e-paper!"),
+                     false, false, {}});
+    cases.push_back({"qr: url", text("data:qr:https://example.com/events/2024/badge?ref=nametag"), false, false, {}});
+    cases.push_back({"qr: wifi", text("data:qr:WIFI:T:WPA;S:Example Guest;P:correct-horse-battery;;"), false, false,
+                     {}});
+    cases.push_back({"mecard",
+                     text("MECARD:N:Jane Doe;TEL:+442079460000;EMAIL:jane.doe@example.com;"
+                          "URL:https://example.com/jane;NOTE:Senior Engineer;;"),
+                     false, false, {}});
+    Bytes gray;
+    Bytes frame = ditheredFrame(DITHER_FLOYD_STEINBERG, gray);
+    cases.push_back({"frame: Floyd-Steinberg", frame, true, false, frame});
+    frame = ditheredFrame(DITHER_ORDERED, gray);
+    cases.push_back({"frame: ordered", frame, true, false, frame});
+    frame = qrFrame("https://example.com/events/2024/badge?ref=nametag");
+    cases.push_back({"frame: QR", frame, true, false, frame});
+    frame.assign(FRAME_BYTES, 0xFF);
+    cases.push_back({"frame: blank", frame, true, false, frame});
+    cases.push_back({"gray 122x250", gray, true, true, gray});
+
+    printf("%-24s %6s %6s %6s %9s %9s %9s %9s %8s\n", "payload", "plain", "rle", "lz", "MTU247 ms", "lz ms",
+           "MTU23 ms", "lz ms", "decode");
+    for (const Case &c : cases)
+    {
+        Bytes lz = lzCompress(c.data);
+        size_t lzOnAir = lz.size() + (c.image ? 0 : 3); // "lz:" prefix on data writes
+        bool ok = lzRoundTrip(lz, c.data);
+        if (c.image)
+            ok = ok && imageRoundTrip(lz, c.source, c.gray, c.gray ? nullptr : c.data.data());
+
+        LzDecoder decoder;
+        static uint8_t out[NATIVE_W * NATIVE_H];
+        auto start = std::chrono::steady_clock::now();
+        const int runs = 200;
+        for (int run = 0; run < runs; run++)
+            ok = ok && lzDecodeBuffer(decoder, lz.data(), lz.size(), out, sizeof(out)) == (int32_t)c.data.size();
+        double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / runs;
+
+        size_t big = c.image ? IMAGE_CHUNK_MAX : 244, small = c.image ? 16 : 20;
+        char rle[16] = "-";
+        if (c.image)
+            snprintf(rle, sizeof(rle), "%u", (unsigned)packBits(c.data).size());
+        printf("%-24s %6u %6s %6u %9.0f %9.0f %9.0f %9.0f %6.0fus%s\n", c.name, (unsigned)c.data.size(), rle,
+               (unsigned)lzOnAir, transferMs(c.data.size(), big), transferMs(lzOnAir, big),
+               transferMs(c.data.size(), small), transferMs(lzOnAir, small), us, ok ? "" : "  ROUND TRIP FAILED");
+        if (!ok)
+            failures++;
+    }
+    printf("\nDecoder state: %u bytes (LzDecoder), no heap\n%d failure(s)\n", (unsigned)sizeof(LzDecoder), failures);
+    return failures == 0 ? 0 : 1;
+}
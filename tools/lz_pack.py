@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+"""LZSS encoder for the badge's compressed BLE payloads (src/lz_stream.h).
+
+Greedy, longest match in the last 256 bytes (nearest wins a tie), matches
+of 2 to 64 bytes; tools/lz_bench.cpp has the same encoder in C++ and checks
+the badge decoder against it. Commands under ~100 bytes rarely shrink, and
+PackBits beats it on near-blank frames: send whichever is smaller. Two uses:
+
+  data characteristic: any command, compressed and sent as "lz:" + bytes
+    python3 tools/lz_pack.py "data:personal:Jane Doe\\n+44 20 7946 0000"
+  image upload: the stream after image:begin:lz (see image_pack.py --lz)
+
+Prints raw and compressed sizes and the ATT writes each needs. With -o the
+compressed bytes (with the "lz:" prefix for a command) are written to a
+file; with --hex they are printed. Only the standard library is needed.
+"""
+
+import argparse
+import sys
+
+WINDOW_BITS = 8     # LZ_WINDOW_BITS
+LOOKAHEAD_BITS = 6  # LZ_LOOKAHEAD_BITS
+WINDOW_SIZE = 1 << WINDOW_BITS
+MAX_MATCH = 1 << LOOKAHEAD_BITS
+MIN_MATCH = 2       # 15 bits against 18 for two literals
+
+
+def compress(data):
+    out = bytearray()
+    acc = 0
+    acc_bits = 0
+
+    def put(value, count):
+        nonlocal acc, acc_bits
+        acc = (acc << count) | value
+        acc_bits += count
+        while acc_bits >= 8:
+            acc_bits -= 8
+            out.append((acc >> acc_bits) & 0xFF)
+        acc &= (1 << acc_bits) - 1
+
+    i = 0
+    while i < len(data):
+        best_length, best_offset = 0, 0
+        limit = min(MAX_MATCH, len(data) - i)
+        for offset in range(1, min(WINDOW_SIZE, i) + 1):
+            length = 0
+            while length < limit and data[i - offset + length] == data[i + length]:
+                length += 1
+            if length > best_length:
+                best_length, best_offset = length, offset
+                if length == limit:
+                    break
+        if best_length >= MIN_MATCH:
+            put(0, 1)
+            put(best_offset - 1, WINDOW_BITS)
+            put(best_length - 1, LOOKAHEAD_BITS)
+            i += best_length
+        else:
+            put(1, 1)
+            put(data[i], 8)
+            i += 1
+    if acc_bits:
+        put(0, 8 - acc_bits)
+    return bytes(out)
+
+
+def writes(size, payload_per_write):
+    return (size + payload_per_write - 1) // payload_per_write
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compress a data characteristic command for the badge.")
+    parser.add_argument("command", nargs="?", help="command text (\\n is a newline)")
+    parser.add_argument("-f", "--file", help="compress this file instead (raw bytes, no lz: prefix)")
+    parser.add_argument("-o", "--output", help="write the compressed bytes here")
+    parser.add_argument("--hex", action="store_true", help="print the compressed bytes as hex")
+    args = parser.parse_args()
+
+    if args.file:
+        with open(args.file, "rb") as f:
+            data = f.read()
+        prefix = b""
+    elif args.command is not None:
+        data = args.command.replace("\\n", "\n").encode("utf-8")
+        prefix = b"lz:"
+    else:
+        parser.error("give a command or --file")
+    packed = prefix + compress(data)
+    if args.output:
+        with open(args.output, "wb") as f:
+            f.write(packed)
+    print("lz_pack: %d bytes -> %d bytes (%.0f%%); writes at ATT MTU 23: %d -> %d, at MTU 247: %d -> %d" % (
+        len(data), len(packed), 100.0 * len(packed) / max(len(data), 1),
+        writes(len(data), 20), writes(len(packed), 20), writes(len(data), 244), writes(len(packed), 244)))
+    if args.hex:
+        print(packed.hex())
+
+
+if __name__ == "__main__":
+    sys.exit(main())
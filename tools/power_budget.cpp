@@ -0,0 +1,34 @@
+/**
+ * @file power_budget.cpp
+ * @brief Host simulation: estimated daily charge for each built-in power policy.
+ *        Runs the firmware's SleepScheduler with the PowerProfile figures from
+ *        sleep_scheduler.cpp. Build and run on the host:
+ *
+ *          g++ -std=c++11 -Isrc tools/power_budget.cpp src/sleep_scheduler.cpp -o power_budget && ./power_budget
+ */
+#include <stdio.h>
+
+#include "sleep_scheduler.h"
+
+int main()
+{
+    const uint16_t BUTTON_WAKES[] = {0, 10, 50};
+    const uint32_t BATTERY_CAPACITY_MAH = 1000; // Typical LiPo used with the T5 boards
+
+    PowerProfile profile = defaultPowerProfile();
+    printf("%-10s %6s %5s %8s %6s | %-28s | %s\n", "policy", "awake", "fast", "timer", "burst",
+           "mAh/day @ 0/10/50 presses", "days on 1000 mAh @ 10");
+    for (int i = 0; i < PRESET_COUNT; i++)
+    {
+        PowerPolicy policy = powerPolicyPreset((PowerPreset)i);
+        uint32_t uah[3];
+        for (int j = 0; j < 3; j++)
+            uah[j] = simulateDailyChargeUah(policy, profile, BUTTON_WAKES[j]);
+        printf("%-10s %5us %4us %7lus %5ums | %8.2f %8.2f %8.2f    | %.0f\n",
+               powerPresetName((PowerPreset)i), policy.awakeTimeoutS, policy.fastAdvDurationS,
+               (unsigned long)policy.timerWakePeriodS, policy.timerWakeAdvMs,
+               uah[0] / 1000.0, uah[1] / 1000.0, uah[2] / 1000.0,
+               BATTERY_CAPACITY_MAH * 1000.0 / uah[1]);
+    }
+    return 0;
+}
@@ -0,0 +1,139 @@
+/**
+ * @file qr_bench.cpp
+ * @brief Host benchmark: qr_encoder.cpp against ricmoo/QRCode's
+ *        qrcode_initText() for versions 1 to QR_MAX_VERSION at every ECC
+ *        level, each with the longest byte payload that fits. Reports encode
+ *        time, how many rows / columns the mask search scored before cutting
+ *        masks short, and checks both produce the same modules (same mask
+ *        included). Then typical data:qr: payloads: smallest version (and
+ *        module size on the 122 px panel) when the whole text is one segment
+ *        in the densest mode that covers it (what the library does) against
+ *        the mixed-mode segmentation. On the badge, encodeQrCode() logs the
+ *        encode time. Build and run:
+ *
+ *          gcc -c .pio/libdeps/t5_213/QRCode/src/qrcode.c -o qrcode.o
+ *          g++ -std=c++11 -O2 -Isrc -I.pio/libdeps/t5_213/QRCode/src tools/qr_bench.cpp \
+ *              src/qr_encoder.cpp qrcode.o -o qr_bench && ./qr_bench
+ */
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include <qrcode.h>
+
+#include "qr_encoder.h"
+
+static const int RUNS = 200;
+static const char *ECC_NAMES = "LMQH";
+static const uint8_t BADGE_MAX_VERSION = 7; // MAX_QR_VERSION in main.cpp
+static const int16_t PANEL_SHORT_SIDE = 122;
+static const uint8_t QUIET_ZONE = 4;
+
+// Longest byte-mode payload for the version / ECC level: a URL padded with path characters
+static uint16_t fillPayload(char *text, uint8_t version, QrEcc ecc)
+{
+    uint16_t countBits = version < 10 ? 8 : 16;
+    uint16_t length = (qrDataCapacityBits(version, ecc) - 4 - countBits) / 8;
+    const char *url = "https://example.com/badge/";
+    for (uint16_t i = 0; i < length; i++)
+        text[i] = i < strlen(url) ? url[i] : (char)('a' + i % 26);
+    text[length] = '\0';
+    return length;
+}
+
+// Smallest version holding `text` as one numeric, alphanumeric or byte segment
+static uint8_t singleModeVersion(const char *text, QrEcc ecc, uint8_t maxVersion)
+{
+    bool numeric = true, alphanumeric = true;
+    uint16_t length = strlen(text);
+    for (uint16_t i = 0; i < length; i++)
+    {
+        char c = text[i];
+        if (c < '0' || c > '9')
+            numeric = false;
+        if (!((c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || strchr(" $%*+-./:", c) != nullptr))
+            alphanumeric = false;
+    }
+    for (uint8_t version = 1; version <= maxVersion; version++)
+    {
+        uint16_t bits = numeric        ? 4 + (version < 10 ? 10 : 12) + 10 * (length / 3) + (length % 3 ? 3 * (length % 3) + 1 : 0)
+                        : alphanumeric ? 4 + (version < 10 ? 9 : 11) + 11 * (length / 2) + 6 * (length % 2)
+                                       : 4 + (version < 10 ? 8 : 16) + 8 * length;
+        if (bits <= qrDataCapacityBits(version, ecc))
+            return version;
+    }
+    return 0;
+}
+
+int main()
+{
+    static char text[QR_MAX_CODEWORDS + 1];
+    static uint8_t buffer[1024];
+    static QrCode code;
+    QRCode reference;
+    unsigned failures = 0;
+
+    printf("%-3s %-3s %5s | %13s %13s %7s | %12s | %s\n", "ver", "ecc", "chars", "initText us", "qrEncode us",
+           "speedup", "lines scored", "modules");
+    for (uint8_t version = 1; version <= QR_MAX_VERSION; version++)
+        for (uint8_t ecc = QR_ECC_LOW; ecc <= QR_ECC_HIGH; ecc++)
+        {
+            uint16_t length = fillPayload(text, version, (QrEcc)ecc);
+
+            auto t0 = std::chrono::steady_clock::now();
+            int8_t libResult = 0;
+            for (int run = 0; run < RUNS; run++)
+                libResult = qrcode_initText(&reference, buffer, version, ecc, text);
+            auto t1 = std::chrono::steady_clock::now();
+            bool ok = true;
+            for (int run = 0; run < RUNS; run++)
+                ok = qrEncodeText(code, text, version, (QrEcc)ecc, version);
+            auto t2 = std::chrono::steady_clock::now();
+            double libUs = std::chrono::duration<double, std::micro>(t1 - t0).count() / RUNS;
+            double ourUs = std::chrono::duration<double, std::micro>(t2 - t1).count() / RUNS;
+
+            const char *result = "same";
+            if (libResult != 0 || !ok)
+                result = ok ? "LIBRARY FAILED" : "ENCODE FAILED";
+            else
+                for (uint8_t y = 0; y < code.size; y++)
+                    for (uint8_t x = 0; x < code.size; x++)
+                        if (qrModule(code, x, y) != qrcode_getModule(&reference, x, y))
+                            result = "DIFFERENT";
+            if (strcmp(result, "same") != 0)
+                failures++;
+            printf("%3u %3c %5u | %13.1f %13.1f %6.1fx | %5u / %4u | %s (mask %u)\n", version, ECC_NAMES[ecc],
+                   length, libUs, ourUs, libUs / ourUs, qrLinesScored(), 8 * 2 * code.size, result, code.mask);
+        }
+
+    // Smallest version at ECC_LOW, single mode (library) against mixed segments
+    const char *payloads[] = {
+        "https://example.com/badge/12345",
+        "HTTPS://EXAMPLE.COM/BADGE/12345",
+        "https://example.com/u/JANE-DOE-2024?ref=BADGE0001",
+        "TEL:+15550100",
+        "tel:+44 20 7946 0958",
+        "WIFI:S:Office;T:WPA;P:8754 2211 9034;;",
+        "MECARD:N:DOE,JANE;TEL:+15550100;EMAIL:JANE@EXAMPLE.COM;;",
+        "BEGIN:VCARD\nVERSION:3.0\nFN:Jane Doe\nTEL:+15550100\nEND:VCARD",
+    };
+    printf("\n%-52s | %13s | %21s\n", "payload", "single mode", "mixed segments");
+    for (const char *payload : payloads)
+    {
+        uint8_t singleVersion = singleModeVersion(payload, QR_ECC_LOW, BADGE_MAX_VERSION);
+        bool ok = qrEncodeText(code, payload, BADGE_MAX_VERSION, QR_ECC_LOW);
+        int singleScale = singleVersion ? PANEL_SHORT_SIDE / (4 * singleVersion + 17 + 2 * QUIET_ZONE) : 0;
+        int mixedScale = ok ? PANEL_SHORT_SIDE / (code.size + 2 * QUIET_ZONE) : 0;
+        if (!ok || (singleVersion != 0 && code.version > singleVersion))
+            failures++;
+        char shown[53];
+        snprintf(shown, sizeof(shown), "%s", payload);
+        for (char *c = shown; *c; c++)
+            if (*c == '\n')
+                *c = '|';
+        printf("%-52s | v%-2u %2d px/mod | v%-2u %2d px/mod %u seg\n", shown, singleVersion, singleScale,
+               ok ? code.version : 0, mixedScale, ok ? code.segments : 0);
+    }
+    printf("%u failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
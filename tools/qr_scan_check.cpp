@@ -0,0 +1,539 @@
+/**
+ * @file qr_scan_check.cpp
+ * @brief Host check: QR screens as rendered on the panel decode back to the
+ *        payload. Each case is recorded with screens.cpp (as updateDisplay()
+ *        does), replayed into a 122x250 frame and read back by the small
+ *        decoder below, which only sees pixels: it finds the symbol, works
+ *        out module size and version from the finder pattern, samples module
+ *        centers, reads format / version information, unmasks, checks every
+ *        Reed-Solomon block and parses the segments. Its tables and rules are
+ *        written from the standard, not shared with qr_encoder.cpp. Every
+ *        symbol must also keep a clear 4-module quiet zone inside its screen
+ *        area, which is what clipped or clamped placements lose.
+ *        Cases: versions 1 to 7 (MAX_QR_VERSION) at every ECC level with the
+ *        longest mixed payload that fits, at every scale that fits the panel;
+ *        typical data:qr: payloads and a contact card at the badge's scale;
+ *        the split screen; and one scale too large, which has to be rejected.
+ *        Decode time is reported as a rough proxy for how hard the image is
+ *        to scan. Build and run:
+ *
+ *          g++ -std=c++11 -O2 -Itools/host -Isrc -I".pio/libdeps/t5_213/Adafruit GFX Library" \
+ *              tools/qr_scan_check.cpp src/screens.cpp src/display_list.cpp src/glyph_blit.cpp \
+ *              src/text_layout.cpp src/qr_encoder.cpp src/contact_card.cpp -o qr_scan_check && ./qr_scan_check
+ */
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+
+#include <Adafruit_GFX.h>
+#include <Fonts/FreeSans9pt7b.h>
+#include <Fonts/FreeSans12pt7b.h>
+#include <Fonts/FreeSans18pt7b.h>
+#include <Fonts/FreeSans24pt7b.h>
+#include <Fonts/FreeSansBold9pt7b.h>
+#include <Fonts/FreeSansBold12pt7b.h>
+#include <Fonts/FreeSansBold18pt7b.h>
+#include <Fonts/FreeSansBold24pt7b.h>
+
+#include "contact_card.h"
+#include "display_list.h"
+#include "glyph_blit.h"
+#include "qr_encoder.h"
+#include "screens.h"
+#include "text_layout.h"
+
+static const ScreenFonts FONTS = {
+    {{&FreeSans9pt7b, &FreeSans12pt7b, &FreeSans18pt7b, &FreeSans24pt7b},
+     {&FreeSansBold9pt7b, &FreeSansBold12pt7b, &FreeSansBold18pt7b, &FreeSansBold24pt7b}},
+    &FreeSans12pt7b,
+    &FreeSans9pt7b};
+
+// Firmware settings (main.cpp, board_traits.h for the T5 2.13")
+static const uint16_t MAX_INFO_CHARS = 250;
+static const uint8_t MAX_QR_VERSION = 7;
+static const uint8_t QR_QUIET_ZONE = 4;
+static const uint16_t NATIVE_STRIDE = 128 / 8;
+static const int16_t NATIVE_W = 122, NATIVE_H = 250;
+static const uint8_t ROTATION = 1;
+static const int16_t AREA_W = NATIVE_H, AREA_H = NATIVE_W;
+static const size_t FRAME_BYTES = NATIVE_STRIDE * NATIVE_H;
+static const int DECODE_RUNS = 20;
+
+// --- Decoder tables (ISO/IEC 18004, versions 1-10, order L M Q H) ---
+static const uint8_t ECC_PER_BLOCK[4][10] = {
+    {7, 10, 15, 20, 26, 18, 20, 24, 30, 18},
+    {10, 16, 26, 18, 24, 16, 18, 22, 22, 26},
+    {13, 22, 18, 26, 18, 24, 18, 22, 20, 24},
+    {17, 28, 22, 16, 22, 28, 26, 26, 24, 28}};
+static const uint8_t BLOCKS[4][10] = {
+    {1, 1, 1, 1, 1, 2, 2, 2, 2, 4},
+    {1, 1, 1, 2, 2, 4, 4, 4, 5, 5},
+    {1, 1, 2, 2, 4, 4, 6, 6, 8, 8},
+    {1, 1, 2, 4, 4, 4, 5, 6, 8, 8}};
+static const uint8_t FORMAT_ECC[4] = {1, 0, 3, 2}; // Format information value of L M Q H
+static const char *ECC_NAMES = "LMQH";
+
+static uint8_t gfExp[512], gfLog[256];
+
+static void gfInit()
+{
+    uint16_t x = 1;
+    for (int i = 0; i < 255; i++)
+    {
+        gfExp[i] = gfExp[i + 255] = (uint8_t)x;
+        gfLog[x] = (uint8_t)i;
+        x <<= 1;
+        if (x & 0x100)
+            x ^= 0x11D;
+    }
+}
+
+static uint32_t bchRemainder(uint32_t value, uint32_t poly, int polyDegree)
+{
+    uint32_t r = value << polyDegree;
+    for (int bit = 31; bit >= polyDegree; bit--)
+        if (r & (1u << bit))
+            r ^= poly << (bit - polyDegree);
+    return r;
+}
+
+static int bitCount(uint32_t v)
+{
+    int n = 0;
+    for (; v; v &= v - 1)
+        n++;
+    return n;
+}
+
+struct Symbol
+{
+    int size;
+    int version;
+    bool dark[64][64];      // [y][x]
+    bool function[64][64];
+};
+
+struct ScanResult
+{
+    bool ok;
+    std::string text;
+    const char *error;
+    int version, scale;
+    char ecc;
+    int mask;
+};
+
+static ScanResult fail(ScanResult r, const char *error)
+{
+    r.error = error;
+    return r;
+}
+
+static bool logicalBlack(const uint8_t *frame, int16_t x, int16_t y)
+{
+    // Rotation 1: logical (x, y) is native (NATIVE_W - 1 - y, x)
+    int16_t nx = NATIVE_W - 1 - y, ny = x;
+    return !(frame[ny * NATIVE_STRIDE + nx / 8] & (0x80 >> (nx % 8)));
+}
+
+static void markFunction(Symbol &s)
+{
+    int n = s.size;
+    memset(s.function, 0, sizeof(s.function));
+    for (int y = 0; y < n; y++)
+        for (int x = 0; x < n; x++)
+            if ((x < 9 && y < 9) || (x >= n - 8 && y < 9) || (x < 9 && y >= n - 8) || x == 6 || y == 6)
+                s.function[y][x] = true; // Finders, separators, format areas, timing
+    if (s.version >= 2)
+    {
+        int count = s.version / 7 + 2;
+        int step = (s.version * 4 + count * 2 + 1) / (count * 2 - 2) * 2;
+        int positions[7] = {6};
+        for (int i = count - 1, p = n - 7; i >= 1; i--, p -= step)
+            positions[i] = p;
+        for (int i = 0; i < count; i++)
+            for (int j = 0; j < count; j++)
+            {
+                if ((i == 0 && j == 0) || (i == 0 && j == count - 1) || (i == count - 1 && j == 0))
+                    continue; // Finder corners
+                for (int dy = -2; dy <= 2; dy++)
+                    for (int dx = -2; dx <= 2; dx++)
+                        s.function[positions[j] + dy][positions[i] + dx] = true;
+            }
+    }
+    if (s.version >= 7)
+        for (int i = 0; i < 18; i++)
+            s.function[i / 3][n - 11 + i % 3] = s.function[n - 11 + i % 3][i / 3] = true;
+}
+
+static bool maskBit(int mask, int y, int x)
+{
+    switch (mask)
+    {
+    case 0: return (y + x) % 2 == 0;
+    case 1: return y % 2 == 0;
+    case 2: return x % 3 == 0;
+    case 3: return (y + x) % 3 == 0;
+    case 4: return (y / 2 + x / 3) % 2 == 0;
+    case 5: return (y * x) % 2 + (y * x) % 3 == 0;
+    case 6: return ((y * x) % 2 + (y * x) % 3) % 2 == 0;
+    default: return ((y + x) % 2 + (y * x) % 3) % 2 == 0;
+    }
+}
+
+// Closest valid format word to the 15 bits read, or -1 if more than 3 bits are off
+static int decodeFormat(uint32_t bits)
+{
+    int best = -1, bestDistance = 4;
+    for (uint32_t data = 0; data < 32; data++)
+    {
+        uint32_t word = ((data << 10) | bchRemainder(data, 0x537, 10)) ^ 0x5412;
+        int distance = bitCount(word ^ bits);
+        if (distance < bestDistance)
+            best = data, bestDistance = distance;
+    }
+    return best;
+}
+
+static bool syndromesZero(const uint8_t *block, int length, int eccLength)
+{
+    for (int i = 0; i < eccLength; i++)
+    {
+        uint8_t s = 0;
+        for (int k = 0; k < length; k++)
+            s = (s ? gfExp[gfLog[s] + i] : 0) ^ block[k]; // Horner at alpha^i
+        if (s != 0)
+            return false;
+    }
+    return true;
+}
+
+// Reads the symbol whose top left finder is the first dark pixel of the area
+// (x0, y0, w, h), checks its quiet zone inside the area, and decodes it
+static ScanResult scan(const uint8_t *frame, int16_t x0, int16_t y0, int16_t w, int16_t h)
+{
+    ScanResult r = {false, "", "", 0, 0, '?', -1};
+    int top = -1, left = -1;
+    for (int y = y0; y < y0 + h && top < 0; y++)
+        for (int x = x0; x < x0 + w; x++)
+            if (logicalBlack(frame, x, y))
+            {
+                top = y, left = x;
+                break;
+            }
+    if (top < 0)
+        return fail(r, "no dark pixels");
+    int run = 0;
+    while (left + run < x0 + w && logicalBlack(frame, left + run, top))
+        run++;
+    int right = x0 + w - 1;
+    while (right > left && !logicalBlack(frame, right, top))
+        right--;
+    if (run % 7 != 0)
+        return fail(r, "finder width not 7 modules");
+    int scale = run / 7;
+    int size = (right - left + 1) / scale;
+    if ((right - left + 1) % scale != 0 || size < 21 || (size - 17) % 4 != 0 || (size - 17) / 4 > 10)
+        return fail(r, "symbol width is not a version 1-10 size");
+    r.scale = scale;
+
+    // Quiet zone: clear and inside the area on every side
+    int quiet = QR_QUIET_ZONE * scale;
+    int span = size * scale;
+    if (left - quiet < x0 || top - quiet < y0 || left + span + quiet > x0 + w || top + span + quiet > y0 + h)
+        return fail(r, "quiet zone cut off (clipped or clamped)");
+    for (int y = top - quiet; y < top + span + quiet; y++)
+        for (int x = left - quiet; x < left + span + quiet; x++)
+            if ((x < left || x >= left + span || y < top || y >= top + span) && logicalBlack(frame, x, y))
+                return fail(r, "quiet zone not clear");
+
+    static Symbol s;
+    s.size = size;
+    s.version = (size - 17) / 4;
+    for (int y = 0; y < size; y++)
+        for (int x = 0; x < size; x++)
+            s.dark[y][x] = logicalBlack(frame, left + x * scale + scale / 2, top + y * scale + scale / 2);
+
+    // Format information, both copies (bit 14 first)
+    uint32_t first = 0, second = 0;
+    for (int i = 0; i <= 5; i++)
+        first = first << 1 | s.dark[8][i];
+    first = first << 1 | s.dark[8][7];
+    first = first << 1 | s.dark[8][8];
+    first = first << 1 | s.dark[7][8];
+    for (int i = 5; i >= 0; i--)
+        first = first << 1 | s.dark[i][8];
+    for (int i = 0; i < 7; i++)
+        second = second << 1 | s.dark[size - 1 - i][8];
+    for (int i = 7; i >= 0; i--)
+        second = second << 1 | s.dark[8][size - 1 - i];
+    int format = decodeFormat(first);
+    if (format < 0 || format != decodeFormat(second))
+        return fail(r, "format information unreadable");
+    int eccIndex = 0;
+    while (FORMAT_ECC[eccIndex] != (format >> 3))
+        eccIndex++;
+    r.ecc = ECC_NAMES[eccIndex];
+    r.mask = format & 7;
+    if (!s.dark[size - 8][8])
+        return fail(r, "dark module missing");
+
+    if (s.version >= 7)
+    {
+        uint32_t bits = 0;
+        for (int i = 17; i >= 0; i--)
+            bits = bits << 1 | s.dark[i / 3][size - 11 + i % 3];
+        if (bits >> 12 != (uint32_t)s.version || bchRemainder(s.version, 0x1F25, 12) != (bits & 0xFFF))
+            return fail(r, "version information does not match the size");
+    }
+    r.version = s.version;
+
+    // Codewords, zigzag from the bottom right corner
+    markFunction(s);
+    int rawModules = (16 * s.version + 128) * s.version + 64;
+    if (s.version >= 2)
+    {
+        int count = s.version / 7 + 2;
+        rawModules -= (25 * count - 10) * count - 55;
+        if (s.version >= 7)
+            rawModules -= 36;
+    }
+    int total = rawModules / 8;
+    uint8_t codewords[400] = {0};
+    int bit = 0;
+    for (int rightCol = size - 1; rightCol >= 1; rightCol -= 2)
+    {
+        if (rightCol == 6)
+            rightCol = 5;
+        bool upward = ((rightCol + 1) & 2) == 0;
+        for (int v = 0; v < size; v++)
+        {
+            int y = upward ? size - 1 - v : v;
+            for (int j = 0; j < 2; j++)
+            {
+                int x = rightCol - j;
+                if (s.function[y][x])
+                    continue;
+                if (bit < total * 8 && (s.dark[y][x] ^ maskBit(r.mask, y, x)))
+                    codewords[bit >> 3] |= 0x80 >> (bit & 7);
+                bit++;
+            }
+        }
+    }
+    if (bit / 8 != total)
+        return fail(r, "codeword count does not match the version");
+
+    // De-interleave: short blocks first, each one codeword shorter in the data part
+    int blocks = BLOCKS[eccIndex][s.version - 1], eccLength = ECC_PER_BLOCK[eccIndex][s.version - 1];
+    int shortBlocks = blocks - total % blocks, shortLength = total / blocks;
+    static uint8_t blockData[8][200];
+    int index = 0;
+    for (int i = 0; i <= shortLength; i++)
+        for (int b = 0; b < blocks; b++)
+        {
+            int k = i;
+            if (b < shortBlocks && i > shortLength - eccLength)
+                k = i - 1; // ECC part of a short block
+            if (b < shortBlocks && i == shortLength - eccLength)
+                continue; // Hole where long blocks carry one more data codeword
+            blockData[b][k] = codewords[index++];
+        }
+    if (index != total)
+        return fail(r, "block layout mismatch");
+    uint8_t data[400];
+    int dataLength = 0;
+    for (int b = 0; b < blocks; b++)
+    {
+        int length = shortLength + (b >= shortBlocks);
+        if (!syndromesZero(blockData[b], length, eccLength))
+            return fail(r, "Reed-Solomon check failed");
+        memcpy(data + dataLength, blockData[b], length - eccLength);
+        dataLength += length - eccLength;
+    }
+
+    // Segments
+    int pos = 0, bits = dataLength * 8;
+    auto read = [&](int n) {
+        uint32_t v = 0;
+        for (int i = 0; i < n; i++, pos++)
+            v = v << 1 | ((data[pos >> 3] >> (7 - (pos & 7))) & 1);
+        return v;
+    };
+    const char *ALNUM = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:";
+    bool large = s.version >= 10;
+    while (pos + 4 <= bits)
+    {
+        uint32_t mode = read(4);
+        if (mode == 0)
+            break;
+        int countBits = mode == 1 ? (large ? 12 : 10) : mode == 2 ? (large ? 11 : 9) : mode == 4 ? (large ? 16 : 8) : 0;
+        if (countBits == 0 || pos + countBits > bits)
+            return fail(r, "unknown segment mode");
+        int count = read(countBits);
+        int need = mode == 1 ? 10 * (count / 3) + (count % 3 ? 3 * (count % 3) + 1 : 0)
+                   : mode == 2 ? 11 * (count / 2) + 6 * (count % 2)
+                               : 8 * count;
+        if (pos + need > bits)
+            return fail(r, "segment runs past the data");
+        if (mode == 1)
+        {
+            for (; count >= 3; count -= 3)
+            {
+                uint32_t v = read(10);
+                if (v > 999)
+                    return fail(r, "bad numeric group");
+                char digits[4];
+                snprintf(digits, sizeof(digits), "%03u", v);
+                r.text += digits;
+            }
+            if (count > 0)
+            {
+                uint32_t v = read(count == 2 ? 7 : 4);
+                char digits[3];
+                snprintf(digits, sizeof(digits), count == 2 ? "%02u" : "%u", v);
+                r.text += digits;
+            }
+        }
+        else if (mode == 2)
+        {
+            for (; count >= 2; count -= 2)
+            {
+                uint32_t v = read(11);
+                if (v >= 45 * 45)
+                    return fail(r, "bad alphanumeric pair");
+                r.text += ALNUM[v / 45];
+                r.text += ALNUM[v % 45];
+            }
+            if (count)
+                r.text += ALNUM[read(6) % 45];
+        }
+        else
+            for (; count > 0; count--)
+                r.text += (char)read(8);
+    }
+    r.ok = true;
+    return r;
+}
+
+// Longest text of the pattern that encodes in exactly this version and ECC level
+static std::string fillPayload(uint8_t version, QrEcc ecc, QrCode &code)
+{
+    const char *pattern = "https://example.com/badge/0042?ID=JANE-DOE-2024&n=5550100#";
+    std::string text, best;
+    for (int i = 0;; i++)
+    {
+        text += pattern[i % strlen(pattern)];
+        if (!qrEncodeText(code, text.c_str(), version, ecc, version))
+            break;
+        best = text;
+    }
+    qrEncodeText(code, best.c_str(), version, ecc, version);
+    return best;
+}
+
+struct Totals
+{
+    unsigned cases, failures;
+    double slowestUs;
+};
+
+// Scans the frame DECODE_RUNS times and compares the text (or expects the scan to fail)
+static void check(Totals &totals, const char *label, const uint8_t *frame, int16_t x0, int16_t w,
+                  const std::string &expected, bool expectFailure = false)
+{
+    ScanResult result;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int run = 0; run < DECODE_RUNS; run++)
+        result = scan(frame, x0, 0, w, AREA_H);
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / DECODE_RUNS;
+    bool passed = expectFailure ? !result.ok : (result.ok && result.text == expected);
+    totals.cases++;
+    if (!passed)
+        totals.failures++;
+    if (us > totals.slowestUs)
+        totals.slowestUs = us;
+    const char *status = passed ? (expectFailure ? "rejected" : "ok")
+                                : (result.ok ? (expectFailure ? "NOT REJECTED" : "WRONG TEXT") : result.error);
+    printf("%-28s v%-2d %c %2d px mask %d %7.1f us  %s%s%s\n", label, result.version, result.ecc, result.scale,
+           result.mask, us, status, expectFailure && passed ? ": " : "", expectFailure && passed ? result.error : "");
+}
+
+static void renderQr(uint8_t *frame, DisplayList &list, const QrCode &code, uint8_t scale)
+{
+    list.clear();
+    recordQrScreen(list, QR_SCREEN_OK, &code, scale, FONTS, AREA_W, AREA_H);
+    PackedFrame packed = packedFrame(frame, NATIVE_STRIDE, NATIVE_W, NATIVE_H, ROTATION);
+    frameFill(packed, false);
+    list.replay(packed);
+}
+
+int main()
+{
+    gfInit();
+    static uint8_t frame[FRAME_BYTES];
+    static QrCode code;
+    static DisplayList list;
+    Totals totals = {0, 0, 0};
+    char label[64];
+
+    // Every version and ECC level the badge can produce, at every scale that fits
+    for (uint8_t version = 1; version <= MAX_QR_VERSION; version++)
+        for (uint8_t ecc = QR_ECC_LOW; ecc <= QR_ECC_HIGH; ecc++)
+        {
+            std::string text = fillPayload(version, (QrEcc)ecc, code);
+            int maxScale = AREA_H / (code.size + 2 * QR_QUIET_ZONE);
+            for (int scale = 1; scale <= maxScale; scale++)
+            {
+                renderQr(frame, list, code, scale);
+                snprintf(label, sizeof(label), "%u chars, %u seg", (unsigned)text.size(), code.segments);
+                check(totals, label, frame, 0, AREA_W, text);
+            }
+        }
+
+    // Typical payloads the way the QR screen encodes them
+    printf("\n");
+    const char *payloads[] = {
+        "https://example.com/badge",
+        "TEL:+15550100",
+        "WIFI:S:Office;T:WPA;P:8754 2211 9034;;",
+        "mailto:jane.doe@example.com",
+        "BEGIN:VCARD\nVERSION:3.0\nFN:Jane Doe\nTEL:+15550100\nEND:VCARD",
+    };
+    for (const char *payload : payloads)
+    {
+        qrEncodeText(code, payload, MAX_QR_VERSION, QR_ECC_LOW);
+        renderQr(frame, list, code, AREA_H / (code.size + 2 * QR_QUIET_ZONE));
+        snprintf(label, sizeof(label), "%.28s", payload);
+        for (char *c = label; *c; c++)
+            if (*c == '\n')
+                *c = '|';
+        check(totals, label, frame, 0, AREA_W, payload);
+    }
+
+    // Contact card (best ECC level) on its own screen and on the split screen
+    const char *info = "Jane Doe\nFirmware Engineer\njane.doe@example.com\n+1 555 0100";
+    static char card[2 * MAX_INFO_CHARS + 32];
+    if (!encodeContactCard(code, info, MAX_INFO_CHARS, MAX_QR_VERSION, card, sizeof(card)))
+        totals.failures++;
+    uint8_t scale = AREA_H / (code.size + 2 * QR_QUIET_ZONE);
+    renderQr(frame, list, code, scale);
+    check(totals, "contact card", frame, 0, AREA_W, card);
+
+    static InfoLayout layout;
+    computeInfoLayout(info, MAX_INFO_CHARS, FONTS.info, AREA_W - AREA_H, AREA_H, layout);
+    list.clear();
+    recordSplitScreen(list, layout, info, &code, scale, FONTS, AREA_W, AREA_H);
+    PackedFrame packed = packedFrame(frame, NATIVE_STRIDE, NATIVE_W, NATIVE_H, ROTATION);
+    frameFill(packed, false);
+    list.replay(packed);
+    check(totals, "split screen (left square)", frame, 0, AREA_H, card);
+
+    // One scale too large: clamped to the top edge, the quiet zone is lost
+    qrEncodeText(code, "https://example.com/badge", MAX_QR_VERSION, QR_ECC_LOW);
+    renderQr(frame, list, code, AREA_H / (code.size + 2 * QR_QUIET_ZONE) + 1);
+    check(totals, "oversized (must be rejected)", frame, 0, AREA_W, "", true);
+
+    printf("\n%u cases, %u failures, slowest decode %.1f us\n", totals.cases, totals.failures, totals.slowestUs);
+    return totals.failures == 0 ? 0 : 1;
+}
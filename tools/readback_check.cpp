@@ -0,0 +1,227 @@
+/**
+ * @file readback_check.cpp
+ * @brief Host check of the frame read-back (frame_readback.cpp): every frame
+ *        is streamed at the chunk sizes of common ATT MTUs (23, 185, 247,
+ *        517), the chunks must have contiguous offsets, the compressed bytes
+ *        must equal image_pack.py's packbits() of the frame, decode back
+ *        through ImageStream (image:begin:rle) to the same frame, and the end
+ *        record must carry its CRC-32 and size (as summarize() reports them).
+ *        A source that fails mid-frame must end with a bare end record.
+ *        Frames: blank, a QR, a dithered ramp and noise. Build and run:
+ *
+ *          g++ -std=c++11 -O2 -Isrc tools/readback_check.cpp src/frame_readback.cpp src/image_stream.cpp \
+ *              src/image_dither.cpp src/lz_stream.cpp src/qr_encoder.cpp -o readback_check && ./readback_check
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "frame_readback.h"
+#include "image_stream.h"
+#include "qr_encoder.h"
+
+typedef std::vector<uint8_t> Bytes;
+
+static const uint16_t NATIVE_W = 122;
+static const uint16_t NATIVE_H = 250;
+static const uint16_t NATIVE_STRIDE = 16;
+static const size_t FRAME_BYTES = NATIVE_STRIDE * NATIVE_H;
+
+// Same as image_pack.py's packbits()
+static Bytes packBits(const Bytes &data)
+{
+    Bytes out;
+    size_t i = 0;
+    while (i < data.size())
+    {
+        size_t run = 1;
+        while (i + run < data.size() && run < 128 && data[i + run] == data[i])
+            run++;
+        if (run >= 3)
+        {
+            out.push_back((uint8_t)(257 - run));
+            out.push_back(data[i]);
+            i += run;
+            continue;
+        }
+        size_t start = i;
+        while (i < data.size() && i - start < 128)
+        {
+            if (i + 2 < data.size() && data[i] == data[i + 1] && data[i] == data[i + 2])
+                break;
+            i++;
+        }
+        out.push_back((uint8_t)(i - start - 1));
+        out.insert(out.end(), data.begin() + start, data.begin() + i);
+    }
+    return out;
+}
+
+// Rows of a frame in memory; fails from row failAt on
+struct MemoryRows : FrameRows
+{
+    const Bytes *frame;
+    uint16_t failAt = NATIVE_H;
+    const uint8_t *readRow(uint16_t y) override
+    {
+        return y < failAt ? frame->data() + (size_t)y * NATIVE_STRIDE : nullptr;
+    }
+};
+
+struct FrameSink : ImageSink
+{
+    uint8_t frame[FRAME_BYTES];
+    bool writeRows(uint16_t y, const uint8_t *rows, uint16_t count) override
+    {
+        memcpy(frame + (size_t)y * NATIVE_STRIDE, rows, (size_t)count * NATIVE_STRIDE);
+        return true;
+    }
+};
+
+static uint32_t readLittleEndian(const uint8_t *in)
+{
+    return in[0] | (uint32_t)in[1] << 8 | (uint32_t)in[2] << 16 | (uint32_t)in[3] << 24;
+}
+
+// Streams `frame` in chunks of maxData; returns the number of notifications, 0 on a failed check
+static unsigned streamFrame(const Bytes &frame, uint16_t maxData)
+{
+    static uint8_t band[NATIVE_STRIDE * 7];
+    static FrameSink sink;
+    MemoryRows rows;
+    rows.frame = &frame;
+    FrameReadback readback;
+    readback.begin(&rows, NATIVE_STRIDE, NATIVE_H);
+    ImageStream stream;
+    stream.begin(IMAGE_PACKBITS, NATIVE_STRIDE, NATIVE_H, band, 7, &sink);
+    Bytes packed;
+    uint8_t record[4 + FRAME_CHUNK_MAX];
+    unsigned notifications = 0;
+    uint16_t length;
+    uint32_t crc = 0, size = 0;
+    bool ended = false;
+    while ((length = readback.next(record, maxData)) > 0)
+    {
+        notifications++;
+        uint32_t offset = readLittleEndian(record);
+        if (ended || length > 4 + maxData)
+            return 0;
+        if (offset == FRAME_END_OFFSET)
+        {
+            if (length != 12)
+                return 0;
+            crc = readLittleEndian(record + 4);
+            size = readLittleEndian(record + 8);
+            ended = true;
+            continue;
+        }
+        if (offset != packed.size() || !stream.feed(offset, record + 4, length - 4))
+            return 0;
+        packed.insert(packed.end(), record + 4, record + length);
+    }
+    uint32_t summaryCrc, summaryBytes;
+    bool ok = ended && !readback.failed() && packed == packBits(frame) && size == packed.size() &&
+              crc == imageCrc32(frame.data(), frame.size()) && stream.finish(crc) &&
+              memcmp(sink.frame, frame.data(), FRAME_BYTES) == 0 &&
+              FrameReadback::summarize(&rows, NATIVE_STRIDE, NATIVE_H, summaryCrc, summaryBytes) &&
+              summaryCrc == crc && summaryBytes == size;
+    return ok ? notifications : 0;
+}
+
+// A source that stops at row 100: the stream ends with a bare end record
+static bool failedSource(const Bytes &frame)
+{
+    MemoryRows rows;
+    rows.frame = &frame;
+    rows.failAt = 100;
+    FrameReadback readback;
+    readback.begin(&rows, NATIVE_STRIDE, NATIVE_H);
+    uint8_t record[4 + FRAME_CHUNK_MAX];
+    uint16_t length, last = 0;
+    uint32_t lastOffset = 0;
+    while ((length = readback.next(record, 16)) > 0)
+    {
+        last = length;
+        lastOffset = readLittleEndian(record);
+    }
+    uint32_t crc, bytes;
+    return readback.failed() && last == 4 && lastOffset == FRAME_END_OFFSET &&
+           !FrameReadback::summarize(&rows, NATIVE_STRIDE, NATIVE_H, crc, bytes);
+}
+
+// Frames in native orientation
+static Bytes ditheredFrame()
+{
+    Bytes frame(FRAME_BYTES, 0xFF);
+    GrayDither dither;
+    dither.begin(DITHER_FLOYD_STEINBERG, NATIVE_W, NATIVE_H, NATIVE_W, NATIVE_H);
+    uint16_t y = 0;
+    for (uint16_t gy = 0; gy < NATIVE_H; gy++)
+        for (uint16_t gx = 0; gx < NATIVE_W; gx++)
+            if (dither.add((uint8_t)(gy * 255 / NATIVE_H)))
+                while (dither.nextRow(frame.data() + y * NATIVE_STRIDE, NATIVE_STRIDE))
+                    y++;
+    return frame;
+}
+
+static Bytes qrFrame(const char *payload)
+{
+    Bytes frame(FRAME_BYTES, 0xFF);
+    QrCode code;
+    if (!qrEncodeText(code, payload, 7, QR_ECC_MEDIUM))
+        return frame;
+    uint8_t scale = NATIVE_W / (code.size + 8);
+    uint16_t left = (NATIVE_W - code.size * scale) / 2, top = (NATIVE_H - code.size * scale) / 2;
+    for (uint16_t my = 0; my < code.size; my++)
+        for (uint16_t mx = 0; mx < code.size; mx++)
+            if (qrModule(code, mx, my))
+                for (uint16_t y = top + my * scale; y < top + (my + 1) * scale; y++)
+                    for (uint16_t x = left + mx * scale; x < left + (mx + 1) * scale; x++)
+                        frame[y * NATIVE_STRIDE + x / 8] &= ~(0x80 >> (x % 8));
+    return frame;
+}
+
+int main()
+{
+    srand(1);
+    int failures = 0;
+    struct Case
+    {
+        const char *name;
+        Bytes frame;
+    };
+    std::vector<Case> cases;
+    cases.push_back({"blank", Bytes(FRAME_BYTES, 0xFF)});
+    cases.push_back({"QR", qrFrame("https://example.com/events/2024/badge?ref=nametag")});
+    cases.push_back({"dithered ramp", ditheredFrame()});
+    Bytes noise(FRAME_BYTES);
+    for (uint8_t &value : noise)
+        value = rand() & 0xFF;
+    cases.push_back({"noise", noise});
+
+    const uint16_t mtus[] = {23, 185, 247, 517};
+    printf("%-16s %6s %6s", "frame", "raw", "rle");
+    for (uint16_t mtu : mtus)
+        printf("  MTU%-3u", mtu);
+    printf("  (notifications)\n");
+    for (const Case &c : cases)
+    {
+        printf("%-16s %6u %6u", c.name, (unsigned)c.frame.size(), (unsigned)packBits(c.frame).size());
+        for (uint16_t mtu : mtus)
+        {
+            uint16_t maxData = mtu - 7 > FRAME_CHUNK_MAX ? FRAME_CHUNK_MAX : mtu - 7;
+            unsigned notifications = streamFrame(c.frame, maxData);
+            printf("  %6u", notifications);
+            if (notifications == 0)
+                failures++;
+        }
+        bool failedOk = failedSource(c.frame);
+        if (!failedOk)
+            failures++;
+        printf("%s\n", failedOk ? "" : "  FAILED SOURCE NOT REPORTED");
+    }
+    printf("\nRead-back state: %u bytes (FrameReadback), no heap\n%d failure(s)\n", (unsigned)sizeof(FrameReadback),
+           failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,198 @@
+/**
+ * @file render_pass_bench.cpp
+ * @brief Host benchmark: render passes and SPI transactions per full refresh
+ *        for paged display buffers against the full-frame buffer
+ *        (DISPLAY_FULL_FRAME). The GxEPD2 call sequence is modelled:
+ *
+ *          paged (pages > 1), GxEPD2_BW::firstPage()/nextPage() full window:
+ *            phase 1: render + writeImage() per page, refresh(false)
+ *            phase 2: render + writeImage() per page, refresh(true)
+ *          one page: render, writeImage(), refresh(false), writeImageAgain()
+ *          display list (updateDisplay()): replay + writeImage() per band,
+ *            refresh(false), then writeImageAgain() per band (replayed again
+ *            only when there is more than one band)
+ *
+ *        A write to the SSD1680 RAM is SSD1680_WRITE_TRANSACTIONS SPI
+ *        transactions (RAM window and counters, then the RAM command and one
+ *        data burst). Render time is the real packed info screen replayed
+ *        into each page. Build and run:
+ *
+ *          g++ -std=c++11 -Itools/host -Isrc -I".pio/libdeps/t5_213/Adafruit GFX Library" \
+ *              tools/render_pass_bench.cpp src/display_list.cpp src/glyph_blit.cpp src/text_layout.cpp \
+ *              -o render_pass_bench && ./render_pass_bench
+ */
+#include <stdio.h>
+#include <chrono>
+
+#include <Adafruit_GFX.h>
+#include <Fonts/FreeSans9pt7b.h>
+#include <Fonts/FreeSans12pt7b.h>
+#include <Fonts/FreeSans18pt7b.h>
+#include <Fonts/FreeSans24pt7b.h>
+#include <Fonts/FreeSansBold9pt7b.h>
+#include <Fonts/FreeSansBold12pt7b.h>
+#include <Fonts/FreeSansBold18pt7b.h>
+#include <Fonts/FreeSansBold24pt7b.h>
+
+#include "display_list.h"
+#include "glyph_blit.h"
+#include "text_layout.h"
+
+static const InfoFontSet FONTS = {
+    {&FreeSans9pt7b, &FreeSans12pt7b, &FreeSans18pt7b, &FreeSans24pt7b},
+    {&FreeSansBold9pt7b, &FreeSansBold12pt7b, &FreeSansBold18pt7b, &FreeSansBold24pt7b}};
+
+// GDEY0213B74: 128 (122 visible) x 250, rotation 1 as on the badge
+static const uint16_t NATIVE_STRIDE = 128 / 8;
+static const int16_t NATIVE_W = 122, NATIVE_H = 250;
+
+// _setPartialRamArea(): 5 commands + 10 data bytes, each a transaction; then
+// the write RAM command and the data burst
+static const uint8_t SSD1680_WRITE_TRANSACTIONS = 15 + 1 + 1;
+
+struct RefreshCost
+{
+    uint16_t renderPasses;
+    uint16_t writes;
+    uint32_t transactions;
+    uint32_t bytes;
+    uint8_t refreshes;
+    double renderUs;
+};
+
+class PanelModel
+{
+public:
+    PanelModel(const DisplayList &list, int16_t pageRows) : list(list), pageRows(pageRows), cost() {}
+
+    uint16_t pages() const { return (NATIVE_H + pageRows - 1) / pageRows; }
+
+    void render(int16_t page)
+    {
+        static uint8_t buffer[NATIVE_STRIDE * NATIVE_H];
+        auto t0 = std::chrono::steady_clock::now();
+        PackedFrame frame = packedFrame(buffer, NATIVE_STRIDE, NATIVE_W, NATIVE_H, 1);
+        frame.bandY = page * pageRows;
+        frame.bandH = rows(page);
+        frameFill(frame, false);
+        list.replay(frame);
+        cost.renderUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+        cost.renderPasses++;
+    }
+
+    void write(int16_t page)
+    {
+        cost.writes++;
+        cost.transactions += SSD1680_WRITE_TRANSACTIONS;
+        cost.bytes += (uint32_t)NATIVE_STRIDE * rows(page);
+    }
+
+    void refresh() { cost.refreshes++; }
+
+    RefreshCost result() const { return cost; }
+
+private:
+    int16_t rows(int16_t page) const
+    {
+        return (page + 1) * pageRows <= NATIVE_H ? pageRows : NATIVE_H - page * pageRows;
+    }
+
+    const DisplayList &list;
+    int16_t pageRows;
+    RefreshCost cost;
+};
+
+static RefreshCost gxepd2PageLoop(const DisplayList &list, int16_t pageRows)
+{
+    PanelModel panel(list, pageRows);
+    if (panel.pages() == 1)
+    {
+        panel.render(0);
+        panel.write(0);
+        panel.refresh();
+        panel.write(0); // writeImageAgain()
+        return panel.result();
+    }
+    for (uint8_t phase = 0; phase < 2; phase++)
+    {
+        for (uint16_t page = 0; page < panel.pages(); page++)
+        {
+            panel.render(page);
+            panel.write(page);
+        }
+        panel.refresh();
+    }
+    return panel.result();
+}
+
+static RefreshCost displayListRefresh(const DisplayList &list, int16_t bandRows)
+{
+    PanelModel panel(list, bandRows);
+    for (uint16_t band = 0; band < panel.pages(); band++)
+    {
+        panel.render(band);
+        panel.write(band);
+    }
+    panel.refresh();
+    for (uint16_t band = 0; band < panel.pages(); band++)
+    {
+        if (panel.pages() > 1)
+            panel.render(band);
+        panel.write(band);
+    }
+    return panel.result();
+}
+
+static void printCost(const char *name, int16_t rows, uint16_t pages, const RefreshCost &cost, int runs)
+{
+    printf("%-36s %5d %6u | %7u %7u %8lu %7lu %6u | %9.1f\n", name, rows, pages, cost.renderPasses, cost.writes,
+           (unsigned long)cost.transactions, (unsigned long)cost.bytes, cost.refreshes, cost.renderUs / runs);
+}
+
+int main()
+{
+    const char *text = "Jane Doe\nFirmware Engineer\njane.doe@example.com\n+1 555 0100";
+    InfoLayout layout;
+    computeInfoLayout(text, 250, FONTS, NATIVE_H, NATIVE_W, layout);
+    DisplayList list;
+    for (uint8_t i = 0; i < layout.lineCount; i++)
+    {
+        const InfoLine &line = layout.lines[i];
+        list.addGlyphs(infoFont(FONTS, line.fontIndex), line.x, line.baselineY, text + line.start, line.length);
+    }
+
+    // Page heights from MAX_HEIGHT(): 800 B buffer (AVR), 2 KB, full frame
+    struct Config
+    {
+        const char *name;
+        int16_t rows;
+    } configs[] = {
+        {"paged, 800 B buffer", 800 / NATIVE_STRIDE},
+        {"paged, 2 KB buffer", 2000 / NATIVE_STRIDE},
+        {"full frame (4000 B)", NATIVE_H},
+    };
+    const int RUNS = 200;
+
+    printf("%-36s %5s %6s | %7s %7s %8s %7s %6s | %9s\n", "configuration", "rows", "pages", "renders", "writes",
+           "SPI txns", "bytes", "refr.", "render us");
+    for (const Config &config : configs)
+    {
+        RefreshCost loop = {}, replay = {};
+        for (int run = 0; run < RUNS; run++)
+        {
+            RefreshCost a = gxepd2PageLoop(list, config.rows);
+            RefreshCost b = displayListRefresh(list, config.rows);
+            a.renderUs += loop.renderUs;
+            b.renderUs += replay.renderUs;
+            loop = a;
+            replay = b;
+        }
+        uint16_t pages = (NATIVE_H + config.rows - 1) / config.rows;
+        char name[64];
+        snprintf(name, sizeof(name), "%s, page loop", config.name);
+        printCost(name, config.rows, pages, loop, RUNS);
+        snprintf(name, sizeof(name), "%s, display list", config.name);
+        printCost(name, config.rows, pages, replay, RUNS);
+    }
+    return 0;
+}
@@ -0,0 +1,168 @@
+"""Flash / RAM budget table for every built PlatformIO environment.
+
+Reads the section headers of .pio/build/<env>/firmware.elf (no toolchain
+needed) and sums them the way PlatformIO's size check does for the ESP32:
+
+  flash: .iram0.text .iram0.vectors .dram0.data .flash.text .flash.rodata
+         .flash.appdesc
+  RAM:   .dram0.data .dram0.bss .noinit
+
+Each row shows use against the environment's budget (custom_flash_budget /
+custom_ram_budget in platformio.ini, else the board's maximum) and the change
+since the previous run (kept in .pio/size_budget.json), so a regression shows
+up as a delta. Over-budget environments make the run fail.
+
+As a PlatformIO extra script it adds a "budget" target:
+
+  pio run -t budget            (builds and prints the table, all environments)
+  pio run -e t5_213 -t budget
+
+It also enables LTO for the project sources when custom_lto = yes (the flag
+has to reach both the compiler and the linker, which build_flags does not do).
+Standalone, it prints the table for whatever is already built:
+
+  python tools/size_budget.py [project_dir]
+"""
+import json
+import os
+import re
+import struct
+import sys
+
+FLASH_SECTIONS = re.compile(r"^\.(iram0\.text|iram0\.vectors|dram0\.data|flash\.text|flash\.rodata|flash\.appdesc)$")
+RAM_SECTIONS = re.compile(r"^\.(dram0\.data|dram0\.bss|noinit)$")
+
+# esp32dev defaults (default 4 MB partition table, internal DRAM)
+DEFAULT_FLASH_MAX = 1310720
+DEFAULT_RAM_MAX = 327680
+
+
+def elf_sections(path):
+    """(name, size) of every section in an ELF file (32 or 64 bit, either endianness)."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"\x7fELF":
+        raise ValueError("%s is not an ELF file" % path)
+    is64 = data[4] == 2
+    end = "<" if data[5] == 1 else ">"
+    if is64:
+        shoff, = struct.unpack_from(end + "Q", data, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(end + "HHH", data, 0x3A)
+    else:
+        shoff, = struct.unpack_from(end + "I", data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(end + "HHH", data, 0x2E)
+
+    def header(i):
+        base = shoff + i * shentsize
+        if is64:
+            name, _, _, _, offset, size = struct.unpack_from(end + "IIQQQQ", data, base)
+        else:
+            name, _, _, _, offset, size = struct.unpack_from(end + "IIIIII", data, base)
+        return name, offset, size
+
+    _, names_offset, _ = header(shstrndx)
+    sections = []
+    for i in range(shnum):
+        name, _, size = header(i)
+        start = names_offset + name
+        sections.append((data[start:data.index(b"\0", start)].decode("ascii", "replace"), size))
+    return sections
+
+
+def measure(elf_path):
+    flash = ram = 0
+    for name, size in elf_sections(elf_path):
+        if FLASH_SECTIONS.match(name):
+            flash += size
+        if RAM_SECTIONS.match(name):
+            ram += size
+    return flash, ram
+
+
+def read_budgets(project_dir):
+    """{env: (flash_budget, ram_budget)} from platformio.ini ([env] values are inherited)."""
+    try:
+        import configparser
+    except ImportError:  # Python 2 (old PlatformIO)
+        import ConfigParser as configparser
+    parser = configparser.RawConfigParser()
+    parser.read(os.path.join(project_dir, "platformio.ini"))
+
+    def option(section, key, seen=()):
+        if parser.has_option(section, key):
+            return parser.get(section, key)
+        if section in seen:
+            return None
+        if parser.has_option(section, "extends"):
+            return option(parser.get(section, "extends").strip(), key, seen + (section,))
+        if section != "env" and parser.has_section("env"):
+            return option("env", key, seen + (section,))
+        return None
+
+    budgets = {}
+    for section in parser.sections():
+        if section.startswith("env:"):
+            flash = option(section, "custom_flash_budget")
+            ram = option(section, "custom_ram_budget")
+            budgets[section[4:]] = (int(flash, 0) if flash else DEFAULT_FLASH_MAX,
+                                    int(ram, 0) if ram else DEFAULT_RAM_MAX)
+    return budgets
+
+
+def budget_table(project_dir, highlight=None):
+    """Prints the table; returns the number of environments over budget."""
+    build_dir = os.path.join(project_dir, ".pio", "build")
+    history_path = os.path.join(project_dir, ".pio", "size_budget.json")
+    budgets = read_budgets(project_dir)
+    try:
+        with open(history_path) as f:
+            history = json.load(f)
+    except (IOError, ValueError):
+        history = {}
+
+    rows = []
+    for env_name in sorted(budgets):
+        elf = os.path.join(build_dir, env_name, "firmware.elf")
+        if os.path.isfile(elf):
+            rows.append((env_name,) + measure(elf) + budgets[env_name])
+
+    print("%-2s%-14s %10s %10s %6s %8s | %8s %8s %6s %7s" %
+          ("", "environment", "flash", "budget", "%", "delta", "RAM", "budget", "%", "delta"))
+    over = 0
+    for env_name, flash, ram, flash_budget, ram_budget in rows:
+        last = history.get(env_name, {})
+        flash_delta = flash - last["flash"] if "flash" in last else 0
+        ram_delta = ram - last["ram"] if "ram" in last else 0
+        failed = flash > flash_budget or ram > ram_budget
+        over += failed
+        print("%-2s%-14s %10d %10d %5.1f%% %+8d | %8d %8d %5.1f%% %+7d%s" %
+              ("*" if env_name == highlight else "", env_name, flash, flash_budget, 100.0 * flash / flash_budget,
+               flash_delta, ram, ram_budget, 100.0 * ram / ram_budget, ram_delta, "  OVER BUDGET" if failed else ""))
+        history[env_name] = {"flash": flash, "ram": ram}
+    if not rows:
+        print("(nothing built yet: pio run)")
+
+    if os.path.isdir(os.path.dirname(history_path)):
+        with open(history_path, "w") as f:
+            json.dump(history, f, indent=1, sort_keys=True)
+    return over
+
+
+if __name__ == "__main__":
+    sys.exit(1 if budget_table(sys.argv[1] if len(sys.argv) > 1 else ".") else 0)
+else:
+    Import("env")  # noqa: F821 (provided by PlatformIO)
+
+    if env.GetProjectOption("custom_lto", "no").lower() in ("yes", "true", "1"):  # noqa: F821
+        env.Append(CCFLAGS=["-flto"], LINKFLAGS=["-flto"])  # noqa: F821
+
+    def print_budget(target, source, env):
+        if budget_table(env.subst("$PROJECT_DIR"), env.subst("$PIOENV")):
+            env.Exit(1)
+
+    env.AddCustomTarget(  # noqa: F821
+        name="budget",
+        dependencies="$BUILD_DIR/${PROGNAME}.elf",
+        actions=print_budget,
+        title="Size budget",
+        description="Flash / RAM use of every built environment against its budget")